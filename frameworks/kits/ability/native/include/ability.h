@@ -32,6 +32,8 @@
 #include "dummy_data_ability_predicates.h"
 #include "dummy_values_bucket.h"
 #include "dummy_result_set.h"
+#include "data_ability_operation.h"
+#include "data_ability_result.h"
 #include "dummy_continuation_state.h"
 #include "dummy_ability_package.h"
 #include "dummy_configuration.h"
@@ -749,6 +751,54 @@ public:
      */
     virtual int BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values);
 
+    /**
+     * @brief Performs a batch of operations on the database in order. A back reference of an operation is resolved
+     * to the id inserted or the count affected by the referenced operation before it. The batch stops at the first
+     * failed operation.
+     * The batch runs between BeginBatch and CommitBatch. When it fails, RollbackBatch undoes the operations after
+     * the last commit. The default hooks do nothing, so unless a Data ability overrides them the batch is not
+     * atomic, and the operations before the failed one stay performed.
+     *
+     * @param operations Indicates the operations to perform.
+     *
+     * @return Returns the results of the operations performed and not rolled back.
+     */
+    virtual std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations);
+
+    /**
+     * @brief Called by ExecuteBatch before the first operation. A Data ability backed by a database begins a
+     * transaction here.
+     *
+     * @return Returns true if the batch may run; returns false otherwise.
+     */
+    virtual bool BeginBatch();
+
+    /**
+     * @brief Called by ExecuteBatch after the last operation succeeded, and by OnBatchYield.
+     *
+     * @return Returns true if the operations performed since BeginBatch are committed; returns false otherwise.
+     */
+    virtual bool CommitBatch();
+
+    /**
+     * @brief Called by ExecuteBatch when an operation or a commit failed, to undo the operations performed since
+     * the last BeginBatch.
+     *
+     * @return Returns true if the operations are undone; returns false if they can not be undone.
+     */
+    virtual bool RollbackBatch();
+
+    /**
+     * @brief Called by ExecuteBatch before an operation which allows interruption, the default commits the
+     * finished operations and begins a new batch to let other callers in.
+     *
+     * @param index Indicates the index of the operation to perform next.
+     *
+     * @return Returns true if the batch may go on; returns false otherwise.
+     */
+    virtual bool OnBatchYield(size_t index);
+
     /**
      * @brief Obtains the type of audio whose volume is adjusted by the volume button.
      *
@@ -838,6 +888,14 @@ public:
     void TerminateAndRemoveMission() override;
 
 private:
+    std::shared_ptr<DataAbilityResult> ExecuteOperation(const std::shared_ptr<DataAbilityOperation> &operation,
+        const std::vector<std::shared_ptr<DataAbilityResult>> &results);
+    std::shared_ptr<DataAbilityPredicates> ResolvePredicatesBackReferences(
+        const std::shared_ptr<DataAbilityOperation> &operation,
+        const std::vector<std::shared_ptr<DataAbilityResult>> &results);
+    bool GetBackReferenceValue(const std::vector<std::shared_ptr<DataAbilityResult>> &results, int resultIndex,
+        long &value);
+
     std::shared_ptr<AbilityInfo> abilityInfo_ = nullptr;
     std::shared_ptr<Context> context_;
     std::shared_ptr<AbilityHandler> handler_;
@@ -273,6 +273,18 @@ public:
      */
     virtual int BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values);
 
+    /**
+     * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+     * of the operations before it.
+     *
+     * @param operations Indicates the operations to perform, in order.
+     *
+     * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+     * Only a Data ability performs operations, see DataAbilityImpl, no operation is performed here.
+     */
+    virtual std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations);
+
     /**
      * @brief Set deviceId/bundleName/abilityName of the calling ability
      *
@@ -20,6 +20,8 @@
 #include "dummy_values_bucket.h"
 #include "dummy_data_ability_predicates.h"
 #include "dummy_result_set.h"
+#include "data_ability_operation.h"
+#include "data_ability_result.h"
 #include "uri.h"
 
 using Uri = OHOS::Uri;
@@ -186,6 +188,18 @@ public:
      */
     int BatchInsert(Uri &uri, const std::vector<ValuesBucket> &values);
 
+    /**
+     * @brief Performs a batch of operations on the data ability in one call, an operation may reference the results
+     * of the operations before it.
+     *
+     * @param uri Indicates the path of the data ability to operate.
+     * @param operations Indicates the operations to perform, in order.
+     *
+     * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+     */
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        Uri &uri, const std::vector<std::shared_ptr<DataAbilityOperation>> &operations);
+
 private:
     DataAbilityHelper(const std::shared_ptr<Context> &context, const std::shared_ptr<Uri> &uri,
         const sptr<AAFwk::IAbilityScheduler> &dataAbilityProxy, bool tryBind = false);
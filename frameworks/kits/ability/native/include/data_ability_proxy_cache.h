@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_PROXY_CACHE_H
+#define FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_PROXY_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "ability_scheduler_interface.h"
+#include "iremote_object.h"
+#include "uri.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class DataAbilityProxyCache
+ * DataAbilityProxyCache keeps the data ability proxies acquired by this process, keyed by uri authority.
+ * A proxy is leased with a reference count, released to the ability manager after it stays idle for the
+ * idle timeout, and dropped at once when the data ability dies.
+ */
+class DataAbilityProxyCache : public std::enable_shared_from_this<DataAbilityProxyCache> {
+public:
+    DataAbilityProxyCache();
+    virtual ~DataAbilityProxyCache();
+    static std::shared_ptr<DataAbilityProxyCache> GetInstance();
+
+    /**
+     * @brief Leases the proxy of the data ability specified by uri, acquires it from the ability manager on miss.
+     *
+     * @param uri Indicates the uri of the data ability.
+     * @param tryBind Specifies whether the exit of the data ability process causes the exit of the client process.
+     * @param callerToken Indicates the token of the client ability.
+     *
+     * @return Returns the data ability proxy, nullptr if failed.
+     */
+    sptr<AAFwk::IAbilityScheduler> Acquire(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken);
+
+    /**
+     * @brief Returns the lease of proxy, the proxy is released after the idle timeout if there is no more lease.
+     *
+     * @param uri Indicates the uri of the data ability.
+     * @param tryBind Specifies whether the exit of the data ability process causes the exit of the client process.
+     * @param callerToken Indicates the token of the client ability.
+     * @param proxy Indicates the proxy returned by Acquire.
+     *
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int Release(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken,
+        const sptr<AAFwk::IAbilityScheduler> &proxy);
+
+    /**
+     * @brief Sets the idle timeout in milliseconds, a timeout no more than 0 disables caching.
+     */
+    void SetIdleTimeout(long idleTimeout);
+    long GetIdleTimeout();
+
+    /**
+     * @brief Obtains the lease count of the cached proxy, -1 if the proxy is not cached.
+     */
+    int GetLeaseCount(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken);
+    size_t GetSize();
+
+    /**
+     * @brief Releases all idle proxies immediately.
+     */
+    void ReleaseIdle();
+
+private:
+    using CacheKey = std::tuple<std::string, IRemoteObject *, bool>;
+
+    struct CacheEntry {
+        sptr<AAFwk::IAbilityScheduler> proxy;
+        sptr<IRemoteObject> callerToken;
+        sptr<IRemoteObject::DeathRecipient> deathRecipient;
+        int leaseCount = 0;
+        uint64_t idleSerial = 0;
+    };
+
+    static CacheKey MakeKey(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken);
+    void ScheduleIdleRelease(const CacheKey &key, uint64_t idleSerial);
+    void OnIdleTimeout(const CacheKey &key, uint64_t idleSerial);
+    void OnProxyDied(const wptr<IRemoteObject> &remote);
+    void ReleaseEntry(const CacheEntry &entry, bool needRelease);
+
+    static std::mutex instanceMutex_;
+    static std::shared_ptr<DataAbilityProxyCache> instance_;
+
+    std::mutex mutex_;
+    std::map<CacheKey, CacheEntry> entries_;
+    long idleTimeout_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_DATA_ABILITY_PROXY_CACHE_H
@@ -18,6 +18,7 @@
 
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 #include "nocopyable.h"
 #include "parcel.h"
@@ -35,8 +36,15 @@ public:
     virtual bool Marshalling(Parcel &parcel) const override;
     static DataAbilityPredicates *Unmarshalling(Parcel &parcel);
 
+    /**
+     * @brief Sets the arguments which replace the placeholders of the where clause.
+     */
+    void SetWhereArgs(const std::vector<std::string> &whereArgs);
+    std::vector<std::string> GetWhereArgs() const;
+
 private:
     std::string testInf_;
+    std::vector<std::string> whereArgs_;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
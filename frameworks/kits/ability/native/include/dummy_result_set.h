@@ -18,22 +18,73 @@
 
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 #include "nocopyable.h"
 #include "parcel.h"
 
 namespace OHOS {
 namespace AppExecFwk {
+/**
+ * @class ResultSet
+ * ResultSet is the rows of a query, each row has a string value of each column. The rows are kept in one
+ * row-major array. It is read by moving to a row and getting the values of the row.
+ */
 class ResultSet : public Parcelable {
 public:
     ResultSet() = default;
     ResultSet(const std::string &testInf);
-    ~ResultSet() = default;
+    explicit ResultSet(const std::vector<std::string> &columnNames);
+    virtual ~ResultSet() = default;
 
     bool ReadFromParcel(Parcel &parcel);
     virtual bool Marshalling(Parcel &parcel) const override;
     static ResultSet *Unmarshalling(Parcel &parcel);
+
+    /**
+     * append a row, it must have a value of each column.
+     *
+     * @return Returns false if the size of row is not the column count.
+     */
+    bool AddRow(const std::vector<std::string> &row);
+
+    const std::vector<std::string> &GetAllColumnNames() const;
+    int GetColumnCount() const;
+    virtual int GetRowCount();
+
+    /**
+     * move to the row at position, the first row is at 0.
+     *
+     * @return Returns false if there is no such row.
+     */
+    virtual bool GoToRow(int position);
+    bool GoToFirstRow();
+    bool GoToNextRow();
+    int GetRowIndex() const;
+
+    /**
+     * get the value of the column in the current row.
+     *
+     * @return Returns false if there is no current row or no such column.
+     */
+    virtual bool GetString(int columnIndex, std::string &value);
+
+    /**
+     * get the bytes of the values, used to decide whether the rows fit in a parcel.
+     */
+    virtual size_t GetDataSize();
+
+    virtual void Close();
+
     std::string testInf_;
+
+protected:
+    std::vector<std::string> columnNames_;
+    int rowPos_ = -1;
+
+private:
+    std::vector<std::string> values_;
+    size_t dataSize_ = 0;
 };
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_CURSOR_H
+#define FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_CURSOR_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ashmem.h"
+#include "dummy_result_set.h"
+#include "iremote_broker.h"
+#include "iremote_proxy.h"
+#include "iremote_stub.h"
+#include "result_set_window.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class IResultSetCursor
+ * IResultSetCursor pages the rows of a query result from the provider to the client through windows of
+ * shared memory, the memory of a window is sent once and the window is refilled in place afterwards.
+ */
+class IResultSetCursor : public IRemoteBroker {
+public:
+    DECLARE_INTERFACE_DESCRIPTOR(u"ohos.appexecfwk.ResultSetCursor");
+
+    /**
+     * fill a window with the rows from startRow.
+     *
+     * @param startRow, the first row of the window.
+     * @param windowId, the window to refill, or -1 for a new window; output the id of the filled window.
+     * @param memory, output the memory of a new window, or the new memory of a refilled window whose rows did
+     *               not fit in its memory; nullptr if a window is refilled in place.
+     * @return Returns the count of the rows in the window, 0 on failure.
+     */
+    virtual int32_t FillWindow(int32_t startRow, int32_t &windowId, sptr<Ashmem> &memory) = 0;
+
+    /**
+     * release a window the client does not use any more, its id may be given to a new window.
+     *
+     * @param windowId, the window to release.
+     */
+    virtual void ReleaseWindow(int32_t windowId) = 0;
+
+    /**
+     * release the result set and the windows of the provider.
+     */
+    virtual void Close() = 0;
+
+    enum {
+        FILL_WINDOW = 0,
+        CLOSE,
+        RELEASE_WINDOW,
+    };
+};
+
+class ResultSetCursorProxy : public IRemoteProxy<IResultSetCursor> {
+public:
+    explicit ResultSetCursorProxy(const sptr<IRemoteObject> &impl) : IRemoteProxy<IResultSetCursor>(impl)
+    {}
+
+    virtual ~ResultSetCursorProxy()
+    {}
+
+    virtual int32_t FillWindow(int32_t startRow, int32_t &windowId, sptr<Ashmem> &memory) override;
+    virtual void ReleaseWindow(int32_t windowId) override;
+    virtual void Close() override;
+
+private:
+    static inline BrokerDelegator<ResultSetCursorProxy> delegator_;
+};
+
+/**
+ * @class ResultSetCursorStub
+ * ResultSetCursorStub serves the windows of a result set on the provider side. The rows are only read from
+ * the result set when the client asks for them, at most MAX_WINDOW_COUNT windows are kept for a client.
+ * The memory of a window is WINDOW_SIZE, a row larger than that gets a memory of its own size, which is
+ * replaced by a memory of WINDOW_SIZE again when the window is refilled with smaller rows.
+ */
+class ResultSetCursorStub : public IRemoteStub<IResultSetCursor> {
+public:
+    static constexpr size_t WINDOW_SIZE = 512 * 1024;
+    static constexpr int32_t MAX_WINDOW_COUNT = 2;
+
+    explicit ResultSetCursorStub(const std::shared_ptr<ResultSet> &resultSet, size_t windowSize = WINDOW_SIZE);
+    virtual ~ResultSetCursorStub();
+
+    virtual int OnRemoteRequest(
+        uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
+
+    virtual int32_t FillWindow(int32_t startRow, int32_t &windowId, sptr<Ashmem> &memory) override;
+    virtual void ReleaseWindow(int32_t windowId) override;
+    virtual void Close() override;
+
+private:
+    int FillWindowInner(MessageParcel &data, MessageParcel &reply);
+    int CloseInner(MessageParcel &data, MessageParcel &reply);
+    int ReleaseWindowInner(MessageParcel &data, MessageParcel &reply);
+    int32_t AllocateWindowIdLocked();
+    void ReleaseWindowLocked(int32_t windowId);
+    bool WriteWindowLocked(const sptr<Ashmem> &target);
+
+    std::mutex mutex_;
+    size_t windowSize_;
+    std::shared_ptr<ResultSet> resultSet_;
+    ResultSetWindow window_;  // its buffers are reused by every fill
+    std::vector<sptr<Ashmem>> windows_;  // indexed by window id, nullptr for a released id
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_CURSOR_H
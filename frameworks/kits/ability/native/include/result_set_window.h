@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_WINDOW_H
+#define FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_WINDOW_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dummy_result_set.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class ResultSetWindow
+ * ResultSetWindow is the layout of a run of rows in a block of shared memory:
+ * a header, a slot of each value with its offset and length, and then the bytes of the values.
+ * The writer builds the window in its own buffers and copies it to the memory once, the reader reads the
+ * values in place and checks every slot against the size of the memory.
+ */
+class ResultSetWindow {
+public:
+    struct Header {
+        int32_t startRow = 0;
+        uint32_t rowCount = 0;
+        uint32_t columnCount = 0;
+        uint32_t dataOffset = 0;  // where the bytes of the values begin
+        uint32_t dataSize = 0;
+    };
+
+    struct Slot {
+        uint32_t offset = 0;  // from dataOffset
+        uint32_t length = 0;
+    };
+
+    explicit ResultSetWindow(size_t windowSize);
+    ~ResultSetWindow() = default;
+
+    /**
+     * fill the window with the rows of resultSet from startRow, as many as fit in the window.
+     * A row larger than the window is put in the window alone, the window is then larger than its size.
+     *
+     * @return Returns the count of the rows, 0 if there is no such row.
+     */
+    uint32_t Fill(ResultSet &resultSet, int32_t startRow);
+
+    /**
+     * get the bytes of the filled window, the header, the slots and the values.
+     */
+    size_t GetSize() const;
+
+    const Header &GetHeader() const;
+    const std::vector<Slot> &GetSlots() const;
+    const std::string &GetData() const;
+
+    /**
+     * check the header of a window in memory against the size of the memory.
+     *
+     * @return Returns false if the window is malformed.
+     */
+    static bool ReadHeader(const uint8_t *memory, size_t size, Header &header);
+
+    /**
+     * get the value of a checked window in memory.
+     *
+     * @param row, the row in the window, starting from 0.
+     * @return Returns false if there is no such value or its slot is out of the window.
+     */
+    static bool ReadString(const uint8_t *memory, const Header &header, uint32_t row, uint32_t column,
+        std::string &value);
+
+private:
+    size_t windowSize_;
+    Header header_;
+    std::vector<Slot> slots_;
+    std::string data_;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_RESULT_SET_WINDOW_H
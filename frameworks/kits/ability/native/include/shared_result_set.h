@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_OHOS_SHARED_RESULT_SET_H
+#define FOUNDATION_APPEXECFWK_OHOS_SHARED_RESULT_SET_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "message_parcel.h"
+#include "result_set_cursor.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * @class SharedResultSet
+ * SharedResultSet is the client side of a result set served by a cursor. The rows are not copied into the
+ * client, they are read in place from the windows of shared memory. Moving out of the mapped windows refills
+ * the least recently used one, so a scan of any length maps at most MAX_WINDOW_COUNT windows.
+ * It is not thread safe, like any ResultSet.
+ */
+class SharedResultSet : public ResultSet {
+public:
+    // a result set with more bytes of values is sent through a cursor instead of the reply parcel.
+    static constexpr size_t MAX_INLINE_DATA_SIZE = 64 * 1024;
+
+    SharedResultSet(const std::vector<std::string> &columnNames, int rowCount, const sptr<IResultSetCursor> &cursor);
+    virtual ~SharedResultSet();
+
+    /**
+     * write resultSet into the reply of a query, a large result set is written as a cursor.
+     *
+     * @return Returns true on success.
+     */
+    static bool WriteResultSet(MessageParcel &parcel, const std::shared_ptr<ResultSet> &resultSet);
+
+    /**
+     * read the result set written by WriteResultSet.
+     *
+     * @return Returns the result set, nullptr on failure.
+     */
+    static std::shared_ptr<ResultSet> ReadResultSet(MessageParcel &parcel);
+
+    virtual int GetRowCount() override;
+    virtual bool GoToRow(int position) override;
+    virtual bool GetString(int columnIndex, std::string &value) override;
+    virtual size_t GetDataSize() override;
+    virtual void Close() override;
+
+private:
+    enum {
+        RESULT_SET_INLINE = 0,
+        RESULT_SET_CURSOR,
+    };
+
+    struct ClientWindow {
+        int32_t id = -1;
+        sptr<Ashmem> memory;
+        const uint8_t *data = nullptr;
+        ResultSetWindow::Header header;
+        uint64_t lastUse = 0;
+    };
+
+    bool FetchWindow(int position);
+
+    sptr<IResultSetCursor> cursor_;
+    int rowCount_;
+    std::vector<ClientWindow> windows_;
+    size_t current_ = 0;  // the window of the current row
+    uint64_t useClock_ = 0;
+};
+}  // namespace AppExecFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_APPEXECFWK_OHOS_SHARED_RESULT_SET_H
@@ -16,6 +16,7 @@
 #include "ability.h"
 #include "ability_loader.h"
 #include "app_log_wrapper.h"
+#include "data_uri_utils.h"
 #include "display_type.h"
 #include "iservice_registry.h"
 #include "system_ability_definition.h"
@@ -1013,6 +1014,203 @@ int Ability::BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values
     return amount;
 }
 
+/**
+ * @brief Performs a batch of operations on the database in order. A back reference of an operation is resolved
+ * to the id inserted or the count affected by the referenced operation before it. The batch stops at the first
+ * failed operation.
+ * The batch runs between BeginBatch and CommitBatch. When it fails, RollbackBatch undoes the operations after
+ * the last commit. The default hooks do nothing, so unless a Data ability overrides them the batch is not
+ * atomic, and the operations before the failed one stay performed.
+ *
+ * @param operations Indicates the operations to perform.
+ *
+ * @return Returns the results of the operations performed and not rolled back.
+ */
+std::vector<std::shared_ptr<DataAbilityResult>> Ability::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    std::vector<std::shared_ptr<DataAbilityResult>> results;
+    if (!BeginBatch()) {
+        APP_LOGE("Ability::ExecuteBatch failed to begin the batch");
+        return results;
+    }
+    results.reserve(operations.size());
+    size_t committedCount = 0;
+    bool succeeded = true;
+    for (size_t i = 0; i < operations.size(); i++) {
+        const std::shared_ptr<DataAbilityOperation> &operation = operations[i];
+        if (operation == nullptr || operation->GetUri() == nullptr) {
+            APP_LOGE("Ability::ExecuteBatch operation is invalid, index = %{public}zu", i);
+            succeeded = false;
+            break;
+        }
+        if (i > 0 && operation->IsInterruptionAllowed()) {
+            if (!OnBatchYield(i)) {
+                APP_LOGE("Ability::ExecuteBatch failed to yield, index = %{public}zu", i);
+                succeeded = false;
+                break;
+            }
+            committedCount = results.size();
+        }
+        std::shared_ptr<DataAbilityResult> result = ExecuteOperation(operation, results);
+        if (result == nullptr) {
+            APP_LOGE("Ability::ExecuteBatch operation failed, index = %{public}zu", i);
+            succeeded = false;
+            break;
+        }
+        results.emplace_back(result);
+    }
+    if (succeeded && CommitBatch()) {
+        return results;
+    }
+
+    if (RollbackBatch()) {
+        results.resize(committedCount);
+    }
+    APP_LOGE("Ability::ExecuteBatch failed, results = %{public}zu", results.size());
+    return results;
+}
+
+/**
+ * @brief Called by ExecuteBatch before the first operation. A Data ability backed by a database begins a
+ * transaction here.
+ *
+ * @return Returns true if the batch may run; returns false otherwise.
+ */
+bool Ability::BeginBatch()
+{
+    return true;
+}
+
+/**
+ * @brief Called by ExecuteBatch after the last operation succeeded, and by OnBatchYield.
+ *
+ * @return Returns true if the operations performed since BeginBatch are committed; returns false otherwise.
+ */
+bool Ability::CommitBatch()
+{
+    return true;
+}
+
+/**
+ * @brief Called by ExecuteBatch when an operation or a commit failed, to undo the operations performed since
+ * the last BeginBatch.
+ *
+ * @return Returns true if the operations are undone; returns false if they can not be undone.
+ */
+bool Ability::RollbackBatch()
+{
+    return false;
+}
+
+/**
+ * @brief Called by ExecuteBatch before an operation which allows interruption, the default commits the
+ * finished operations and begins a new batch to let other callers in.
+ *
+ * @param index Indicates the index of the operation to perform next.
+ *
+ * @return Returns true if the batch may go on; returns false otherwise.
+ */
+bool Ability::OnBatchYield(size_t index)
+{
+    return CommitBatch() && BeginBatch();
+}
+
+std::shared_ptr<DataAbilityResult> Ability::ExecuteOperation(const std::shared_ptr<DataAbilityOperation> &operation,
+    const std::vector<std::shared_ptr<DataAbilityResult>> &results)
+{
+    const Uri &uri = *operation->GetUri();
+    std::shared_ptr<ValuesBucket> values = operation->GetValuesBucket();
+    std::shared_ptr<ValuesBucket> references = operation->GetValuesBucketReferences();
+    if (values == nullptr || references != nullptr) {
+        values = (values == nullptr) ? std::make_shared<ValuesBucket>() : std::make_shared<ValuesBucket>(*values);
+        if (references != nullptr) {
+            values->PutValues(references);
+        }
+    }
+    std::shared_ptr<DataAbilityPredicates> predicates = ResolvePredicatesBackReferences(operation, results);
+    if (predicates == nullptr) {
+        return nullptr;
+    }
+
+    if (operation->IsInsertOperation()) {
+        int id = Insert(uri, *values);
+        if (id < 0) {
+            return nullptr;
+        }
+        return std::make_shared<DataAbilityResult>(DataUriUtils::AttachId(uri, id));
+    }
+
+    int count = 0;
+    if (operation->IsUpdateOperation()) {
+        count = Update(uri, *values, *predicates);
+    } else if (operation->IsDeleteOperation()) {
+        count = Delete(uri, *predicates);
+    } else if (operation->IsAssertOperation()) {
+        // the values bucket has no columns to compare with the rows, an assertion checks the count of rows.
+        std::vector<std::string> columns;
+        std::shared_ptr<ResultSet> resultSet = Query(uri, columns, *predicates);
+        if (resultSet == nullptr) {
+            return nullptr;
+        }
+        count = resultSet->GetRowCount();
+        resultSet->Close();
+    } else {
+        APP_LOGE("Ability::ExecuteOperation unknown operation type = %{public}d", operation->GetType());
+        return nullptr;
+    }
+
+    int expectedCount = operation->GetExpectedCount();
+    if (count < 0 || (expectedCount > 0 && count != expectedCount)) {
+        APP_LOGE("Ability::ExecuteOperation count = %{public}d, expected = %{public}d", count, expectedCount);
+        return nullptr;
+    }
+    return std::make_shared<DataAbilityResult>(count);
+}
+
+std::shared_ptr<DataAbilityPredicates> Ability::ResolvePredicatesBackReferences(
+    const std::shared_ptr<DataAbilityOperation> &operation,
+    const std::vector<std::shared_ptr<DataAbilityResult>> &results)
+{
+    std::shared_ptr<DataAbilityPredicates> predicates = operation->GetDataAbilityPredicates();
+    std::map<int, int> references = operation->GetDataAbilityPredicatesBackReferences();
+    if (predicates == nullptr) {
+        predicates = std::make_shared<DataAbilityPredicates>();
+    }
+    if (references.empty()) {
+        return predicates;
+    }
+
+    std::vector<std::string> whereArgs = predicates->GetWhereArgs();
+    for (auto &reference : references) {
+        long value = 0;
+        if (reference.first < 0 || !GetBackReferenceValue(results, reference.second, value)) {
+            APP_LOGE("Ability::ResolvePredicatesBackReferences invalid reference %{public}d to %{public}d",
+                reference.first, reference.second);
+            return nullptr;
+        }
+        if (static_cast<size_t>(reference.first) >= whereArgs.size()) {
+            whereArgs.resize(reference.first + 1);
+        }
+        whereArgs[reference.first] = std::to_string(value);
+    }
+    predicates = std::make_shared<DataAbilityPredicates>(*predicates);
+    predicates->SetWhereArgs(whereArgs);
+    return predicates;
+}
+
+bool Ability::GetBackReferenceValue(const std::vector<std::shared_ptr<DataAbilityResult>> &results, int resultIndex,
+    long &value)
+{
+    // Only the operations before can be referenced.
+    if (resultIndex < 0 || static_cast<size_t>(resultIndex) >= results.size() || results[resultIndex] == nullptr) {
+        return false;
+    }
+    Uri uri = results[resultIndex]->GetUri();
+    value = uri.ToString().empty() ? results[resultIndex]->GetCount() : DataUriUtils::GetId(uri);
+    return true;
+}
+
 /**
  * @brief Migrates this ability to the given device on the same distributed network in a reversible way that allows this
  * ability to be migrated back to the local device through reverseContinueAbility(). The ability to migrate and its
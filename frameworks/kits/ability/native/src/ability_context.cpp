@@ -1063,9 +1063,39 @@ void AbilityContext::TerminateAndRemoveMission()
  */
 void AbilityContext::StartAbilities(const std::vector<AAFwk::Want> &wants)
 {
-    for (auto want : wants) {
-        StartAbility(want, ABILITY_CONTEXT_DEFAULT_REQUEST_CODE);
+    APP_LOGI("AbilityContext::StartAbilities called, size = %{public}zu", wants.size());
+
+    AppExecFwk::AbilityType type = GetAbilityInfoType();
+    if (type != AppExecFwk::AbilityType::PAGE && type != AppExecFwk::AbilityType::SERVICE) {
+        APP_LOGE("AbilityContext::StartAbilities AbilityType = %{public}d", type);
+        return;
+    }
+
+    // the local wants are started in one request, the remote ones are started by dms one by one.
+    std::vector<AAFwk::Want> localWants;
+    auto startLocalWants = [this, &localWants]() {
+        if (localWants.empty()) {
+            return;
+        }
+        ErrCode err = AAFwk::AbilityManagerClient::GetInstance()->StartAbilities(
+            localWants, token_, ABILITY_CONTEXT_DEFAULT_REQUEST_CODE);
+        if (err != ERR_OK) {
+            APP_LOGE("AbilityContext::StartAbilities is failed %{public}d", err);
+        }
+        localWants.clear();
+    };
+    for (const auto &want : wants) {
+        if (CheckIfOperateRemote(want)) {
+            startLocalWants();
+            StartAbility(want, ABILITY_CONTEXT_DEFAULT_REQUEST_CODE);
+            continue;
+        }
+        localWants.emplace_back(want);
+        if (localWants.size() == AAFwk::MAX_START_ABILITIES) {
+            startLocalWants();
+        }
     }
+    startLocalWants();
 }
 
 /**
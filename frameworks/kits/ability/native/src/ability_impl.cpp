@@ -527,6 +527,23 @@ int AbilityImpl::BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &va
     return -1;
 }
 
+/**
+ * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+ * of the operations before it.
+ *
+ * @param operations Indicates the operations to perform, in order.
+ *
+ * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+ * Only a Data ability performs operations, see DataAbilityImpl, no operation is performed here.
+ */
+std::vector<std::shared_ptr<DataAbilityResult>> AbilityImpl::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    APP_LOGE("AbilityImpl::ExecuteBatch is only supported by a Data ability, operations = %{public}zu",
+        operations.size());
+    return std::vector<std::shared_ptr<DataAbilityResult>>();
+}
+
 /**
  * @brief SerUriString
  */
@@ -730,6 +730,26 @@ int AbilityThread::BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &
     return ret;
 }
 
+/**
+ * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+ * of the operations before it.
+ *
+ * @param operations Indicates the operations to perform, in order.
+ *
+ * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+ */
+std::vector<std::shared_ptr<DataAbilityResult>> AbilityThread::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    std::vector<std::shared_ptr<DataAbilityResult>> results;
+    if (abilityImpl_ == nullptr) {
+        APP_LOGE("AbilityThread::ExecuteBatch abilityImpl_ is nullptr");
+        return results;
+    }
+    results = abilityImpl_->ExecuteBatch(operations);
+    return results;
+}
+
 /**
  * @description: Attach The ability thread to the main process.
  * @param application Indicates the main process.
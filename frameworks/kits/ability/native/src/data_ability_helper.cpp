@@ -16,6 +16,7 @@
 #include "data_ability_helper.h"
 #include "ability_thread.h"
 #include "ability_scheduler_interface.h"
+#include "data_ability_proxy_cache.h"
 #include "app_log_wrapper.h"
 
 namespace OHOS {
@@ -161,7 +162,7 @@ std::vector<std::string> DataAbilityHelper::GetFileTypes(Uri &uri, const std::st
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::GetFileTypes failed dataAbility == nullptr");
                 return matchedMIMEs;
@@ -169,7 +170,7 @@ std::vector<std::string> DataAbilityHelper::GetFileTypes(Uri &uri, const std::st
 
             matchedMIMEs = dataAbilityProxy->GetFileTypes(uri, mimeTypeFilter);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("DataAbilityHelper::GetFileTypes failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -199,7 +200,7 @@ int DataAbilityHelper::OpenFile(Uri &uri, const std::string &mode)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::OpenFile failed dataAbility == nullptr");
                 return fd;
@@ -207,7 +208,7 @@ int DataAbilityHelper::OpenFile(Uri &uri, const std::string &mode)
 
             fd = dataAbilityProxy->OpenFile(uri, mode);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::OpenFile failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -238,7 +239,7 @@ int DataAbilityHelper::OpenRawFile(Uri &uri, const std::string &mode)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::OpenRawFile failed dataAbility == nullptr");
                 return fd;
@@ -246,7 +247,7 @@ int DataAbilityHelper::OpenRawFile(Uri &uri, const std::string &mode)
 
             fd = dataAbilityProxy->OpenRawFile(uri, mode);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::OpenRawFile failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -273,7 +274,7 @@ int DataAbilityHelper::Insert(Uri &uri, const ValuesBucket &value)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::Insert failed dataAbility == nullptr");
                 return index;
@@ -281,7 +282,7 @@ int DataAbilityHelper::Insert(Uri &uri, const ValuesBucket &value)
 
             index = dataAbilityProxy->Insert(uri, value);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::Insert failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -309,7 +310,7 @@ int DataAbilityHelper::Update(Uri &uri, const ValuesBucket &value, const DataAbi
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::Insert failed dataAbility == nullptr");
                 return index;
@@ -317,7 +318,7 @@ int DataAbilityHelper::Update(Uri &uri, const ValuesBucket &value, const DataAbi
 
             index = dataAbilityProxy->Update(uri, value, predicates);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::Insert failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -344,7 +345,7 @@ int DataAbilityHelper::Delete(Uri &uri, const DataAbilityPredicates &predicates)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::Delete failed dataAbility == nullptr");
                 return index;
@@ -352,7 +353,7 @@ int DataAbilityHelper::Delete(Uri &uri, const DataAbilityPredicates &predicates)
 
             index = dataAbilityProxy->Delete(uri, predicates);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::Delete failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -381,7 +382,7 @@ std::shared_ptr<ResultSet> DataAbilityHelper::Query(
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::Query failed dataAbility == nullptr");
                 return resultset;
@@ -389,7 +390,7 @@ std::shared_ptr<ResultSet> DataAbilityHelper::Query(
 
             resultset = dataAbilityProxy->Query(uri, columns, predicates);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::Query failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -416,7 +417,7 @@ std::string DataAbilityHelper::GetType(Uri &uri)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::GetType failed dataAbility == nullptr");
                 return type;
@@ -424,7 +425,7 @@ std::string DataAbilityHelper::GetType(Uri &uri)
 
             type = dataAbilityProxy->GetType(uri);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::GetType failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -453,7 +454,7 @@ bool DataAbilityHelper::Reload(Uri &uri, const PacMap &extras)
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::Reload failed dataAbility == nullptr");
                 return ret;
@@ -461,7 +462,7 @@ bool DataAbilityHelper::Reload(Uri &uri, const PacMap &extras)
 
             ret = dataAbilityProxy->Reload(uri, extras);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::Reload failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -488,7 +489,7 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<ValuesBucket> &va
     if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
         if (uri.GetScheme() == SchemeOhos) {
             sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
-                AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind_, token_);
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
             if (dataAbilityProxy == nullptr) {
                 APP_LOGE("DataAbilityHelper::BatchInsert​ failed dataAbility == nullptr");
                 return ret;
@@ -496,7 +497,7 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<ValuesBucket> &va
 
             ret = dataAbilityProxy->BatchInsert(uri, values);
 
-            int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(dataAbilityProxy, token_);
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
             if (err != ERR_OK) {
                 APP_LOGE("AbilityThread::BatchInsert​ failed to ReleaseDataAbility err = %{public}d", err);
             }
@@ -508,5 +509,42 @@ int DataAbilityHelper::BatchInsert(Uri &uri, const std::vector<ValuesBucket> &va
     }
     return ret;
 }
+
+/**
+ * @brief Performs a batch of operations on the data ability in one call, an operation may reference the results
+ * of the operations before it.
+ *
+ * @param uri Indicates the path of the data ability to operate.
+ * @param operations Indicates the operations to perform, in order.
+ *
+ * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+ */
+std::vector<std::shared_ptr<DataAbilityResult>> DataAbilityHelper::ExecuteBatch(
+    Uri &uri, const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    std::vector<std::shared_ptr<DataAbilityResult>> results;
+    if ((uri_ == nullptr) || (!uri_->Equals(uri))) {
+        if (uri.GetScheme() == SchemeOhos) {
+            sptr<AAFwk::IAbilityScheduler> dataAbilityProxy =
+                DataAbilityProxyCache::GetInstance()->Acquire(uri, tryBind_, token_);
+            if (dataAbilityProxy == nullptr) {
+                APP_LOGE("DataAbilityHelper::ExecuteBatch failed dataAbility == nullptr");
+                return results;
+            }
+
+            results = dataAbilityProxy->ExecuteBatch(operations);
+
+            int err = DataAbilityProxyCache::GetInstance()->Release(uri, tryBind_, token_, dataAbilityProxy);
+            if (err != ERR_OK) {
+                APP_LOGE("DataAbilityHelper::ExecuteBatch failed to ReleaseDataAbility err = %{public}d", err);
+            }
+        }
+    } else {
+        if (dataAbilityProxy_ != nullptr) {
+            results = dataAbilityProxy_->ExecuteBatch(operations);
+        }
+    }
+    return results;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -266,5 +266,25 @@ int DataAbilityImpl::BatchInsert(const Uri &uri, const std::vector<ValuesBucket>
     ret = ability_->BatchInsert(uri, values);
     return ret;
 }
+
+/**
+ * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+ * of the operations before it.
+ *
+ * @param operations Indicates the operations to perform, in order.
+ *
+ * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+ */
+std::vector<std::shared_ptr<DataAbilityResult>> DataAbilityImpl::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    std::vector<std::shared_ptr<DataAbilityResult>> results;
+    if (ability_ == nullptr) {
+        APP_LOGE("DataAbilityImpl::ExecuteBatch ability_ is nullptr");
+        return results;
+    }
+    results = ability_->ExecuteBatch(operations);
+    return results;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
@@ -43,16 +43,11 @@ DataAbilityOperation::DataAbilityOperation(
 }
 DataAbilityOperation::DataAbilityOperation(Parcel &in)
 {
-    type_ = in.ReadInt32();
-    uri_ = (in.ReadInt32() != VALUE_NULL) ? std::shared_ptr<Uri>(Uri::Unmarshalling(in)) : nullptr;
-    valuesBucket_ = (in.ReadInt32() != VALUE_NULL) ? std::make_shared<ValuesBucket>(in) : nullptr;
-    int empty = in.ReadInt32();
-    expectedCount_ = (empty != VALUE_NULL) ? empty : 0;
-    dataAbilityPredicates_ = (in.ReadInt32() != VALUE_NULL) ? std::make_shared<DataAbilityPredicates>(in) : nullptr;
-    valuesBucketReferences_ = (in.ReadInt32() != VALUE_NULL) ? std::make_shared<ValuesBucket>(in) : nullptr;
-    dataAbilityPredicatesBackReferences_.clear();
-    PutMap(in);
-    interrupted_ = in.ReadBool();
+    type_ = 0;
+    uri_ = nullptr;
+    expectedCount_ = 0;
+    interrupted_ = false;
+    ReadFromParcel(in);
 }
 DataAbilityOperation::DataAbilityOperation(const std::shared_ptr<DataAbilityOperationBuilder> &builder)
 {
@@ -360,48 +355,61 @@ bool DataAbilityOperation::ReadFromParcel(Parcel &in)
     if (!in.ReadInt32(type_)) {
         return false;
     }
-    int empty;
-    if (in.ReadInt32(empty)) {
+    int empty = VALUE_NULL;
+    if (!in.ReadInt32(empty)) {
         return false;
     }
-    uri_ = (empty == VALUE_OBJECT) ? std::shared_ptr<Uri>(Uri::Unmarshalling(in)) : nullptr;
+    uri_ = (empty == VALUE_OBJECT) ? std::shared_ptr<Uri>(in.ReadParcelable<Uri>()) : nullptr;
 
     empty = VALUE_NULL;
-    if (in.ReadInt32(empty)) {
+    if (!in.ReadInt32(empty)) {
         return false;
     }
-    valuesBucket_ = (empty == VALUE_OBJECT) ? std::make_shared<ValuesBucket>(in) : nullptr;
+    valuesBucket_ = (empty == VALUE_OBJECT) ? std::shared_ptr<ValuesBucket>(ValuesBucket::Unmarshalling(in)) : nullptr;
 
     empty = VALUE_NULL;
-    if (in.ReadInt32(empty)) {
+    if (!in.ReadInt32(empty)) {
+        return false;
+    }
+    expectedCount_ = 0;
+    if (empty == VALUE_OBJECT && !in.ReadInt32(expectedCount_)) {
         return false;
     }
-    expectedCount_ = (empty == VALUE_OBJECT) ? empty : 0;
 
     empty = VALUE_NULL;
-    if (in.ReadInt32(empty)) {
+    if (!in.ReadInt32(empty)) {
         return false;
     }
-    dataAbilityPredicates_ = (empty == VALUE_OBJECT) ? std::make_shared<DataAbilityPredicates>(in) : nullptr;
+    dataAbilityPredicates_ = (empty == VALUE_OBJECT) ?
+        std::shared_ptr<DataAbilityPredicates>(DataAbilityPredicates::Unmarshalling(in)) : nullptr;
 
     empty = VALUE_NULL;
-    if (in.ReadInt32(empty)) {
+    if (!in.ReadInt32(empty)) {
         return false;
     }
-    valuesBucketReferences_ = (empty == VALUE_OBJECT) ? std::make_shared<ValuesBucket>(in) : nullptr;
+    valuesBucketReferences_ =
+        (empty == VALUE_OBJECT) ? std::shared_ptr<ValuesBucket>(ValuesBucket::Unmarshalling(in)) : nullptr;
 
     empty = VALUE_NULL;
-    if (in.ReadInt32(empty)) {
+    if (!in.ReadInt32(empty)) {
         return false;
     }
+    dataAbilityPredicatesBackReferences_.clear();
     if (empty == VALUE_OBJECT) {
-        if (empty > 0 && empty < REFERENCE_THRESHOLD) {
-            for (int i = 0; i < empty; ++i) {
-                dataAbilityPredicatesBackReferences_.insert(std::make_pair(in.ReadInt32(), in.ReadInt32()));
-            }
+        int referenceSize = 0;
+        if (!in.ReadInt32(referenceSize)) {
+            return false;
+        }
+        // Marshalling skips the references which are too many, see Marshalling.
+        if (referenceSize >= REFERENCE_THRESHOLD) {
+            interrupted_ = in.ReadBool();
+            return true;
+        }
+        for (int i = 0; i < referenceSize; ++i) {
+            int key = in.ReadInt32();
+            int value = in.ReadInt32();
+            dataAbilityPredicatesBackReferences_.insert(std::make_pair(key, value));
         }
-    } else {
-        dataAbilityPredicatesBackReferences_.clear();
     }
     interrupted_ = in.ReadBool();
     APP_LOGD("DataAbilityOperation::ReadFromParcel end");
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_ability_proxy_cache.h"
+
+#include <vector>
+
+#include "ability_manager_client.h"
+#include "ability_scheduler_stub.h"
+#include "app_log_wrapper.h"
+#include "task_handler_client.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using IAbilityScheduler = OHOS::AAFwk::IAbilityScheduler;
+using AbilityManagerClient = OHOS::AAFwk::AbilityManagerClient;
+
+namespace {
+constexpr long DEFAULT_IDLE_TIMEOUT = 5000;  // ms
+}  // namespace
+
+std::mutex DataAbilityProxyCache::instanceMutex_;
+std::shared_ptr<DataAbilityProxyCache> DataAbilityProxyCache::instance_ = nullptr;
+
+std::shared_ptr<DataAbilityProxyCache> DataAbilityProxyCache::GetInstance()
+{
+    if (instance_ == nullptr) {
+        std::lock_guard<std::mutex> lock_l(instanceMutex_);
+        if (instance_ == nullptr) {
+            instance_ = std::make_shared<DataAbilityProxyCache>();
+        }
+    }
+    return instance_;
+}
+
+DataAbilityProxyCache::DataAbilityProxyCache() : idleTimeout_(DEFAULT_IDLE_TIMEOUT)
+{}
+
+DataAbilityProxyCache::~DataAbilityProxyCache()
+{}
+
+DataAbilityProxyCache::CacheKey DataAbilityProxyCache::MakeKey(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    return CacheKey(const_cast<Uri &>(uri).GetAuthority(), callerToken.GetRefPtr(), tryBind);
+}
+
+sptr<IAbilityScheduler> DataAbilityProxyCache::Acquire(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    CacheKey key = MakeKey(uri, tryBind, callerToken);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            it->second.leaseCount++;
+            it->second.idleSerial++;
+            return it->second.proxy;
+        }
+    }
+
+    // Acquire the data ability without holding the cache lock, the ability manager may wait for its loading.
+    sptr<IAbilityScheduler> proxy = AbilityManagerClient::GetInstance()->AcquireDataAbility(uri, tryBind, callerToken);
+    if (proxy == nullptr) {
+        APP_LOGE("DataAbilityProxyCache::Acquire failed, dataAbilityProxy == nullptr");
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (idleTimeout_ <= 0) {
+        return proxy;
+    }
+
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        // Another thread has cached the same data ability meanwhile, return the extra one.
+        it->second.leaseCount++;
+        it->second.idleSerial++;
+        sptr<IAbilityScheduler> cachedProxy = it->second.proxy;
+        lock.unlock();
+        AbilityManagerClient::GetInstance()->ReleaseDataAbility(proxy, callerToken);
+        return cachedProxy;
+    }
+
+    CacheEntry entry;
+    entry.proxy = proxy;
+    entry.callerToken = callerToken;
+    entry.leaseCount = 1;
+    auto remote = proxy->AsObject();
+    if (remote != nullptr) {
+        std::weak_ptr<DataAbilityProxyCache> weak = shared_from_this();
+        entry.deathRecipient = new (std::nothrow) AAFwk::AbilitySchedulerRecipient([weak](
+            const wptr<IRemoteObject> &died) {
+            auto cache = weak.lock();
+            if (cache != nullptr) {
+                cache->OnProxyDied(died);
+            }
+        });
+        if (entry.deathRecipient != nullptr) {
+            remote->AddDeathRecipient(entry.deathRecipient);
+        }
+    }
+    entries_.emplace(key, entry);
+    return proxy;
+}
+
+int DataAbilityProxyCache::Release(
+    const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken, const sptr<IAbilityScheduler> &proxy)
+{
+    if (proxy == nullptr) {
+        APP_LOGE("DataAbilityProxyCache::Release failed, proxy == nullptr");
+        return ERR_INVALID_VALUE;
+    }
+
+    CacheKey key = MakeKey(uri, tryBind, callerToken);
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.proxy != proxy) {
+        // Not cached or replaced after the death of the data ability, release it directly.
+        lock.unlock();
+        return AbilityManagerClient::GetInstance()->ReleaseDataAbility(proxy, callerToken);
+    }
+
+    auto &entry = it->second;
+    if (entry.leaseCount > 0) {
+        entry.leaseCount--;
+    }
+    if (entry.leaseCount == 0) {
+        entry.idleSerial++;
+        ScheduleIdleRelease(key, entry.idleSerial);
+    }
+    return ERR_OK;
+}
+
+void DataAbilityProxyCache::ScheduleIdleRelease(const CacheKey &key, uint64_t idleSerial)
+{
+    std::weak_ptr<DataAbilityProxyCache> weak = shared_from_this();
+    auto task = [weak, key, idleSerial]() {
+        auto cache = weak.lock();
+        if (cache != nullptr) {
+            cache->OnIdleTimeout(key, idleSerial);
+        }
+    };
+    if (!TaskHandlerClient::GetInstance()->PostTask(task, idleTimeout_)) {
+        APP_LOGE("DataAbilityProxyCache::ScheduleIdleRelease failed to post idle task");
+    }
+}
+
+void DataAbilityProxyCache::OnIdleTimeout(const CacheKey &key, uint64_t idleSerial)
+{
+    CacheEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        // The entry has been leased again since the task was posted.
+        if (it == entries_.end() || it->second.leaseCount > 0 || it->second.idleSerial != idleSerial) {
+            return;
+        }
+        entry = it->second;
+        entries_.erase(it);
+    }
+    ReleaseEntry(entry, true);
+}
+
+void DataAbilityProxyCache::OnProxyDied(const wptr<IRemoteObject> &remote)
+{
+    APP_LOGI("DataAbilityProxyCache::OnProxyDied, remove the died data ability");
+    std::vector<CacheEntry> diedEntries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            auto object = it->second.proxy->AsObject();
+            if (object != nullptr && object.GetRefPtr() == remote.GetRefPtr()) {
+                diedEntries.emplace_back(it->second);
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (auto &entry : diedEntries) {
+        ReleaseEntry(entry, false);
+    }
+}
+
+void DataAbilityProxyCache::ReleaseEntry(const CacheEntry &entry, bool needRelease)
+{
+    auto remote = entry.proxy->AsObject();
+    if (remote != nullptr && entry.deathRecipient != nullptr) {
+        remote->RemoveDeathRecipient(entry.deathRecipient);
+    }
+    // The ability manager cleans up the clients of a died data ability by itself.
+    if (!needRelease) {
+        return;
+    }
+    int err = AbilityManagerClient::GetInstance()->ReleaseDataAbility(entry.proxy, entry.callerToken);
+    if (err != ERR_OK) {
+        APP_LOGE("DataAbilityProxyCache::ReleaseEntry failed to ReleaseDataAbility err = %{public}d", err);
+    }
+}
+
+void DataAbilityProxyCache::SetIdleTimeout(long idleTimeout)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    idleTimeout_ = idleTimeout;
+}
+
+long DataAbilityProxyCache::GetIdleTimeout()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idleTimeout_;
+}
+
+int DataAbilityProxyCache::GetLeaseCount(const Uri &uri, bool tryBind, const sptr<IRemoteObject> &callerToken)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(MakeKey(uri, tryBind, callerToken));
+    return (it == entries_.end()) ? -1 : it->second.leaseCount;
+}
+
+size_t DataAbilityProxyCache::GetSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void DataAbilityProxyCache::ReleaseIdle()
+{
+    std::vector<CacheEntry> idleEntries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.leaseCount == 0) {
+                idleEntries.emplace_back(it->second);
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (auto &entry : idleEntries) {
+        ReleaseEntry(entry, true);
+    }
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
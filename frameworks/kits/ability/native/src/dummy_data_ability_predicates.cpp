@@ -31,6 +31,10 @@ DataAbilityPredicates::DataAbilityPredicates(const std::string &testInf) : testI
 bool DataAbilityPredicates::ReadFromParcel(Parcel &parcel)
 {
     testInf_ = Str16ToStr8(parcel.ReadString16());
+    if (!parcel.ReadStringVector(&whereArgs_)) {
+        APP_LOGE("DataAbilityPredicates::ReadFromParcel ReadStringVector failed");
+        return false;
+    }
     return true;
 }
 
@@ -61,7 +65,21 @@ bool DataAbilityPredicates::Marshalling(Parcel &parcel) const
         APP_LOGE("dataAbilityPredicates::Marshalling WriteString16 failed");
         return false;
     }
+    if (!parcel.WriteStringVector(whereArgs_)) {
+        APP_LOGE("dataAbilityPredicates::Marshalling WriteStringVector failed");
+        return false;
+    }
     return true;
 }
+
+void DataAbilityPredicates::SetWhereArgs(const std::vector<std::string> &whereArgs)
+{
+    whereArgs_ = whereArgs;
+}
+
+std::vector<std::string> DataAbilityPredicates::GetWhereArgs() const
+{
+    return whereArgs_;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -22,6 +22,9 @@ namespace AppExecFwk {
 ResultSet::ResultSet(const std::string &testInf) : testInf_(testInf)
 {}
 
+ResultSet::ResultSet(const std::vector<std::string> &columnNames) : columnNames_(columnNames)
+{}
+
 /**
  * @brief read this Sequenceable object from a Parcel.
  *
@@ -31,6 +34,19 @@ ResultSet::ResultSet(const std::string &testInf) : testInf_(testInf)
 bool ResultSet::ReadFromParcel(Parcel &parcel)
 {
     testInf_ = Str16ToStr8(parcel.ReadString16());
+    if (!parcel.ReadStringVector(&columnNames_) || !parcel.ReadStringVector(&values_)) {
+        APP_LOGE("ResultSet::ReadFromParcel ReadStringVector failed");
+        return false;
+    }
+    if (columnNames_.empty() ? !values_.empty() : values_.size() % columnNames_.size() != 0) {
+        APP_LOGE("ResultSet::ReadFromParcel the values do not match the columns");
+        return false;
+    }
+    dataSize_ = 0;
+    for (const auto &value : values_) {
+        dataSize_ += value.size();
+    }
+    rowPos_ = -1;
     return true;
 }
 
@@ -61,7 +77,86 @@ bool ResultSet::Marshalling(Parcel &parcel) const
         APP_LOGE("ResultSet::Marshalling WriteString16 failed");
         return false;
     }
+    if (!parcel.WriteStringVector(columnNames_) || !parcel.WriteStringVector(values_)) {
+        APP_LOGE("ResultSet::Marshalling WriteStringVector failed");
+        return false;
+    }
+    return true;
+}
+
+bool ResultSet::AddRow(const std::vector<std::string> &row)
+{
+    if (row.empty() || row.size() != columnNames_.size()) {
+        APP_LOGE("ResultSet::AddRow the row has %{public}zu values of %{public}zu columns",
+            row.size(), columnNames_.size());
+        return false;
+    }
+    values_.insert(values_.end(), row.begin(), row.end());
+    for (const auto &value : row) {
+        dataSize_ += value.size();
+    }
+    return true;
+}
+
+const std::vector<std::string> &ResultSet::GetAllColumnNames() const
+{
+    return columnNames_;
+}
+
+int ResultSet::GetColumnCount() const
+{
+    return static_cast<int>(columnNames_.size());
+}
+
+int ResultSet::GetRowCount()
+{
+    return columnNames_.empty() ? 0 : static_cast<int>(values_.size() / columnNames_.size());
+}
+
+bool ResultSet::GoToRow(int position)
+{
+    if (position < 0 || position >= GetRowCount()) {
+        return false;
+    }
+    rowPos_ = position;
+    return true;
+}
+
+bool ResultSet::GoToFirstRow()
+{
+    return GoToRow(0);
+}
+
+bool ResultSet::GoToNextRow()
+{
+    return GoToRow(rowPos_ + 1);
+}
+
+int ResultSet::GetRowIndex() const
+{
+    return rowPos_;
+}
+
+bool ResultSet::GetString(int columnIndex, std::string &value)
+{
+    if (rowPos_ < 0 || rowPos_ >= GetRowCount() || columnIndex < 0 || columnIndex >= GetColumnCount()) {
+        return false;
+    }
+    value = values_[static_cast<size_t>(rowPos_) * columnNames_.size() + columnIndex];
     return true;
 }
+
+size_t ResultSet::GetDataSize()
+{
+    return dataSize_;
+}
+
+void ResultSet::Close()
+{
+    values_.clear();
+    values_.shrink_to_fit();
+    dataSize_ = 0;
+    rowPos_ = -1;
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
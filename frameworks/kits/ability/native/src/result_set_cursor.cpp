@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "result_set_cursor.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "app_log_wrapper.h"
+#include "ipc_types.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+const char *RESULT_SET_WINDOW_NAME = "result_set_window";
+}  // namespace
+
+int32_t ResultSetCursorProxy::FillWindow(int32_t startRow, int32_t &windowId, sptr<Ashmem> &memory)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ResultSetCursorProxy::GetDescriptor())) {
+        APP_LOGE("ResultSetCursorProxy::FillWindow write interface token failed");
+        return 0;
+    }
+    if (!data.WriteInt32(startRow) || !data.WriteInt32(windowId)) {
+        APP_LOGE("ResultSetCursorProxy::FillWindow WriteInt32 failed");
+        return 0;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        APP_LOGE("ResultSetCursorProxy::FillWindow remote is nullptr");
+        return 0;
+    }
+    int32_t err = remote->SendRequest(IResultSetCursor::FILL_WINDOW, data, reply, option);
+    if (err != NO_ERROR) {
+        APP_LOGE("ResultSetCursorProxy::FillWindow SendRequest failed, err: %{public}d", err);
+        return 0;
+    }
+    int32_t rowCount = reply.ReadInt32();
+    windowId = reply.ReadInt32();
+    memory = nullptr;
+    if (rowCount > 0 && reply.ReadBool()) {
+        memory = reply.ReadAshmem();
+        if (memory == nullptr) {
+            APP_LOGE("ResultSetCursorProxy::FillWindow ReadAshmem failed");
+            return 0;
+        }
+    }
+    return rowCount;
+}
+
+void ResultSetCursorProxy::ReleaseWindow(int32_t windowId)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!data.WriteInterfaceToken(ResultSetCursorProxy::GetDescriptor()) || !data.WriteInt32(windowId)) {
+        APP_LOGE("ResultSetCursorProxy::ReleaseWindow write data failed");
+        return;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        APP_LOGE("ResultSetCursorProxy::ReleaseWindow remote is nullptr");
+        return;
+    }
+    int32_t err = remote->SendRequest(IResultSetCursor::RELEASE_WINDOW, data, reply, option);
+    if (err != NO_ERROR) {
+        APP_LOGE("ResultSetCursorProxy::ReleaseWindow SendRequest failed, err: %{public}d", err);
+    }
+}
+
+void ResultSetCursorProxy::Close()
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!data.WriteInterfaceToken(ResultSetCursorProxy::GetDescriptor())) {
+        APP_LOGE("ResultSetCursorProxy::Close write interface token failed");
+        return;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        APP_LOGE("ResultSetCursorProxy::Close remote is nullptr");
+        return;
+    }
+    int32_t err = remote->SendRequest(IResultSetCursor::CLOSE, data, reply, option);
+    if (err != NO_ERROR) {
+        APP_LOGE("ResultSetCursorProxy::Close SendRequest failed, err: %{public}d", err);
+    }
+}
+
+ResultSetCursorStub::ResultSetCursorStub(const std::shared_ptr<ResultSet> &resultSet, size_t windowSize)
+    : windowSize_(windowSize), resultSet_(resultSet), window_(windowSize)
+{}
+
+ResultSetCursorStub::~ResultSetCursorStub()
+{
+    Close();
+}
+
+int ResultSetCursorStub::OnRemoteRequest(
+    uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
+{
+    if (data.ReadInterfaceToken() != ResultSetCursorStub::GetDescriptor()) {
+        APP_LOGE("ResultSetCursorStub::OnRemoteRequest local descriptor is not equal to remote");
+        return ERR_INVALID_STATE;
+    }
+    switch (code) {
+        case FILL_WINDOW:
+            return FillWindowInner(data, reply);
+        case CLOSE:
+            return CloseInner(data, reply);
+        case RELEASE_WINDOW:
+            return ReleaseWindowInner(data, reply);
+        default:
+            return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+    }
+}
+
+int ResultSetCursorStub::FillWindowInner(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t startRow = data.ReadInt32();
+    int32_t windowId = data.ReadInt32();
+    sptr<Ashmem> memory;
+    int32_t rowCount = FillWindow(startRow, windowId, memory);
+    if (!reply.WriteInt32(rowCount) || !reply.WriteInt32(windowId)) {
+        APP_LOGE("ResultSetCursorStub::FillWindowInner WriteInt32 failed");
+        return ERR_INVALID_VALUE;
+    }
+    if (rowCount > 0) {
+        if (!reply.WriteBool(memory != nullptr) || (memory != nullptr && !reply.WriteAshmem(memory))) {
+            APP_LOGE("ResultSetCursorStub::FillWindowInner WriteAshmem failed");
+            return ERR_INVALID_VALUE;
+        }
+    }
+    return NO_ERROR;
+}
+
+int ResultSetCursorStub::CloseInner(MessageParcel &data, MessageParcel &reply)
+{
+    Close();
+    return NO_ERROR;
+}
+
+int ResultSetCursorStub::ReleaseWindowInner(MessageParcel &data, MessageParcel &reply)
+{
+    ReleaseWindow(data.ReadInt32());
+    return NO_ERROR;
+}
+
+int32_t ResultSetCursorStub::FillWindow(int32_t startRow, int32_t &windowId, sptr<Ashmem> &memory)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    memory = nullptr;
+    if (resultSet_ == nullptr) {
+        APP_LOGE("ResultSetCursorStub::FillWindow the cursor is closed");
+        return 0;
+    }
+    bool created = windowId < 0;
+    if (created) {
+        windowId = AllocateWindowIdLocked();
+        if (windowId < 0) {
+            APP_LOGE("ResultSetCursorStub::FillWindow too many windows");
+            return 0;
+        }
+    } else if (static_cast<size_t>(windowId) >= windows_.size() || windows_[windowId] == nullptr) {
+        APP_LOGE("ResultSetCursorStub::FillWindow no window %{public}d", windowId);
+        return 0;
+    }
+
+    uint32_t rowCount = window_.Fill(*resultSet_, startRow);
+    size_t size = std::max(windowSize_, window_.GetSize());
+    sptr<Ashmem> target = windows_[windowId];
+    if (rowCount > 0 && size <= static_cast<size_t>(std::numeric_limits<int32_t>::max()) &&
+        (target == nullptr || static_cast<size_t>(target->GetAshmemSize()) != size)) {
+        // a row larger than a window gets a memory of its own size, the window gets its usual memory back with
+        // the next fill. the client maps the memory sent to it in place of the old one.
+        target = Ashmem::CreateAshmem(RESULT_SET_WINDOW_NAME, static_cast<int32_t>(size));
+        if (target == nullptr || !target->MapReadAndWriteAshmem()) {
+            APP_LOGE("ResultSetCursorStub::FillWindow failed to create the window memory, size: %{public}zu", size);
+            target = nullptr;
+        }
+        memory = target;
+    }
+    if (rowCount == 0 || target == nullptr || !WriteWindowLocked(target)) {
+        memory = nullptr;
+        if (created) {
+            // the client never gets the new window.
+            ReleaseWindowLocked(windowId);
+        }
+        return 0;
+    }
+    windows_[windowId] = target;
+    return static_cast<int32_t>(rowCount);
+}
+
+void ResultSetCursorStub::ReleaseWindow(int32_t windowId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    ReleaseWindowLocked(windowId);
+}
+
+int32_t ResultSetCursorStub::AllocateWindowIdLocked()
+{
+    auto isReleased = [](const sptr<Ashmem> &window) { return window == nullptr; };
+    auto iter = std::find_if(windows_.begin(), windows_.end(), isReleased);
+    size_t count = windows_.size() - static_cast<size_t>(std::count_if(windows_.begin(), windows_.end(), isReleased));
+    if (count >= static_cast<size_t>(MAX_WINDOW_COUNT)) {
+        return -1;
+    }
+    if (iter != windows_.end()) {
+        return static_cast<int32_t>(iter - windows_.begin());
+    }
+    windows_.emplace_back(nullptr);
+    return static_cast<int32_t>(windows_.size()) - 1;
+}
+
+void ResultSetCursorStub::ReleaseWindowLocked(int32_t windowId)
+{
+    if (windowId < 0 || static_cast<size_t>(windowId) >= windows_.size()) {
+        return;
+    }
+    windows_[windowId] = nullptr;
+    while (!windows_.empty() && windows_.back() == nullptr) {
+        windows_.pop_back();
+    }
+}
+
+bool ResultSetCursorStub::WriteWindowLocked(const sptr<Ashmem> &target)
+{
+    const auto &header = window_.GetHeader();
+    const auto &slots = window_.GetSlots();
+    if (!target->WriteToAshmem(&header, sizeof(header), 0) ||
+        !target->WriteToAshmem(slots.data(), static_cast<int32_t>(slots.size() * sizeof(slots[0])), sizeof(header)) ||
+        !target->WriteToAshmem(window_.GetData().data(), static_cast<int32_t>(header.dataSize), header.dataOffset)) {
+        APP_LOGE("ResultSetCursorStub::WriteWindowLocked failed to write the window");
+        return false;
+    }
+    return true;
+}
+
+void ResultSetCursorStub::Close()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    resultSet_ = nullptr;
+    windows_.clear();
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
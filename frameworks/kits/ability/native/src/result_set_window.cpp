@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "result_set_window.h"
+
+#include <cstring>
+
+#include "app_log_wrapper.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+ResultSetWindow::ResultSetWindow(size_t windowSize) : windowSize_(windowSize)
+{}
+
+uint32_t ResultSetWindow::Fill(ResultSet &resultSet, int32_t startRow)
+{
+    header_ = Header();
+    header_.startRow = startRow;
+    header_.columnCount = static_cast<uint32_t>(resultSet.GetColumnCount());
+    slots_.clear();
+    data_.clear();
+    if (header_.columnCount == 0 || !resultSet.GoToRow(startRow)) {
+        return 0;
+    }
+
+    std::string value;
+    do {
+        size_t slotCount = slots_.size();
+        size_t dataSize = data_.size();
+        for (uint32_t column = 0; column < header_.columnCount; column++) {
+            if (!resultSet.GetString(static_cast<int>(column), value)) {
+                value.clear();
+            }
+            slots_.push_back({static_cast<uint32_t>(data_.size()), static_cast<uint32_t>(value.size())});
+            data_.append(value);
+        }
+        if (header_.rowCount > 0 && sizeof(Header) + slots_.size() * sizeof(Slot) + data_.size() > windowSize_) {
+            // the row goes to the next window.
+            slots_.resize(slotCount);
+            data_.resize(dataSize);
+            break;
+        }
+        header_.rowCount++;
+    } while (resultSet.GoToNextRow());
+
+    header_.dataOffset = static_cast<uint32_t>(sizeof(Header) + slots_.size() * sizeof(Slot));
+    header_.dataSize = static_cast<uint32_t>(data_.size());
+    return header_.rowCount;
+}
+
+size_t ResultSetWindow::GetSize() const
+{
+    return static_cast<size_t>(header_.dataOffset) + header_.dataSize;
+}
+
+const ResultSetWindow::Header &ResultSetWindow::GetHeader() const
+{
+    return header_;
+}
+
+const std::vector<ResultSetWindow::Slot> &ResultSetWindow::GetSlots() const
+{
+    return slots_;
+}
+
+const std::string &ResultSetWindow::GetData() const
+{
+    return data_;
+}
+
+bool ResultSetWindow::ReadHeader(const uint8_t *memory, size_t size, Header &header)
+{
+    if (memory == nullptr || size < sizeof(Header)) {
+        return false;
+    }
+    memcpy(&header, memory, sizeof(Header));
+    uint64_t slotsEnd = sizeof(Header) + static_cast<uint64_t>(header.rowCount) * header.columnCount * sizeof(Slot);
+    return header.startRow >= 0 && header.columnCount != 0 && slotsEnd <= header.dataOffset &&
+           static_cast<uint64_t>(header.dataOffset) + header.dataSize <= size;
+}
+
+bool ResultSetWindow::ReadString(
+    const uint8_t *memory, const Header &header, uint32_t row, uint32_t column, std::string &value)
+{
+    if (row >= header.rowCount || column >= header.columnCount) {
+        return false;
+    }
+    Slot slot;
+    memcpy(&slot, memory + sizeof(Header) + (static_cast<size_t>(row) * header.columnCount + column) * sizeof(Slot),
+        sizeof(Slot));
+    if (static_cast<uint64_t>(slot.offset) + slot.length > header.dataSize) {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char *>(memory) + header.dataOffset + slot.offset, slot.length);
+    return true;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shared_result_set.h"
+
+#include <limits>
+
+#include "app_log_wrapper.h"
+#include "string_ex.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+SharedResultSet::SharedResultSet(
+    const std::vector<std::string> &columnNames, int rowCount, const sptr<IResultSetCursor> &cursor)
+    : ResultSet(columnNames), cursor_(cursor), rowCount_(rowCount)
+{}
+
+SharedResultSet::~SharedResultSet()
+{
+    Close();
+}
+
+bool SharedResultSet::WriteResultSet(MessageParcel &parcel, const std::shared_ptr<ResultSet> &resultSet)
+{
+    if (resultSet == nullptr) {
+        APP_LOGE("SharedResultSet::WriteResultSet resultSet is nullptr");
+        return false;
+    }
+    if (resultSet->GetDataSize() <= MAX_INLINE_DATA_SIZE) {
+        return parcel.WriteInt32(RESULT_SET_INLINE) && parcel.WriteParcelable(resultSet.get());
+    }
+
+    sptr<ResultSetCursorStub> cursor = new (std::nothrow) ResultSetCursorStub(resultSet);
+    if (cursor == nullptr) {
+        APP_LOGE("SharedResultSet::WriteResultSet failed to create the cursor");
+        return false;
+    }
+    if (!parcel.WriteInt32(RESULT_SET_CURSOR) || !parcel.WriteString16(Str8ToStr16(resultSet->testInf_)) ||
+        !parcel.WriteStringVector(resultSet->GetAllColumnNames()) || !parcel.WriteInt32(resultSet->GetRowCount()) ||
+        !parcel.WriteRemoteObject(cursor->AsObject())) {
+        APP_LOGE("SharedResultSet::WriteResultSet failed to write the cursor");
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<ResultSet> SharedResultSet::ReadResultSet(MessageParcel &parcel)
+{
+    int32_t type = parcel.ReadInt32();
+    if (type == RESULT_SET_INLINE) {
+        ResultSet *resultSet = parcel.ReadParcelable<ResultSet>();
+        if (resultSet == nullptr) {
+            APP_LOGE("SharedResultSet::ReadResultSet ReadParcelable failed");
+            return nullptr;
+        }
+        return std::shared_ptr<ResultSet>(resultSet);
+    }
+    if (type != RESULT_SET_CURSOR) {
+        APP_LOGE("SharedResultSet::ReadResultSet unknown type %{public}d", type);
+        return nullptr;
+    }
+
+    std::string testInf = Str16ToStr8(parcel.ReadString16());
+    std::vector<std::string> columnNames;
+    if (!parcel.ReadStringVector(&columnNames) || columnNames.empty()) {
+        APP_LOGE("SharedResultSet::ReadResultSet ReadStringVector failed");
+        return nullptr;
+    }
+    int32_t rowCount = parcel.ReadInt32();
+    sptr<IRemoteObject> remote = parcel.ReadRemoteObject();
+    sptr<IResultSetCursor> cursor = iface_cast<IResultSetCursor>(remote);
+    if (rowCount < 0 || cursor == nullptr) {
+        APP_LOGE("SharedResultSet::ReadResultSet failed to read the cursor");
+        return nullptr;
+    }
+    auto resultSet = std::make_shared<SharedResultSet>(columnNames, rowCount, cursor);
+    resultSet->testInf_ = testInf;
+    return resultSet;
+}
+
+int SharedResultSet::GetRowCount()
+{
+    return rowCount_;
+}
+
+bool SharedResultSet::GoToRow(int position)
+{
+    if (position < 0 || position >= rowCount_) {
+        return false;
+    }
+    for (size_t i = 0; i < windows_.size(); i++) {
+        size_t index = (current_ + i) % windows_.size();
+        const auto &header = windows_[index].header;
+        if (position >= header.startRow && position - header.startRow < static_cast<int>(header.rowCount)) {
+            current_ = index;
+            windows_[index].lastUse = ++useClock_;
+            rowPos_ = position;
+            return true;
+        }
+    }
+    if (!FetchWindow(position)) {
+        return false;
+    }
+    rowPos_ = position;
+    return true;
+}
+
+bool SharedResultSet::FetchWindow(int position)
+{
+    if (cursor_ == nullptr) {
+        APP_LOGE("SharedResultSet::FetchWindow the result set is closed");
+        return false;
+    }
+    // refill the least recently used window once there are enough windows.
+    size_t index = windows_.size();
+    if (windows_.size() >= static_cast<size_t>(ResultSetCursorStub::MAX_WINDOW_COUNT)) {
+        index = 0;
+        for (size_t i = 1; i < windows_.size(); i++) {
+            if (windows_[i].lastUse < windows_[index].lastUse) {
+                index = i;
+            }
+        }
+    }
+    int32_t windowId = index < windows_.size() ? windows_[index].id : -1;
+    sptr<Ashmem> memory;
+    int32_t rowCount = cursor_->FillWindow(position, windowId, memory);
+    if (rowCount <= 0) {
+        APP_LOGE("SharedResultSet::FetchWindow failed to fill row %{public}d", position);
+        return false;
+    }
+
+    // a new window, or a window whose rows did not fit in its memory, comes with its memory.
+    if (memory != nullptr) {
+        ClientWindow window;
+        window.id = windowId;
+        window.memory = memory;
+        if (memory->MapReadOnlyAshmem()) {
+            window.data = static_cast<const uint8_t *>(memory->ReadFromAshmem(memory->GetAshmemSize(), 0));
+        }
+        if (index == windows_.size()) {
+            windows_.emplace_back(std::move(window));
+        } else {
+            windows_[index] = std::move(window);
+        }
+    } else if (index == windows_.size()) {
+        APP_LOGE("SharedResultSet::FetchWindow no memory of the new window %{public}d", windowId);
+        cursor_->ReleaseWindow(windowId);
+        return false;
+    }
+    auto &window = windows_[index];
+    if (window.data == nullptr ||
+        !ResultSetWindow::ReadHeader(window.data, static_cast<size_t>(window.memory->GetAshmemSize()), window.header) ||
+        window.header.startRow != position || window.header.rowCount == 0 ||
+        window.header.columnCount != columnNames_.size()) {
+        APP_LOGE("SharedResultSet::FetchWindow the window of row %{public}d is malformed", position);
+        // the provider keeps the window until it is released, so that its id can be given to a new window.
+        cursor_->ReleaseWindow(window.id);
+        windows_.erase(windows_.begin() + index);
+        current_ = 0;
+        return false;
+    }
+    window.lastUse = ++useClock_;
+    current_ = index;
+    return true;
+}
+
+bool SharedResultSet::GetString(int columnIndex, std::string &value)
+{
+    if (rowPos_ < 0 || current_ >= windows_.size() || columnIndex < 0) {
+        return false;
+    }
+    const auto &window = windows_[current_];
+    return ResultSetWindow::ReadString(window.data, window.header,
+        static_cast<uint32_t>(rowPos_ - window.header.startRow), static_cast<uint32_t>(columnIndex), value);
+}
+
+size_t SharedResultSet::GetDataSize()
+{
+    // the rows are not in this process, the result set is always passed on through a cursor.
+    return std::numeric_limits<size_t>::max();
+}
+
+void SharedResultSet::Close()
+{
+    if (cursor_ != nullptr) {
+        cursor_->Close();
+        cursor_ = nullptr;
+    }
+    windows_.clear();
+    current_ = 0;
+    rowCount_ = 0;
+    rowPos_ = -1;
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
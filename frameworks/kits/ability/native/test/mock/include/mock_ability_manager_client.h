@@ -121,6 +121,17 @@ public:
         return BATCHINSERTNUM;
     }
 
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+    {
+        GTEST_LOG_(INFO) << "MockAbilityThread::ExecuteBatch called";
+        std::vector<std::shared_ptr<DataAbilityResult>> results;
+        for (size_t i = 0; i < operations.size(); i++) {
+            results.emplace_back(std::make_shared<DataAbilityResult>(1));
+        }
+        return results;
+    }
+
     std::shared_ptr<ResultSet> Query(
         const Uri &uri, std::vector<std::string> &columns, const DataAbilityPredicates &predicates)
     {
@@ -39,6 +39,11 @@ public:
     {
         return 0;
     }
+    int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override
+    {
+        return 0;
+    }
     int TerminateAbility(
         const sptr<IRemoteObject> &token, int resultCode = -1, const Want *resultWant = nullptr) override;
     int ConnectAbility(
@@ -120,6 +125,11 @@ public:
         return 0;
     }
 
+    int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+    {
+        return 0;
+    }
+
     int MoveMissionToTop(int32_t missionId) override;
 
     int KillProcess(const std::string &bundleName) override;
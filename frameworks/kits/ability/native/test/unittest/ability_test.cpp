@@ -21,6 +21,7 @@
 #include "ability_info.h"
 #include "ability_start_setting.h"
 #include "context_deal.h"
+#include "data_uri_utils.h"
 #include "mock_page_ability.h"
 
 namespace OHOS {
@@ -30,6 +31,68 @@ using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 using OHOS::Parcel;
 
+class BatchDataAbility : public Ability {
+public:
+    int Insert(const Uri &uri, const ValuesBucket &value) override
+    {
+        return ++lastId_;
+    }
+
+    int Delete(const Uri &uri, const DataAbilityPredicates &predicates) override
+    {
+        deleteWhereArgs_ = predicates.GetWhereArgs();
+        return 1;
+    }
+
+    std::shared_ptr<ResultSet> Query(
+        const Uri &uri, const std::vector<std::string> &columns, const DataAbilityPredicates &predicates) override
+    {
+        auto resultSet = std::make_shared<ResultSet>(std::vector<std::string>{"id"});
+        for (int id = 1; id <= lastId_; id++) {
+            resultSet->AddRow({std::to_string(id)});
+        }
+        return resultSet;
+    }
+
+    bool OnBatchYield(size_t index) override
+    {
+        yields_.emplace_back(index);
+        return Ability::OnBatchYield(index);
+    }
+
+    int lastId_ = 0;
+    std::vector<std::string> deleteWhereArgs_;
+    std::vector<size_t> yields_;
+};
+
+class TransactionDataAbility : public BatchDataAbility {
+public:
+    bool BeginBatch() override
+    {
+        beginCount_++;
+        return true;
+    }
+
+    bool CommitBatch() override
+    {
+        commitCount_++;
+        committedId_ = lastId_;
+        return true;
+    }
+
+    bool RollbackBatch() override
+    {
+        rollbackCount_++;
+        lastId_ = committedId_;
+        return true;
+    }
+
+    int beginCount_ = 0;
+    int commitCount_ = 0;
+    int rollbackCount_ = 0;
+    int committedId_ = 0;
+};
+
 class AbilityBaseTest : public testing::Test {
 public:
     AbilityBaseTest() : ability_(nullptr)
@@ -847,5 +910,80 @@ HWTEST_F(AbilityBaseTest, AaFwk_Ability_PostTask_0100, Function | MediumTest | L
 
     GTEST_LOG_(INFO) << "AaFwk_Ability_PostTask_0100 end";
 }
+
+/**
+ * @tc.number: AaFwk_Ability_ExecuteBatch_0100
+ * @tc.name: ExecuteBatch
+ * @tc.desc: Test that ExecuteBatch resolves back references, yields before interruptible operations and stops at
+ *           the first failed operation.
+ */
+HWTEST_F(AbilityBaseTest, AaFwk_Ability_ExecuteBatch_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_Ability_ExecuteBatch_0100 start";
+
+    std::shared_ptr<BatchDataAbility> ability = std::make_shared<BatchDataAbility>();
+    std::shared_ptr<Uri> uri = std::make_shared<Uri>("dataability:///com.example.DataAbilityTest/person");
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+    operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->Build());
+    operations.emplace_back(DataAbilityOperation::NewDeleteBuilder(uri)
+                                ->WithPredicatesBackReference(0, 0)
+                                ->WithExpectedCount(1)
+                                ->WithInterruptionAllowed(true)
+                                ->Build());
+    // references an operation after itself, the batch stops here.
+    operations.emplace_back(DataAbilityOperation::NewDeleteBuilder(uri)->WithPredicatesBackReference(0, 3)->Build());
+    operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->Build());
+
+    std::vector<std::shared_ptr<DataAbilityResult>> results = ability->ExecuteBatch(operations);
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(DataUriUtils::GetId(results[0]->GetUri()), 1);
+    EXPECT_EQ(results[1]->GetCount(), 1);
+    ASSERT_EQ(ability->deleteWhereArgs_.size(), 1);
+    EXPECT_EQ(ability->deleteWhereArgs_[0], "1");
+    ASSERT_EQ(ability->yields_.size(), 1);
+    EXPECT_EQ(ability->yields_[0], 1);
+    EXPECT_EQ(ability->lastId_, 1);
+
+    GTEST_LOG_(INFO) << "AaFwk_Ability_ExecuteBatch_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_Ability_ExecuteBatch_0200
+ * @tc.name: ExecuteBatch
+ * @tc.desc: Test that a failed batch rolls back the operations after the last yield, and only the results of the
+ *           committed operations are returned.
+ */
+HWTEST_F(AbilityBaseTest, AaFwk_Ability_ExecuteBatch_0200, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_Ability_ExecuteBatch_0200 start";
+
+    std::shared_ptr<TransactionDataAbility> ability = std::make_shared<TransactionDataAbility>();
+    std::shared_ptr<Uri> uri = std::make_shared<Uri>("dataability:///com.example.DataAbilityTest/person");
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+    operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->Build());
+    operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->WithInterruptionAllowed(true)->Build());
+    // two rows are inserted, the assertion fails.
+    operations.emplace_back(DataAbilityOperation::NewAssertBuilder(uri)->WithExpectedCount(1)->Build());
+
+    std::vector<std::shared_ptr<DataAbilityResult>> results = ability->ExecuteBatch(operations);
+
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(DataUriUtils::GetId(results[0]->GetUri()), 1);
+    EXPECT_EQ(ability->beginCount_, 2);
+    EXPECT_EQ(ability->commitCount_, 1);
+    EXPECT_EQ(ability->rollbackCount_, 1);
+    EXPECT_EQ(ability->lastId_, 1);
+
+    operations.pop_back();
+    operations.emplace_back(DataAbilityOperation::NewAssertBuilder(uri)->WithExpectedCount(3)->Build());
+    results = ability->ExecuteBatch(operations);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[2]->GetCount(), 3);
+    EXPECT_EQ(ability->commitCount_, 3);
+    EXPECT_EQ(ability->rollbackCount_, 1);
+
+    GTEST_LOG_(INFO) << "AaFwk_Ability_ExecuteBatch_0200 end";
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
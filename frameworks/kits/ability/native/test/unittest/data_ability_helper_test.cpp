@@ -14,9 +14,12 @@
  */
 
 #include "data_ability_helper.h"
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <gmock/gmock-more-actions.h>
+#include "data_ability_proxy_cache.h"
 #include "mock_ability_manager_client.h"
 #include "mock_ability_token.h"
 
@@ -650,5 +653,106 @@ HWTEST_F(DataAbilityHelperTest, AaFwk_DataAbilityHelper_BatchInsert_0200, Functi
 
     GTEST_LOG_(INFO) << "AaFwk_DataAbilityHelper_BatchInsert_0200 end";
 }
+
+/**
+ * @tc.number: AaFwk_DataAbilityHelper_ExecuteBatch_0100
+ * @tc.name: ExecuteBatch
+ * @tc.desc: Test whether ExecuteBatch returns one result for each operation when the parameter passed by Creator
+ *           is true.
+ */
+HWTEST_F(DataAbilityHelperTest, AaFwk_DataAbilityHelper_ExecuteBatch_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityHelper_ExecuteBatch_0100 start";
+
+    std::shared_ptr<MockAbility> context = std::make_shared<MockAbility>();
+    std::shared_ptr<Uri> uri = std::make_shared<Uri>("dataability://com.example.myapplication5.DataAbilityTest");
+    std::shared_ptr<DataAbilityHelper> helper = DataAbilityHelper::Creator(context, uri, true);
+
+    EXPECT_NE(helper, nullptr);
+    if (helper != nullptr) {
+        Uri uri2("dataability://com.example.myapplication5.DataAbilityTest");
+        std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+        operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->Build());
+        operations.emplace_back(DataAbilityOperation::NewDeleteBuilder(uri)->WithPredicatesBackReference(0, 0)
+            ->Build());
+        std::vector<std::shared_ptr<DataAbilityResult>> results = helper->ExecuteBatch(uri2, operations);
+
+        EXPECT_EQ(results.size(), operations.size());
+    }
+
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityHelper_ExecuteBatch_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityProxyCache_Lease_0100
+ * @tc.name: DataAbilityProxyCache
+ * @tc.desc: Test that repeated operations on the same authority share one cached proxy.
+ */
+HWTEST_F(DataAbilityHelperTest, AaFwk_DataAbilityProxyCache_Lease_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityProxyCache_Lease_0100 start";
+
+    auto cache = DataAbilityProxyCache::GetInstance();
+    cache->ReleaseIdle();
+    std::shared_ptr<MockAbility> context = std::make_shared<MockAbility>();
+    std::shared_ptr<DataAbilityHelper> helper = DataAbilityHelper::Creator(context);
+    EXPECT_NE(helper, nullptr);
+    if (helper != nullptr) {
+        Uri uri("dataability://com.example.myapplication5.DataAbilityTest");
+        ValuesBucket value;
+        EXPECT_EQ(helper->Insert(uri, value), INSERTNUM);
+        EXPECT_EQ(helper->Insert(uri, value), INSERTNUM);
+        EXPECT_EQ(cache->GetSize(), 1u);
+        EXPECT_EQ(cache->GetLeaseCount(uri, false, context->GetToken()), 0);
+
+        sptr<AAFwk::IAbilityScheduler> proxy1 = cache->Acquire(uri, false, context->GetToken());
+        sptr<AAFwk::IAbilityScheduler> proxy2 = cache->Acquire(uri, false, context->GetToken());
+        EXPECT_NE(proxy1, nullptr);
+        EXPECT_EQ(proxy1, proxy2);
+        EXPECT_EQ(cache->GetLeaseCount(uri, false, context->GetToken()), 2);
+        EXPECT_EQ(cache->Release(uri, false, context->GetToken(), proxy1), ERR_OK);
+        EXPECT_EQ(cache->Release(uri, false, context->GetToken(), proxy2), ERR_OK);
+        EXPECT_EQ(cache->GetLeaseCount(uri, false, context->GetToken()), 0);
+    }
+    cache->ReleaseIdle();
+    EXPECT_EQ(cache->GetSize(), 0u);
+
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityProxyCache_Lease_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_DataAbilityProxyCache_IdleTimeout_0100
+ * @tc.name: DataAbilityProxyCache
+ * @tc.desc: Test that an idle proxy is released after the idle timeout, and a leased one is kept.
+ */
+HWTEST_F(DataAbilityHelperTest, AaFwk_DataAbilityProxyCache_IdleTimeout_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityProxyCache_IdleTimeout_0100 start";
+
+    auto cache = DataAbilityProxyCache::GetInstance();
+    cache->ReleaseIdle();
+    long idleTimeout = cache->GetIdleTimeout();
+    cache->SetIdleTimeout(100);
+
+    std::shared_ptr<MockAbility> context = std::make_shared<MockAbility>();
+    Uri uri1("dataability://com.example.myapplication5.DataAbilityTest");
+    Uri uri2("dataability://com.example.myapplication6.DataAbilityTest");
+    sptr<AAFwk::IAbilityScheduler> proxy1 = cache->Acquire(uri1, false, context->GetToken());
+    sptr<AAFwk::IAbilityScheduler> proxy2 = cache->Acquire(uri2, false, context->GetToken());
+    EXPECT_NE(proxy1, proxy2);
+    EXPECT_EQ(cache->GetSize(), 2u);
+    EXPECT_EQ(cache->Release(uri1, false, context->GetToken(), proxy1), ERR_OK);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_EQ(cache->GetLeaseCount(uri1, false, context->GetToken()), -1);
+    EXPECT_EQ(cache->GetLeaseCount(uri2, false, context->GetToken()), 1);
+
+    EXPECT_EQ(cache->Release(uri2, false, context->GetToken(), proxy2), ERR_OK);
+    cache->ReleaseIdle();
+    EXPECT_EQ(cache->GetSize(), 0u);
+    cache->SetIdleTimeout(idleTimeout);
+
+    GTEST_LOG_(INFO) << "AaFwk_DataAbilityProxyCache_IdleTimeout_0100 end";
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <memory>
 #include "pac_map.h"
 #include "ohos/aafwk/base/pac_map_node_user_object.h"
@@ -623,5 +624,137 @@ HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0100, Function | MediumTest |
     }
     GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0100 end";
 }
+
+/**
+ * @tc.number: AppExecFwk_PacMap_Snapshot_0100
+ * @tc.name: Snapshot
+ * @tc.desc: Verify the snapshot is not changed by the changes of the PacMap, and can not be changed.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Snapshot_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Snapshot_0100 start";
+
+    FillData(*pacmap_.get());
+    PacMap snapshot = pacmap_->Snapshot();
+    EXPECT_EQ(true, pacmap_->Equals(snapshot));
+
+    pacmap_->PutIntValue("key_int", 0);
+    pacmap_->Remove("key_short_array");
+    EXPECT_EQ(PAC_MPA_TEST_INT, snapshot.GetIntValue("key_int"));
+    EXPECT_EQ(true, snapshot.HasKey("key_short_array"));
+    EXPECT_EQ(0, pacmap_->GetIntValue("key_int"));
+
+    snapshot.PutIntValue("key_int", 1);
+    snapshot.Remove("key_int");
+    snapshot.Clear();
+    EXPECT_EQ(PAC_MPA_TEST_INT, snapshot.GetIntValue("key_int"));
+    EXPECT_EQ(pacmap_->GetSize() + 1, snapshot.GetSize());
+
+    PacMap assigned;
+    assigned = snapshot;
+    assigned.PutIntValue("key_int", 1);
+    EXPECT_EQ(1, assigned.GetIntValue("key_int"));
+    EXPECT_EQ(PAC_MPA_TEST_INT, snapshot.GetIntValue("key_int"));
+
+    PacMap clone = pacmap_->Clone();
+    clone.PutIntValue("key_clone", 1);
+    EXPECT_EQ(false, pacmap_->HasKey("key_clone"));
+    EXPECT_EQ(1, clone.GetIntValue("key_clone"));
+
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Snapshot_0100 end";
+}
+
+/**
+ * @tc.number: AppExecFwk_PacMap_Marshalling_0200
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Verify the large arrays of each type are marshalled and unmarshalled.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_Marshalling_0200, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0200 start";
+
+    constexpr int count = 10000;
+    std::vector<short> arrayShort;
+    std::vector<int> arrayInt;
+    std::vector<long> arrayLong;
+    std::vector<bool> arrayBool;
+    std::vector<AAFwk::byte> arrayByte;
+    std::vector<float> arrayFloat;
+    std::vector<double> arrayDouble;
+    for (int i = 0; i < count; i++) {
+        arrayShort.push_back(static_cast<short>(i));
+        arrayInt.push_back(i * PAC_MPA_TEST_INT);
+        arrayLong.push_back(i * PAC_MAP_TEST_LONG);
+        arrayBool.push_back(i % 2 == 0);
+        arrayByte.push_back(static_cast<AAFwk::byte>(i));
+        arrayFloat.push_back(i * PAC_MAP_TEST_FLOAT);
+        arrayDouble.push_back(i * PAC_MAP_TEST_DOUBLE);
+    }
+    pacmap_->PutShortValueArray("key_short_array", arrayShort);
+    pacmap_->PutIntValueArray("key_int_array", arrayInt);
+    pacmap_->PutLongValueArray("key_long_array", arrayLong);
+    pacmap_->PutBooleanValueArray("key_boolean_array", arrayBool);
+    pacmap_->PutByteValueArray("key_byte_array", arrayByte);
+    pacmap_->PutFloatValueArray("key_float_array", arrayFloat);
+    pacmap_->PutDoubleValueArray("key_double_array", arrayDouble);
+    pacmap_->PutIntValueArray("key_empty_array", std::vector<int>());
+
+    Parcel parcel;
+    EXPECT_EQ(true, pacmap_->Marshalling(parcel));
+    PacMap *unmarshingMap = PacMap::Unmarshalling(parcel);
+    EXPECT_EQ(true, unmarshingMap != nullptr);
+    if (unmarshingMap != nullptr) {
+        EXPECT_EQ(true, pacmap_->Equals(unmarshingMap));
+        std::vector<int> intValue;
+        unmarshingMap->GetIntValueArray("key_int_array", intValue);
+        EXPECT_EQ(arrayInt, intValue);
+        std::vector<double> doubleValue;
+        unmarshingMap->GetDoubleValueArray("key_double_array", doubleValue);
+        EXPECT_EQ(arrayDouble, doubleValue);
+        delete unmarshingMap;
+        unmarshingMap = nullptr;
+    }
+
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_Marshalling_0200 end";
+}
+
+/**
+ * @tc.number: AppExecFwk_PacMap_SaveRestore_0100
+ * @tc.name: Marshalling and Unmarshalling
+ * @tc.desc: Measure saving and restoring the state of 1 KB, 100 KB and 1 MB.
+ */
+HWTEST_F(PacMapTest, AppExecFwk_PacMap_SaveRestore_0100, Function | MediumTest | Level3)
+{
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_SaveRestore_0100 start";
+
+    constexpr size_t arraySize = 256;
+    constexpr int rounds = 10;
+    const std::vector<size_t> stateSizes = {1024, 100 * 1024, 1024 * 1024};
+    for (size_t stateSize : stateSizes) {
+        // the state is made of int arrays of 1 KB each, and a string value for each array.
+        PacMap state;
+        std::vector<int> array(arraySize, PAC_MPA_TEST_INT);
+        for (size_t i = 0; i < stateSize / (arraySize * sizeof(int)); i++) {
+            state.PutIntValueArray("key_array_" + std::to_string(i), array);
+            state.PutStringValue("key_string_" + std::to_string(i), "state");
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++) {
+            Parcel parcel;
+            EXPECT_EQ(true, state.Marshalling(parcel));
+            PacMap *restored = PacMap::Unmarshalling(parcel);
+            EXPECT_EQ(true, restored != nullptr);
+            if (restored != nullptr) {
+                EXPECT_EQ(state.GetSize(), restored->GetSize());
+                delete restored;
+            }
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+        GTEST_LOG_(INFO) << "save and restore " << stateSize << " bytes: " << cost.count() / rounds << " us";
+    }
+
+    GTEST_LOG_(INFO) << "AppExecFwk_PacMap_SaveRestore_0100 end";
+}
 }  // namespace AppExecFwk
 }  // namespace OHOS
\ No newline at end of file
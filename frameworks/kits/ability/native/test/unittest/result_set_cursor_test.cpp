@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include "result_set_cursor.h"
+#include "result_set_window.h"
+#include "shared_result_set.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+using namespace testing::ext;
+
+namespace {
+const std::vector<std::string> COLUMN_NAMES = {"id", "name", "value"};
+const int BENCHMARK_ROW_COUNT = 100000;
+
+std::shared_ptr<ResultSet> CreateResultSet(int rowCount)
+{
+    auto resultSet = std::make_shared<ResultSet>(COLUMN_NAMES);
+    for (int i = 0; i < rowCount; i++) {
+        resultSet->AddRow({std::to_string(i), "name_" + std::to_string(i), std::string(i % 40, 'v')});
+    }
+    return resultSet;
+}
+}  // namespace
+
+class ResultSetCursorTest : public testing::Test {
+public:
+    ResultSetCursorTest()
+    {}
+    ~ResultSetCursorTest()
+    {}
+
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void ResultSetCursorTest::SetUpTestCase(void)
+{}
+void ResultSetCursorTest::TearDownTestCase(void)
+{}
+void ResultSetCursorTest::SetUp()
+{}
+void ResultSetCursorTest::TearDown()
+{}
+
+/**
+ * @tc.number: AaFwk_ResultSetWindow_Fill_0100
+ * @tc.name: Fill/ReadHeader/ReadString
+ * @tc.desc: Test that a window holds the rows that fit in it and grows to hold a row larger than a window.
+ */
+HWTEST_F(ResultSetCursorTest, AaFwk_ResultSetWindow_Fill_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_ResultSetWindow_Fill_0100 start";
+
+    auto resultSet = CreateResultSet(1000);
+    ResultSetWindow window(4096);
+    uint32_t rowCount = window.Fill(*resultSet, 10);
+    EXPECT_GT(rowCount, 0u);
+    EXPECT_LT(rowCount, 990u);
+
+    std::vector<uint8_t> memory(4096);
+    const auto &header = window.GetHeader();
+    const auto &slots = window.GetSlots();
+    memcpy(memory.data(), &header, sizeof(header));
+    memcpy(memory.data() + sizeof(header), slots.data(), slots.size() * sizeof(slots[0]));
+    memcpy(memory.data() + header.dataOffset, window.GetData().data(), header.dataSize);
+
+    ResultSetWindow::Header readHeader;
+    EXPECT_TRUE(ResultSetWindow::ReadHeader(memory.data(), memory.size(), readHeader));
+    EXPECT_EQ(readHeader.startRow, 10);
+    EXPECT_EQ(readHeader.rowCount, rowCount);
+    std::string value;
+    EXPECT_TRUE(ResultSetWindow::ReadString(memory.data(), readHeader, 0, 1, value));
+    EXPECT_EQ(value, "name_10");
+    EXPECT_FALSE(ResultSetWindow::ReadString(memory.data(), readHeader, rowCount, 0, value));
+    EXPECT_FALSE(ResultSetWindow::ReadString(memory.data(), readHeader, 0, COLUMN_NAMES.size(), value));
+
+    ResultSet large(std::vector<std::string> {"value"});
+    large.AddRow({std::string(8192, 'x')});
+    large.AddRow({"y"});
+    EXPECT_EQ(window.Fill(large, 0), 1u);
+    EXPECT_GT(window.GetSize(), 4096u);
+
+    GTEST_LOG_(INFO) << "AaFwk_ResultSetWindow_Fill_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_SharedResultSet_WriteResultSet_0100
+ * @tc.name: WriteResultSet/ReadResultSet
+ * @tc.desc: Test that a small result set is written inline and a large one is written as a cursor.
+ */
+HWTEST_F(ResultSetCursorTest, AaFwk_SharedResultSet_WriteResultSet_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_WriteResultSet_0100 start";
+
+    MessageParcel small;
+    EXPECT_TRUE(SharedResultSet::WriteResultSet(small, CreateResultSet(10)));
+    auto inlineSet = SharedResultSet::ReadResultSet(small);
+    ASSERT_NE(inlineSet, nullptr);
+    EXPECT_EQ(std::dynamic_pointer_cast<SharedResultSet>(inlineSet), nullptr);
+    EXPECT_EQ(inlineSet->GetRowCount(), 10);
+
+    MessageParcel large;
+    EXPECT_TRUE(SharedResultSet::WriteResultSet(large, CreateResultSet(10000)));
+    auto sharedSet = SharedResultSet::ReadResultSet(large);
+    ASSERT_NE(sharedSet, nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<SharedResultSet>(sharedSet), nullptr);
+    EXPECT_EQ(sharedSet->GetAllColumnNames(), COLUMN_NAMES);
+    EXPECT_EQ(sharedSet->GetRowCount(), 10000);
+
+    std::string value;
+    EXPECT_TRUE(sharedSet->GoToRow(9999));
+    EXPECT_TRUE(sharedSet->GetString(0, value));
+    EXPECT_EQ(value, "9999");
+    EXPECT_TRUE(sharedSet->GoToRow(5));
+    EXPECT_TRUE(sharedSet->GetString(1, value));
+    EXPECT_EQ(value, "name_5");
+    EXPECT_FALSE(sharedSet->GoToRow(10000));
+
+    sharedSet->Close();
+    EXPECT_FALSE(sharedSet->GoToRow(0));
+
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_WriteResultSet_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_SharedResultSet_FetchWindow_0100
+ * @tc.name: FetchWindow
+ * @tc.desc: Test that a row larger than a window is read through the cursor along with the rows around it.
+ */
+HWTEST_F(ResultSetCursorTest, AaFwk_SharedResultSet_FetchWindow_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_FetchWindow_0100 start";
+
+    auto resultSet = std::make_shared<ResultSet>(std::vector<std::string> {"value"});
+    resultSet->AddRow({"first"});
+    resultSet->AddRow({std::string(8192, 'x')});
+    for (int i = 0; i < 1000; i++) {
+        resultSet->AddRow({std::to_string(i)});
+    }
+    sptr<ResultSetCursorStub> cursor = new ResultSetCursorStub(resultSet, 4096);
+    SharedResultSet sharedSet(resultSet->GetAllColumnNames(), resultSet->GetRowCount(), cursor);
+
+    std::string value;
+    EXPECT_TRUE(sharedSet.GoToRow(1));
+    EXPECT_TRUE(sharedSet.GetString(0, value));
+    EXPECT_EQ(value, std::string(8192, 'x'));
+    EXPECT_TRUE(sharedSet.GoToRow(900));
+    EXPECT_TRUE(sharedSet.GetString(0, value));
+    EXPECT_EQ(value, "898");
+    EXPECT_TRUE(sharedSet.GoToRow(0));
+    EXPECT_TRUE(sharedSet.GetString(0, value));
+    EXPECT_EQ(value, "first");
+    EXPECT_TRUE(sharedSet.GoToRow(1));
+    EXPECT_TRUE(sharedSet.GetString(0, value));
+    EXPECT_EQ(value.size(), 8192u);
+
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_FetchWindow_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_ResultSetCursorStub_ReleaseWindow_0100
+ * @tc.name: FillWindow/ReleaseWindow
+ * @tc.desc: Test that the id of a released window is given to the next window.
+ */
+HWTEST_F(ResultSetCursorTest, AaFwk_ResultSetCursorStub_ReleaseWindow_0100, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "AaFwk_ResultSetCursorStub_ReleaseWindow_0100 start";
+
+    sptr<ResultSetCursorStub> cursor = new ResultSetCursorStub(CreateResultSet(1000), 4096);
+    sptr<Ashmem> memory;
+    int32_t first = -1;
+    EXPECT_GT(cursor->FillWindow(0, first, memory), 0);
+    EXPECT_EQ(first, 0);
+    int32_t second = -1;
+    EXPECT_GT(cursor->FillWindow(500, second, memory), 0);
+    EXPECT_EQ(second, 1);
+    int32_t third = -1;
+    EXPECT_EQ(cursor->FillWindow(900, third, memory), 0);
+
+    cursor->ReleaseWindow(first);
+    third = -1;
+    EXPECT_GT(cursor->FillWindow(900, third, memory), 0);
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(cursor->FillWindow(0, second, memory), cursor->FillWindow(0, third, memory));
+
+    GTEST_LOG_(INFO) << "AaFwk_ResultSetCursorStub_ReleaseWindow_0100 end";
+}
+
+/**
+ * @tc.number: AaFwk_SharedResultSet_Scan_0100
+ * @tc.name: GoToNextRow/GetString
+ * @tc.desc: Scan 100k rows through the proxy of a local cursor and report the throughput.
+ */
+HWTEST_F(ResultSetCursorTest, AaFwk_SharedResultSet_Scan_0100, Performance | MediumTest | Level3)
+{
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_Scan_0100 start";
+
+    auto resultSet = CreateResultSet(BENCHMARK_ROW_COUNT);
+    sptr<ResultSetCursorStub> stub = new ResultSetCursorStub(resultSet);
+    sptr<IResultSetCursor> cursor = new ResultSetCursorProxy(stub->AsObject());
+    SharedResultSet sharedSet(COLUMN_NAMES, resultSet->GetRowCount(), cursor);
+
+    auto begin = std::chrono::steady_clock::now();
+    int rowCount = 0;
+    size_t byteCount = 0;
+    std::string value;
+    while (sharedSet.GoToNextRow()) {
+        for (int column = 0; column < static_cast<int>(COLUMN_NAMES.size()); column++) {
+            EXPECT_TRUE(sharedSet.GetString(column, value));
+            byteCount += value.size();
+        }
+        rowCount++;
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    EXPECT_EQ(rowCount, BENCHMARK_ROW_COUNT);
+
+    GTEST_LOG_(INFO) << "scanned " << rowCount << " rows, " << byteCount << " bytes in " << cost.count() << " us, "
+                     << (cost.count() > 0 ? rowCount * 1000000LL / cost.count() : 0) << " rows/s";
+    GTEST_LOG_(INFO) << "AaFwk_SharedResultSet_Scan_0100 end";
+}
+}  // namespace AppExecFwk
+}  // namespace OHOS
@@ -13,30 +13,25 @@
  * limitations under the License.
  */
 
+#include <climits>
 #include <iostream>
 #include "ohos/aafwk/base/pac_map_node_array.h"
+#include "securec.h"
 #include "string_ex.h"
 
 namespace OHOS {
 namespace AppExecFwk {
-#define IS_STORED_ARRAY_DATA_TYPE(id, value)           \
-    do {                                               \
-        if (value.GetRefPtr() != nullptr) {            \
-            return AAFwk::Array::Is##id##Array(value); \
-        }                                              \
-        return false;                                  \
-    } while (0)
-
-#define EQUALS_ARRAY_DATA(id, dataType, right)       \
-    do {                                             \
-        if (Is##id() && right->Is##id()) {           \
-            std::vector<dataType> left_value;        \
-            std::vector<dataType> right_value;       \
-            Get##id##ValueArray(left_value);         \
-            right->Get##id##ValueArray(right_value); \
-            return (left_value == right_value);      \
-        }                                            \
-    } while (0)
+namespace {
+// the indexes of the types in PacMapNodeTypeArray::ArrayValue.
+constexpr size_t ARRAY_INDEX_SHORT = 1;
+constexpr size_t ARRAY_INDEX_INTEGER = 2;
+constexpr size_t ARRAY_INDEX_LONG = 3;
+constexpr size_t ARRAY_INDEX_BOOLEAN = 4;
+constexpr size_t ARRAY_INDEX_BYTE = 5;
+constexpr size_t ARRAY_INDEX_FLOAT = 6;
+constexpr size_t ARRAY_INDEX_DOUBLE = 7;
+constexpr size_t ARRAY_INDEX_STRING = 8;
+}  // namespace
 
 #define READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(type, parcel, data) \
     do {                                                               \
@@ -52,37 +47,42 @@ namespace AppExecFwk {
         }                                                               \
     } while (0)
 
-#define INNER_DEEP_COPY(id, dataType, obj) \
-    do {                                   \
-        std::vector<dataType> array;       \
-        obj->Get##id##ValueArray(array);   \
-        Put##id##ValueArray(array);        \
-    } while (0)
+template <typename T, typename V>
+static void PacMapGetArray(const V &array, std::vector<T> &value)
+{
+    const std::vector<T> *stored = std::get_if<std::vector<T>>(&array);
+    if (stored != nullptr) {
+        value.insert(value.end(), stored->begin(), stored->end());
+    }
+}
 
-template <typename T1, typename T2>
-static void PacMapSetArray(const AAFwk::InterfaceID &id, const std::vector<T1> &value, sptr<AAFwk::IArray> &ao)
+// the elements are written at once, which gives the same bytes as writing them one by one.
+template <typename T>
+static bool WriteArrayBuffer(Parcel &parcel, int32_t dataType, const std::vector<T> &value)
 {
-    typename std::vector<T1>::size_type size = value.size();
-    ao = new (std::nothrow) AAFwk::Array(size, id);
-    if (ao != nullptr) {
-        for (typename std::vector<T1>::size_type i = 0; i < size; i++) {
-            ao->Set(i, T2::Box(value[i]));
-        }
+    if (value.size() > INT_MAX / sizeof(T)) {
+        return false;
     }
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, dataType);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, value.size());
+    return value.empty() || parcel.WriteBuffer(value.data(), value.size() * sizeof(T));
 }
 
-template <typename T1, typename T2, typename T3>
-static void PacMapGetArray(const sptr<AAFwk::IArray> &ao, std::vector<T1> &array)
+template <typename T>
+static bool ReadArrayBuffer(Parcel &parcel, std::vector<T> &value)
 {
-    auto func = [&](AAFwk::IInterface *object) {
-        if (object != nullptr) {
-            T3 *value = T3::Query(object);
-            if (value != nullptr) {
-                array.push_back(T2::Unbox(value));
-            }
-        }
-    };
-    AAFwk::Array::ForEach(ao.GetRefPtr(), func);
+    int32_t count = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, count);
+    if (count < 0 || static_cast<size_t>(count) > parcel.GetReadableBytes() / sizeof(T)) {
+        return false;
+    }
+    value.resize(count);
+    if (count == 0) {
+        return true;
+    }
+    size_t size = value.size() * sizeof(T);
+    const uint8_t *data = parcel.ReadBuffer(size);
+    return data != nullptr && memcpy_s(value.data(), size, data, size) == EOK;
 }
 
 PacMapNodeTypeArray::PacMapNodeTypeArray(const PacMapNodeTypeArray &other) : PacMapNode(other)
@@ -104,7 +104,7 @@ PacMapNodeTypeArray &PacMapNodeTypeArray::operator=(const PacMapNodeTypeArray &o
  */
 void PacMapNodeTypeArray::PutShortValueArray(const std::vector<short> &value)
 {
-    PacMapSetArray<short, AAFwk::Short>(AAFwk::g_IID_IShort, value, value_);
+    value_ = value;
 }
 
 /**
@@ -113,7 +113,7 @@ void PacMapNodeTypeArray::PutShortValueArray(const std::vector<short> &value)
  */
 void PacMapNodeTypeArray::PutIntegerValueArray(const std::vector<int> &value)
 {
-    PacMapSetArray<int, AAFwk::Integer>(AAFwk::g_IID_IInteger, value, value_);
+    value_ = value;
 }
 
 /**
@@ -122,7 +122,7 @@ void PacMapNodeTypeArray::PutIntegerValueArray(const std::vector<int> &value)
  */
 void PacMapNodeTypeArray::PutLongValueArray(const std::vector<long> &value)
 {
-    PacMapSetArray<long, AAFwk::Long>(AAFwk::g_IID_ILong, value, value_);
+    value_ = value;
 }
 
 /**
@@ -131,7 +131,7 @@ void PacMapNodeTypeArray::PutLongValueArray(const std::vector<long> &value)
  */
 void PacMapNodeTypeArray::PutBooleanValueArray(const std::vector<bool> &value)
 {
-    PacMapSetArray<bool, AAFwk::Boolean>(AAFwk::g_IID_IBoolean, value, value_);
+    value_ = value;
 }
 
 /**
@@ -140,7 +140,7 @@ void PacMapNodeTypeArray::PutBooleanValueArray(const std::vector<bool> &value)
  */
 void PacMapNodeTypeArray::PutCharValueArray(const std::vector<char> &value)
 {
-    PacMapSetArray<char, AAFwk::Byte>(AAFwk::g_IID_IByte, value, value_);
+    value_ = value;
 }
 
 /**
@@ -149,7 +149,7 @@ void PacMapNodeTypeArray::PutCharValueArray(const std::vector<char> &value)
  */
 void PacMapNodeTypeArray::PutByteValueArray(const std::vector<AAFwk::byte> &value)
 {
-    PacMapSetArray<AAFwk::byte, AAFwk::Byte>(AAFwk::g_IID_IByte, value, value_);
+    value_ = value;
 }
 
 /**
@@ -158,7 +158,7 @@ void PacMapNodeTypeArray::PutByteValueArray(const std::vector<AAFwk::byte> &valu
  */
 void PacMapNodeTypeArray::PutFloatValueArray(const std::vector<float> &value)
 {
-    PacMapSetArray<float, AAFwk::Float>(AAFwk::g_IID_IFloat, value, value_);
+    value_ = value;
 }
 
 /**
@@ -167,7 +167,7 @@ void PacMapNodeTypeArray::PutFloatValueArray(const std::vector<float> &value)
  */
 void PacMapNodeTypeArray::PutDoubleValueArray(const std::vector<double> &value)
 {
-    PacMapSetArray<double, AAFwk::Double>(AAFwk::g_IID_IDouble, value, value_);
+    value_ = value;
 }
 
 /**
@@ -176,7 +176,7 @@ void PacMapNodeTypeArray::PutDoubleValueArray(const std::vector<double> &value)
  */
 void PacMapNodeTypeArray::PutStringValueArray(const std::vector<std::string> &value)
 {
-    PacMapSetArray<std::string, AAFwk::String>(AAFwk::g_IID_IString, value, value_);
+    value_ = value;
 }
 
 /**
@@ -185,7 +185,7 @@ void PacMapNodeTypeArray::PutStringValueArray(const std::vector<std::string> &va
  */
 void PacMapNodeTypeArray::GetShortValueArray(std::vector<short> &value)
 {
-    PacMapGetArray<short, AAFwk::Short, AAFwk::IShort>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -194,7 +194,7 @@ void PacMapNodeTypeArray::GetShortValueArray(std::vector<short> &value)
  */
 void PacMapNodeTypeArray::GetIntegerValueArray(std::vector<int> &value)
 {
-    PacMapGetArray<int, AAFwk::Integer, AAFwk::IInteger>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -203,7 +203,7 @@ void PacMapNodeTypeArray::GetIntegerValueArray(std::vector<int> &value)
  */
 void PacMapNodeTypeArray::GetLongValueArray(std::vector<long> &value)
 {
-    PacMapGetArray<long, AAFwk::Long, AAFwk::ILong>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -212,7 +212,7 @@ void PacMapNodeTypeArray::GetLongValueArray(std::vector<long> &value)
  */
 void PacMapNodeTypeArray::GetBooleanValueArray(std::vector<bool> &value)
 {
-    PacMapGetArray<bool, AAFwk::Boolean, AAFwk::IBoolean>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -221,7 +221,7 @@ void PacMapNodeTypeArray::GetBooleanValueArray(std::vector<bool> &value)
  */
 void PacMapNodeTypeArray::GetCharValueArray(std::vector<char> &value)
 {
-    PacMapGetArray<char, AAFwk::Byte, AAFwk::IByte>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -230,7 +230,7 @@ void PacMapNodeTypeArray::GetCharValueArray(std::vector<char> &value)
  */
 void PacMapNodeTypeArray::GetByteValueArray(std::vector<AAFwk::byte> &value)
 {
-    PacMapGetArray<AAFwk::byte, AAFwk::Byte, AAFwk::IByte>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -239,7 +239,7 @@ void PacMapNodeTypeArray::GetByteValueArray(std::vector<AAFwk::byte> &value)
  */
 void PacMapNodeTypeArray::GetFloatValueArray(std::vector<float> &value)
 {
-    PacMapGetArray<float, AAFwk::Float, AAFwk::IFloat>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -248,7 +248,7 @@ void PacMapNodeTypeArray::GetFloatValueArray(std::vector<float> &value)
  */
 void PacMapNodeTypeArray::GetDoubleValueArray(std::vector<double> &value)
 {
-    PacMapGetArray<double, AAFwk::Double, AAFwk::IDouble>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -257,7 +257,7 @@ void PacMapNodeTypeArray::GetDoubleValueArray(std::vector<double> &value)
  */
 void PacMapNodeTypeArray::GetStringValueArray(std::vector<std::string> &value)
 {
-    PacMapGetArray<std::string, AAFwk::String, AAFwk::IString>(value_, value);
+    PacMapGetArray(value_, value);
 }
 
 /**
@@ -277,25 +277,7 @@ bool PacMapNodeTypeArray::Equals(const PacMapNode *other)
         return false;
     }
 
-    if (value_.GetRefPtr() == other_->value_.GetRefPtr()) {
-        return true;
-    }
-
-    if (value_.GetRefPtr() == nullptr || other_->value_.GetRefPtr() == nullptr) {
-        return false;
-    }
-
-    EQUALS_ARRAY_DATA(Short, short, other_);
-    EQUALS_ARRAY_DATA(Integer, int, other_);
-    EQUALS_ARRAY_DATA(Long, long, other_);
-    EQUALS_ARRAY_DATA(Char, char, other_);
-    EQUALS_ARRAY_DATA(Byte, AAFwk::byte, other_);
-    EQUALS_ARRAY_DATA(Boolean, bool, other_);
-    EQUALS_ARRAY_DATA(Float, float, other_);
-    EQUALS_ARRAY_DATA(Double, double, other_);
-    EQUALS_ARRAY_DATA(String, std::string, other_);
-
-    return false;
+    return value_ == other_->value_;
 }
 
 /**
@@ -314,26 +296,7 @@ void PacMapNodeTypeArray::InnerDeepCopy(const PacMapNodeTypeArray *other)
         return;
     }
 
-    PacMapNodeTypeArray *pother = const_cast<PacMapNodeTypeArray *>(other);
-    if (AAFwk::Array::IsStringArray(pother->value_)) {
-        INNER_DEEP_COPY(String, std::string, pother);
-    } else if (AAFwk::Array::IsBooleanArray(pother->value_)) {
-        INNER_DEEP_COPY(Boolean, bool, pother);
-    } else if (AAFwk::Array::IsByteArray(pother->value_)) {
-        INNER_DEEP_COPY(Byte, AAFwk::byte, pother);
-    } else if (AAFwk::Array::IsShortArray(pother->value_)) {
-        INNER_DEEP_COPY(Short, short, pother);
-    } else if (AAFwk::Array::IsIntegerArray(pother->value_)) {
-        INNER_DEEP_COPY(Integer, int, pother);
-    } else if (AAFwk::Array::IsLongArray(pother->value_)) {
-        INNER_DEEP_COPY(Long, long, pother);
-    } else if (AAFwk::Array::IsFloatArray(pother->value_)) {
-        INNER_DEEP_COPY(Float, float, pother);
-    } else if (AAFwk::Array::IsDoubleArray(pother->value_)) {
-        INNER_DEEP_COPY(Double, double, pother);
-    } else {
-        return;
-    }
+    value_ = other->value_;
 }
 
 /**
@@ -342,7 +305,7 @@ void PacMapNodeTypeArray::InnerDeepCopy(const PacMapNodeTypeArray *other)
  */
 bool PacMapNodeTypeArray::IsShort(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Short, value_);
+    return std::holds_alternative<std::vector<short>>(value_);
 }
 
 /**
@@ -351,7 +314,7 @@ bool PacMapNodeTypeArray::IsShort(void)
  */
 bool PacMapNodeTypeArray::IsInteger(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Integer, value_);
+    return std::holds_alternative<std::vector<int>>(value_);
 }
 
 /**
@@ -360,7 +323,7 @@ bool PacMapNodeTypeArray::IsInteger(void)
  */
 bool PacMapNodeTypeArray::IsLong(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Long, value_);
+    return std::holds_alternative<std::vector<long>>(value_);
 }
 
 /**
@@ -378,7 +341,7 @@ bool PacMapNodeTypeArray::IsChar(void)
  */
 bool PacMapNodeTypeArray::IsByte(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Byte, value_);
+    return std::holds_alternative<std::vector<AAFwk::byte>>(value_);
 }
 
 /**
@@ -387,7 +350,7 @@ bool PacMapNodeTypeArray::IsByte(void)
  */
 bool PacMapNodeTypeArray::IsBoolean(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Boolean, value_);
+    return std::holds_alternative<std::vector<bool>>(value_);
 }
 
 /**
@@ -396,7 +359,7 @@ bool PacMapNodeTypeArray::IsBoolean(void)
  */
 bool PacMapNodeTypeArray::IsFloat(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Float, value_);
+    return std::holds_alternative<std::vector<float>>(value_);
 }
 
 /**
@@ -405,7 +368,7 @@ bool PacMapNodeTypeArray::IsFloat(void)
  */
 bool PacMapNodeTypeArray::IsDouble(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(Double, value_);
+    return std::holds_alternative<std::vector<double>>(value_);
 }
 
 /**
@@ -414,19 +377,17 @@ bool PacMapNodeTypeArray::IsDouble(void)
  */
 bool PacMapNodeTypeArray::IsString(void)
 {
-    IS_STORED_ARRAY_DATA_TYPE(String, value_);
+    return std::holds_alternative<std::vector<std::string>>(value_);
 }
 
 bool PacMapNodeTypeArray::MarshallingArrayString(Parcel &parcel) const
 {
+    const auto &value = std::get<std::vector<std::string>>(value_);
     std::vector<std::u16string> array;
-    auto func = [&](AAFwk::IInterface *object) {
-        if (AAFwk::IString::Query(object) != nullptr) {
-            std::string s = AAFwk::String::Unbox(AAFwk::IString::Query(object));
-            array.push_back(Str8ToStr16(s));
-        }
-    };
-    AAFwk::Array::ForEach(value_, func);
+    array.reserve(value.size());
+    for (const auto &item : value) {
+        array.emplace_back(Str8ToStr16(item));
+    }
 
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_STRING);
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(String16Vector, parcel, array);
@@ -435,8 +396,8 @@ bool PacMapNodeTypeArray::MarshallingArrayString(Parcel &parcel) const
 
 bool PacMapNodeTypeArray::MarshallingArrayBoolean(Parcel &parcel) const
 {
-    std::vector<int8_t> array;
-    PacMapGetArray<int8_t, AAFwk::Boolean, AAFwk::IBoolean>(value_, array);
+    const auto &value = std::get<std::vector<bool>>(value_);
+    std::vector<int8_t> array(value.begin(), value.end());
 
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_BOOLEAN);
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int8Vector, parcel, array);
@@ -445,8 +406,8 @@ bool PacMapNodeTypeArray::MarshallingArrayBoolean(Parcel &parcel) const
 
 bool PacMapNodeTypeArray::MarshallingArrayByte(Parcel &parcel) const
 {
-    std::vector<int8_t> array;
-    PacMapGetArray<int8_t, AAFwk::Byte, AAFwk::IByte>(value_, array);
+    const auto &value = std::get<std::vector<AAFwk::byte>>(value_);
+    std::vector<int8_t> array(value.begin(), value.end());
 
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_BYTE);
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int8Vector, parcel, array);
@@ -455,49 +416,29 @@ bool PacMapNodeTypeArray::MarshallingArrayByte(Parcel &parcel) const
 
 bool PacMapNodeTypeArray::MarshallingArrayShort(Parcel &parcel) const
 {
-    std::vector<short> array;
-    PacMapGetArray<short, AAFwk::Short, AAFwk::IShort>(value_, array);
-
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_SHORT);
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int16Vector, parcel, array);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int16Vector, parcel, std::get<std::vector<short>>(value_));
     return true;
 }
 
 bool PacMapNodeTypeArray::MarshallingArrayInteger(Parcel &parcel) const
 {
-    std::vector<int> array;
-    PacMapGetArray<int, AAFwk::Integer, AAFwk::IInteger>(value_, array);
-
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_INTEGER);
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32Vector, parcel, array);
-    return true;
+    return WriteArrayBuffer(parcel, PACMAP_DATA_ARRAY_INTEGER, std::get<std::vector<int>>(value_));
 }
 
 bool PacMapNodeTypeArray::MarshallingArrayLong(Parcel &parcel) const
 {
-    std::vector<long> array;
-    PacMapGetArray<long, AAFwk::Long, AAFwk::ILong>(value_, array);
-    return WriteLongVector(parcel, array);
+    return WriteArrayBuffer(parcel, PACMAP_DATA_ARRAY_LONG, std::get<std::vector<long>>(value_));
 }
 
 bool PacMapNodeTypeArray::MarshallingArrayFloat(Parcel &parcel) const
 {
-    std::vector<float> array;
-    PacMapGetArray<float, AAFwk::Float, AAFwk::IFloat>(value_, array);
-
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_FLOAT);
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(FloatVector, parcel, array);
-    return true;
+    return WriteArrayBuffer(parcel, PACMAP_DATA_ARRAY_FLOAT, std::get<std::vector<float>>(value_));
 }
 
 bool PacMapNodeTypeArray::MarshallingArrayDouble(Parcel &parcel) const
 {
-    std::vector<double> array;
-    PacMapGetArray<double, AAFwk::Double, AAFwk::IDouble>(value_, array);
-
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_DOUBLE);
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(DoubleVector, parcel, array);
-    return true;
+    return WriteArrayBuffer(parcel, PACMAP_DATA_ARRAY_DOUBLE, std::get<std::vector<double>>(value_));
 }
 
 /**
@@ -510,24 +451,25 @@ bool PacMapNodeTypeArray::Marshalling(const std::string &key, Parcel &parcel) co
 {
     WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(String16, parcel, Str8ToStr16(key));
 
-    if (AAFwk::Array::IsStringArray(value_)) {
-        return MarshallingArrayString(parcel);
-    } else if (AAFwk::Array::IsBooleanArray(value_)) {
-        return MarshallingArrayBoolean(parcel);
-    } else if (AAFwk::Array::IsByteArray(value_)) {
-        return MarshallingArrayByte(parcel);
-    } else if (AAFwk::Array::IsShortArray(value_)) {
-        return MarshallingArrayShort(parcel);
-    } else if (AAFwk::Array::IsIntegerArray(value_)) {
-        return MarshallingArrayInteger(parcel);
-    } else if (AAFwk::Array::IsLongArray(value_)) {
-        return MarshallingArrayLong(parcel);
-    } else if (AAFwk::Array::IsFloatArray(value_)) {
-        return MarshallingArrayFloat(parcel);
-    } else if (AAFwk::Array::IsDoubleArray(value_)) {
-        return MarshallingArrayDouble(parcel);
-    } else {
-        return false;
+    switch (value_.index()) {
+        case ARRAY_INDEX_SHORT:
+            return MarshallingArrayShort(parcel);
+        case ARRAY_INDEX_INTEGER:
+            return MarshallingArrayInteger(parcel);
+        case ARRAY_INDEX_LONG:
+            return MarshallingArrayLong(parcel);
+        case ARRAY_INDEX_BOOLEAN:
+            return MarshallingArrayBoolean(parcel);
+        case ARRAY_INDEX_BYTE:
+            return MarshallingArrayByte(parcel);
+        case ARRAY_INDEX_FLOAT:
+            return MarshallingArrayFloat(parcel);
+        case ARRAY_INDEX_DOUBLE:
+            return MarshallingArrayDouble(parcel);
+        case ARRAY_INDEX_STRING:
+            return MarshallingArrayString(parcel);
+        default:
+            return false;
     }
 }
 
@@ -535,67 +477,63 @@ bool PacMapNodeTypeArray::UnmarshallingArrayShort(Parcel &parcel)
 {
     std::vector<short> value;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int16Vector, parcel, &value);
-    PutShortValueArray(value);
+    value_ = std::move(value);
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayInteger(Parcel &parcel)
 {
     std::vector<int> value;
-    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32Vector, parcel, &value);
-    PutIntegerValueArray(value);
+    if (!ReadArrayBuffer(parcel, value)) {
+        return false;
+    }
+    value_ = std::move(value);
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayLong(Parcel &parcel)
 {
     std::vector<long> value;
-    if (!ReadLongVector(parcel, value)) {
+    if (!ReadArrayBuffer(parcel, value)) {
         return false;
     }
-    PutLongValueArray(value);
+    value_ = std::move(value);
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayByte(Parcel &parcel)
 {
     std::vector<int8_t> value;
-    std::vector<AAFwk::byte> byteValue;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int8Vector, parcel, &value);
-
-    for (int i = 0; i < (int)value.size(); i++) {
-        byteValue.push_back(value[i]);
-    }
-    PutByteValueArray(byteValue);
+    value_ = std::vector<AAFwk::byte>(value.begin(), value.end());
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayBoolean(Parcel &parcel)
 {
     std::vector<int8_t> value;
-    std::vector<bool> boolValue;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int8Vector, parcel, &value);
-
-    for (int i = 0; i < (int)value.size(); i++) {
-        boolValue.push_back((value[i] == 0) ? false : true);
-    }
-    PutBooleanValueArray(boolValue);
+    value_ = std::vector<bool>(value.begin(), value.end());
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayFloat(Parcel &parcel)
 {
     std::vector<float> value;
-    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(FloatVector, parcel, &value);
-    PutFloatValueArray(value);
+    if (!ReadArrayBuffer(parcel, value)) {
+        return false;
+    }
+    value_ = std::move(value);
     return true;
 }
 
 bool PacMapNodeTypeArray::UnmarshallingArrayDouble(Parcel &parcel)
 {
     std::vector<double> value;
-    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(DoubleVector, parcel, &value);
-    PutDoubleValueArray(value);
+    if (!ReadArrayBuffer(parcel, value)) {
+        return false;
+    }
+    value_ = std::move(value);
     return true;
 }
 
@@ -604,16 +542,13 @@ bool PacMapNodeTypeArray::UnmarshallingArrayString(Parcel &parcel)
     std::vector<std::u16string> value;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(String16Vector, parcel, &value);
 
-    std::vector<std::u16string>::size_type size = value.size();
-    value_ = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IString);
-    if (value_ != nullptr) {
-        for (std::vector<std::u16string>::size_type i = 0; i < size; i++) {
-            value_->Set(i, AAFwk::String::Box(Str16ToStr8(value[i])));
-        }
-        return true;
-    } else {
-        return false;
+    std::vector<std::string> array;
+    array.reserve(value.size());
+    for (const auto &item : value) {
+        array.emplace_back(Str16ToStr8(item));
     }
+    value_ = std::move(array);
+    return true;
 }
 
 /**
@@ -649,40 +584,5 @@ bool PacMapNodeTypeArray::Unmarshalling(int32_t dataType, Parcel &parcel)
     return true;
 }
 
-bool PacMapNodeTypeArray::WriteLongVector(Parcel &parcel, const std::vector<long> &value) const
-{
-    if (value.size() > INT_MAX) {
-        return false;
-    }
-
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, PACMAP_DATA_ARRAY_LONG);
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, value.size());
-    for (int i = 0; i < (int)value.size(); i++) {
-        long value_ = value[i];
-        if (!parcel.WriteBuffer((void *)&value_, sizeof(long))) {
-            return false;
-        }
-    }
-    return true;
-}
-
-bool PacMapNodeTypeArray::ReadLongVector(Parcel &parcel, std::vector<long> &value)
-{
-    int count = 0;
-    value.clear();
-    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL_ARRAY(Int32, parcel, count);
-
-    long *pvalue_ = nullptr;
-    for (auto i = 0; i < count; i++) {
-        const uint8_t *pdata = parcel.ReadBuffer(sizeof(long));
-        if (pdata != nullptr) {
-            pvalue_ = (long *)pdata;
-            value.push_back(*pvalue_);
-        } else {
-            return false;
-        }
-    }
-    return true;
-}
 }  // namespace AppExecFwk
 }  // namespace OHOS
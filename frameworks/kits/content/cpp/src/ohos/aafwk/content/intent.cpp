@@ -27,6 +27,7 @@
 #include "ohos/aafwk/base/string_wrapper.h"
 #include "ohos/aafwk/base/zchar_wrapper.h"
 #include "string_ex.h"
+#include "uri_codec.h"
 
 #include <climits>
 #include <securec.h>
@@ -43,11 +44,10 @@ const std::string Intent::ACTION_PLAY("action.system.play");
 const std::string Intent::ENTITY_HOME("entity.system.home");
 const std::string Intent::ENTITY_VIDEO("entity.system.video");
 
-const std::string Intent::OCT_EQUALSTO("075");   // '='
-const std::string Intent::OCT_SEMICOLON("073");  // ';'
-
 static constexpr int HEX_STRING_BUF_LEN = 12;
 static constexpr int HEX_STRING_LEN = 10;  // "0xffffffff"
+static constexpr size_t URI_FIXED_FIELD_COUNT = 6;  // action, entity, flag, device, bundle and ability
+static constexpr std::string_view INTENT_HEADER = "#Intent;";
 
 Intent::Intent() : flags_(0)
 {}
@@ -128,95 +128,26 @@ bool Intent::ParseFlag(const std::string &content, Intent &intent)
     return true;
 }
 
-std::string Intent::Decode(const std::string &str)
-{
-    std::string decode;
-
-    for (std::size_t i = 0; i < str.length();) {
-        if (str[i] == '\\') {
-            if (++i >= str.length()) {
-                decode += "\\";
-                break;
-            }
-            if (str[i] == '\\') {
-                decode += "\\";
-                i++;
-            } else if (str[i] == '0') {
-                if (str.compare(i, OCT_EQUALSTO.length(), OCT_EQUALSTO) == 0) {
-                    decode += "=";
-                    i += OCT_EQUALSTO.length();
-                } else if (str.compare(i, OCT_SEMICOLON.length(), OCT_SEMICOLON) == 0) {
-                    decode += ";";
-                    i += OCT_SEMICOLON.length();
-                } else {
-                    decode += "\\" + str.substr(i, 1);
-                    i++;
-                }
-            } else {
-                decode += "\\" + str.substr(i, 1);
-                i++;
-            }
-        } else {
-            decode += str[i];
-            i++;
-        }
-    }
-
-    return decode;
-}
-
-std::string Intent::Encode(const std::string &str)
-{
-    std::string encode;
-
-    for (std::size_t i = 0; i < str.length(); i++) {
-        if (str[i] == '\\') {
-            encode += "\\\\";
-        } else if (str[i] == '=') {
-            encode += "\\" + OCT_EQUALSTO;
-        } else if (str[i] == ';') {
-            encode += "\\" + OCT_SEMICOLON;
-        } else {
-            encode += str[i];
-        }
-    }
-
-    return encode;
-}
-
-bool Intent::ParseContent(const std::string &content, std::string &prop, std::string &value)
+bool Intent::ParseUriInternal(std::string_view content, ElementName &element, Intent &intent)
 {
-    std::string subString;
-    std::size_t pos = content.find("=");
-    if (pos != std::string::npos) {
-        subString = content.substr(0, pos);
-        prop = Decode(subString);
-        subString = content.substr(pos + 1, content.length() - pos - 1);
-        value = Decode(subString);
-        return true;
-    }
-    return false;
-}
-
-bool Intent::ParseUriInternal(const std::string &content, ElementName &element, Intent &intent)
-{
-    static constexpr int TYPE_TAG_SIZE = 2;
-
-    std::string prop;
-    std::string value;
+    std::string_view rawProp;
+    std::string_view rawValue;
 
     if (content.empty() || content[0] == '=') {
         return true;
     }
 
-    if (!ParseContent(content, prop, value)) {
+    if (!UriCodec::SplitField(content, rawProp, rawValue)) {
         return false;
     }
 
-    if (value.empty()) {
+    if (rawValue.empty()) {
         return true;
     }
 
+    std::string propStorage;
+    std::string_view prop = UriCodec::Decode(rawProp, propStorage);
+    std::string value = UriCodec::Decode(rawValue);
     if (prop == "action") {
         intent.SetAction(value);
     } else if (prop == "entity") {
@@ -231,68 +162,13 @@ bool Intent::ParseUriInternal(const std::string &content, ElementName &element,
         element.SetBundleName(value);
     } else if (prop == "ability") {
         element.SetAbilityName(value);
-    } else if (prop.length() > TYPE_TAG_SIZE) {
-        std::string key = prop.substr(TYPE_TAG_SIZE);
-        if (prop[0] == String::SIGNATURE && prop[1] == '.') {
-            sptr<IString> valueObj = String::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Boolean::SIGNATURE && prop[1] == '.') {
-            sptr<IBoolean> valueObj = Boolean::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Char::SIGNATURE && prop[1] == '.') {
-            sptr<IChar> valueObj = Char::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Byte::SIGNATURE && prop[1] == '.') {
-            sptr<IByte> valueObj = Byte::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Short::SIGNATURE && prop[1] == '.') {
-            sptr<IShort> valueObj = Short::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Integer::SIGNATURE && prop[1] == '.') {
-            sptr<IInteger> valueObj = Integer::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Long::SIGNATURE && prop[1] == '.') {
-            sptr<ILong> valueObj = Long::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Float::SIGNATURE && prop[1] == '.') {
-            sptr<IFloat> valueObj = Float::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Double::SIGNATURE && prop[1] == '.') {
-            sptr<IDouble> valueObj = Double::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
-        } else if (prop[0] == Array::SIGNATURE && prop[1] == '.') {
-            sptr<IArray> valueObj = Array::Parse(value);
-            if (valueObj == nullptr) {
-                return false;
-            }
-            intent.parameters_.SetParam(key, valueObj);
+    } else if (prop.length() > UriCodec::TYPE_TAG_SIZE && prop[1] == '.') {
+        sptr<IInterface> valueObj;
+        if (!UriCodec::ParseParam(prop[0], value, valueObj)) {
+            return false;
+        }
+        if (valueObj != nullptr) {
+            intent.parameters_.SetParam(std::string(prop.substr(UriCodec::TYPE_TAG_SIZE)), valueObj);
         }
     }
 
@@ -301,126 +177,70 @@ bool Intent::ParseUriInternal(const std::string &content, ElementName &element,
 
 Intent *Intent::ParseUri(const std::string &uri)
 {
-    if (uri.length() <= 0) {
-        return nullptr;
-    }
-
-    std::string head = "#Intent;";
-    std::string end = ";end";
-
-    if (uri.find(head) != 0) {
-        return nullptr;
-    }
-
-    if (uri.rfind(end) != (uri.length() - end.length())) {
+    std::string_view body;
+    if (!UriCodec::GetBody(uri, INTENT_HEADER, body)) {
         return nullptr;
     }
 
-    bool ret = true;
-    std::string content;
-    std::size_t pos;
-    std::size_t begin = head.length();
     ElementName element;
     Intent *intent = new Intent();
-
-    pos = uri.find_first_of(";", begin);
-    do {
-        if (pos != std::string::npos) {
-            content = uri.substr(begin, pos - begin);
-            ret = ParseUriInternal(content, element, *intent);
-            if (!ret) {
-                break;
-            }
-            begin = pos + 1;
-            pos = uri.find(";", begin);
-            if (pos == std::string::npos) {
-                break;
-            }
-        } else {
-            break;
+    std::string_view content;
+    while (UriCodec::NextField(body, content)) {
+        if (!ParseUriInternal(content, element, *intent)) {
+            delete intent;
+            return nullptr;
         }
-    } while (true);
-
-    if (ret) {
-        intent->SetElement(element);
-    } else {
-        delete intent;
-        intent = nullptr;
     }
-
+    intent->SetElement(element);
     return intent;
 }
 
 std::string Intent::ToUri()
 {
-    std::string uriString = "#Intent;";
+    std::string device = element_.GetDeviceID();
+    std::string bundle = element_.GetBundleName();
+    std::string ability = element_.GetAbilityName();
+    const std::map<std::string, sptr<IInterface>> &params = parameters_.GetParams();
 
+    // the fields are views of the strings above, the uri is written at once with its exact size.
+    std::vector<UriField> fields;
+    fields.reserve(URI_FIXED_FIELD_COUNT + params.size());
     if (action_.length() > 0) {
-        uriString += "action=" + Encode(action_) + ";";
+        fields.push_back({"", "action", action_});
     }
 
     if (entity_.length() > 0) {
-        uriString += "entity=" + Encode(entity_) + ";";
+        fields.push_back({"", "entity", entity_});
     }
 
+    char flag[HEX_STRING_BUF_LEN];
     if (flags_ != 0) {
-        uriString += "flag=";
-        char buf[HEX_STRING_BUF_LEN];
-        std::size_t len = snprintf_s(buf, sizeof(buf), HEX_STRING_LEN, "0x%08x", flags_);
+        std::size_t len = snprintf_s(flag, sizeof(flag), HEX_STRING_LEN, "0x%08x", flags_);
         if (len == HEX_STRING_LEN) {
-            std::string flag = buf;
-            uriString += Encode(flag);
-            uriString += ";";
+            fields.push_back({"", "flag", std::string_view(flag, len)});
         }
     }
 
-    std::string device = element_.GetDeviceID();
     if (device.length() > 0) {
-        uriString += "device=" + Encode(device) + ";";
+        fields.push_back({"", "device", device});
     }
 
-    std::string bundle = element_.GetBundleName();
     if (bundle.length() > 0) {
-        uriString += "bundle=" + Encode(bundle) + ";";
+        fields.push_back({"", "bundle", bundle});
     }
 
-    std::string ability = element_.GetAbilityName();
     if (ability.length() > 0) {
-        uriString += "ability=" + Encode(ability) + ";";
-    }
-
-    auto params = parameters_.GetParams();
-    auto iter = params.cbegin();
-    while (iter != params.cend()) {
-        sptr<IInterface> o = iter->second;
-        if (IString::Query(o) != nullptr) {
-            uriString += String::SIGNATURE;
-        } else if (IBoolean::Query(o) != nullptr) {
-            uriString += Boolean::SIGNATURE;
-        } else if (IChar::Query(o) != nullptr) {
-            uriString += Char::SIGNATURE;
-        } else if (IByte::Query(o) != nullptr) {
-            uriString += Byte::SIGNATURE;
-        } else if (IShort::Query(o) != nullptr) {
-            uriString += Short::SIGNATURE;
-        } else if (IInteger::Query(o) != nullptr) {
-            uriString += Integer::SIGNATURE;
-        } else if (ILong::Query(o) != nullptr) {
-            uriString += Long::SIGNATURE;
-        } else if (IFloat::Query(o) != nullptr) {
-            uriString += Float::SIGNATURE;
-        } else if (IDouble::Query(o) != nullptr) {
-            uriString += Double::SIGNATURE;
-        } else if (IArray::Query(o) != nullptr) {
-            uriString += Array::SIGNATURE;
-        }
-        uriString += "." + Encode(iter->first) + "=" + Encode(Object::ToString(*(o.GetRefPtr()))) + ";";
-        iter++;
+        fields.push_back({"", "ability", ability});
     }
 
-    uriString += "end";
-
-    return uriString;
+    std::vector<std::string> values;
+    values.reserve(params.size());
+    for (const auto &param : params) {
+        IInterface *value = param.second.GetRefPtr();
+        values.emplace_back(Object::ToString(*value));
+        fields.push_back({UriCodec::GetParamPrefix(value), param.first, values.back()});
+    }
+    return UriCodec::Build(INTENT_HEADER, fields);
 }
 
 /*
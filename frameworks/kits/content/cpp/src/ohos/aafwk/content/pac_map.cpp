@@ -14,26 +14,36 @@
  */
 
 #include "pac_map.h"
+
+#include <atomic>
+
 #include "parcel_macro.h"
 #include "string_ex.h"
 
 namespace OHOS {
 namespace AppExecFwk {
-#define PAC_MAP_ADD_BASE(id, key, value, mapList)                                       \
-    RemoveDataNode(key);                                                                \
+#define PAC_MAP_ADD_BASE(id, key, value)                                                \
+    PacMapList *mapList = GetMutableDataLocked();                                       \
+    if (mapList == nullptr) {                                                           \
+        return;                                                                         \
+    }                                                                                   \
     std::shared_ptr<PacMapNodeTypeBase> pnode = std::make_shared<PacMapNodeTypeBase>(); \
     pnode->Put##id##Value(value);                                                       \
-    mapList.emplace(key, pnode);
+    (*mapList)[key] = pnode;
 
-#define PAC_MAP_ADD_ARRAY(id, key, value, mapList)                                        \
-    RemoveDataNode(key);                                                                  \
+#define PAC_MAP_ADD_ARRAY(id, key, value)                                                 \
+    PacMapList *mapList = GetMutableDataLocked();                                         \
+    if (mapList == nullptr) {                                                             \
+        return;                                                                           \
+    }                                                                                     \
     std::shared_ptr<PacMapNodeTypeArray> pnode = std::make_shared<PacMapNodeTypeArray>(); \
     pnode->Put##id##ValueArray(value);                                                    \
-    mapList.emplace(key, pnode);
+    (*mapList)[key] = pnode;
 
-#define GET_PAC_MAP_BASE(id, mapList, key, defaultValue)                                 \
-    auto it = mapList.find(key);                                                         \
-    if (it != mapList.end()) {                                                           \
+#define GET_PAC_MAP_BASE(id, key, defaultValue)                                          \
+    std::shared_ptr<const PacMapList> mapList = GetData();                               \
+    auto it = mapList->find(key);                                                        \
+    if (it != mapList->end()) {                                                          \
         PacMapNodeTypeBase *pBase = static_cast<PacMapNodeTypeBase *>(it->second.get()); \
         if (pBase != nullptr) {                                                          \
             return pBase->Get##id##Value(defaultValue);                                  \
@@ -41,9 +51,10 @@ namespace AppExecFwk {
     }                                                                                    \
     return defaultValue;
 
-#define GET_PAC_MAP_ARRAY(id, mapList, key, value)                                          \
-    auto it = mapList.find(key);                                                            \
-    if (it != mapList.end()) {                                                              \
+#define GET_PAC_MAP_ARRAY(id, key, value)                                                   \
+    std::shared_ptr<const PacMapList> mapList = GetData();                                  \
+    auto it = mapList->find(key);                                                           \
+    if (it != mapList->end()) {                                                             \
         PacMapNodeTypeArray *pArray = static_cast<PacMapNodeTypeArray *>(it->second.get()); \
         if (pArray != nullptr) {                                                            \
             pArray->Get##id##ValueArray(value);                                             \
@@ -55,10 +66,12 @@ namespace AppExecFwk {
  */
 PacMap::PacMap(const PacMap &other)
 {
-    data_list_.clear();
-    DeepCopyData(data_list_, other.data_list_);
+    DeepCopyData(*data_list_, *other.GetData());
 }
 
+PacMap::PacMap(const std::shared_ptr<PacMapList> &data, bool readOnly) : data_list_(data), readOnly_(readOnly)
+{}
+
 PacMap::~PacMap()
 {
     Clear();
@@ -70,7 +83,15 @@ PacMap::~PacMap()
 PacMap &PacMap::operator=(const PacMap &other)
 {
     if (&other != this) {
-        ShallowCopyData(data_list_, other.data_list_);
+        std::shared_ptr<PacMapList> data;
+        {
+            std::lock_guard<std::mutex> otherLock(other.mapLock_);
+            data = other.data_list_;
+        }
+        std::lock_guard<std::mutex> mLock(mapLock_);
+        data_list_ = data;
+        // the assigned map is always writable, the data shared with a snapshot is copied before it is changed.
+        readOnly_ = false;
     }
     return *this;
 }
@@ -81,20 +102,21 @@ PacMap &PacMap::operator=(const PacMap &other)
 void PacMap::Clear(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    data_list_.clear();
+    if (!readOnly_) {
+        data_list_ = std::make_shared<PacMapList>();
+    }
 }
 
 /**
  * @brief Creates and returns a copy of this object with shallow copy.
+ * The data is shared until one of them is changed.
  *
  * @return A clone of this instance.
  */
 PacMap PacMap::Clone(void)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PacMap pac_map;
-    ShallowCopyData(pac_map.data_list_, data_list_);
-    return pac_map;
+    return PacMap(data_list_, false);
 }
 
 /**
@@ -104,12 +126,22 @@ PacMap PacMap::Clone(void)
  */
 PacMap PacMap::DeepCopy(void)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
     PacMap pac_map;
-    DeepCopyData(pac_map.data_list_, data_list_);
+    DeepCopyData(*pac_map.data_list_, *GetData());
     return pac_map;
 }
 
+/**
+ * @brief Creates a read-only snapshot sharing the data of this PacMap.
+ *
+ * @return A snapshot of this instance.
+ */
+PacMap PacMap::Snapshot(void) const
+{
+    std::lock_guard<std::mutex> mLock(mapLock_);
+    return PacMap(data_list_, true);
+}
+
 /**
  * @brief Adds a short value matching a specified key.
  * @param key A specified key.
@@ -118,7 +150,7 @@ PacMap PacMap::DeepCopy(void)
 void PacMap::PutShortValue(const std::string &key, short value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Short, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Short, key, value);
 }
 
 /**
@@ -129,7 +161,7 @@ void PacMap::PutShortValue(const std::string &key, short value)
 void PacMap::PutIntValue(const std::string &key, int value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Int, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Int, key, value);
 }
 
 /**
@@ -140,7 +172,7 @@ void PacMap::PutIntValue(const std::string &key, int value)
 void PacMap::PutLongValue(const std::string &key, long value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Long, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Long, key, value);
 }
 
 /**
@@ -151,7 +183,7 @@ void PacMap::PutLongValue(const std::string &key, long value)
 void PacMap::PutBooleanValue(const std::string &key, bool value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Boolean, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Boolean, key, value);
 }
 
 /**
@@ -162,7 +194,7 @@ void PacMap::PutBooleanValue(const std::string &key, bool value)
 void PacMap::PutCharValue(const std::string &key, char value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Char, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Char, key, value);
 }
 
 /**
@@ -173,7 +205,7 @@ void PacMap::PutCharValue(const std::string &key, char value)
 void PacMap::PutByteValue(const std::string &key, AAFwk::byte value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Byte, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Byte, key, value);
 }
 
 /**
@@ -184,7 +216,7 @@ void PacMap::PutByteValue(const std::string &key, AAFwk::byte value)
 void PacMap::PutFloatValue(const std::string &key, float value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Float, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Float, key, value);
 }
 
 /**
@@ -195,7 +227,7 @@ void PacMap::PutFloatValue(const std::string &key, float value)
 void PacMap::PutDoubleValue(const std::string &key, double value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(Double, key, value, data_list_);
+    PAC_MAP_ADD_BASE(Double, key, value);
 }
 
 /**
@@ -206,7 +238,7 @@ void PacMap::PutDoubleValue(const std::string &key, double value)
 void PacMap::PutStringValue(const std::string &key, const std::string &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_BASE(String, key, value, data_list_);
+    PAC_MAP_ADD_BASE(String, key, value);
 }
 
 /**
@@ -217,10 +249,13 @@ void PacMap::PutStringValue(const std::string &key, const std::string &value)
 void PacMap::PutObject(const std::string &key, const std::shared_ptr<TUserMapObject> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    RemoveDataNode(key);
+    PacMapList *mapList = GetMutableDataLocked();
+    if (mapList == nullptr) {
+        return;
+    }
     std::shared_ptr<PacMapNodeTypeObject> pnode = std::make_shared<PacMapNodeTypeObject>();
     pnode->PutObject(value);
-    data_list_.emplace(key, pnode);
+    (*mapList)[key] = pnode;
 }
 
 /**
@@ -231,7 +266,7 @@ void PacMap::PutObject(const std::string &key, const std::shared_ptr<TUserMapObj
 void PacMap::PutShortValueArray(const std::string &key, const std::vector<short> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Short, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Short, key, value);
 }
 
 /**
@@ -242,7 +277,7 @@ void PacMap::PutShortValueArray(const std::string &key, const std::vector<short>
 void PacMap::PutIntValueArray(const std::string &key, const std::vector<int> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Integer, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Integer, key, value);
 }
 
 /**
@@ -253,7 +288,7 @@ void PacMap::PutIntValueArray(const std::string &key, const std::vector<int> &va
 void PacMap::PutLongValueArray(const std::string &key, const std::vector<long> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Long, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Long, key, value);
 }
 
 /**
@@ -264,7 +299,7 @@ void PacMap::PutLongValueArray(const std::string &key, const std::vector<long> &
 void PacMap::PutBooleanValueArray(const std::string &key, const std::vector<bool> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Boolean, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Boolean, key, value);
 }
 
 /**
@@ -275,7 +310,7 @@ void PacMap::PutBooleanValueArray(const std::string &key, const std::vector<bool
 void PacMap::PutCharValueArray(const std::string &key, const std::vector<char> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Char, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Char, key, value);
 }
 
 /**
@@ -286,7 +321,7 @@ void PacMap::PutCharValueArray(const std::string &key, const std::vector<char> &
 void PacMap::PutByteValueArray(const std::string &key, const std::vector<AAFwk::byte> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Byte, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Byte, key, value);
 }
 
 /**
@@ -297,7 +332,7 @@ void PacMap::PutByteValueArray(const std::string &key, const std::vector<AAFwk::
 void PacMap::PutFloatValueArray(const std::string &key, const std::vector<float> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Float, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Float, key, value);
 }
 
 /**
@@ -308,7 +343,7 @@ void PacMap::PutFloatValueArray(const std::string &key, const std::vector<float>
 void PacMap::PutDoubleValueArray(const std::string &key, const std::vector<double> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(Double, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(Double, key, value);
 }
 
 /**
@@ -319,7 +354,7 @@ void PacMap::PutDoubleValueArray(const std::string &key, const std::vector<doubl
 void PacMap::PutStringValueArray(const std::string &key, const std::vector<std::string> &value)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    PAC_MAP_ADD_ARRAY(String, key, value, data_list_);
+    PAC_MAP_ADD_ARRAY(String, key, value);
 }
 
 /**
@@ -329,9 +364,12 @@ void PacMap::PutStringValueArray(const std::string &key, const std::vector<std::
  */
 void PacMap::PutAll(const std::map<std::string, PacMapObject::Object> &mapData)
 {
+    std::shared_ptr<PacMapList> data = std::make_shared<PacMapList>();
+    DeepCopyData(*data, mapData);
     std::lock_guard<std::mutex> mLock(mapLock_);
-    data_list_.clear();
-    DeepCopyData(data_list_, mapData);
+    if (!readOnly_) {
+        data_list_ = data;
+    }
 }
 
 /**
@@ -340,9 +378,12 @@ void PacMap::PutAll(const std::map<std::string, PacMapObject::Object> &mapData)
  */
 void PacMap::PutAll(PacMap &pacMap)
 {
+    std::shared_ptr<PacMapList> data = std::make_shared<PacMapList>();
+    DeepCopyData(*data, *pacMap.GetData());
     std::lock_guard<std::mutex> mLock(mapLock_);
-    data_list_.clear();
-    DeepCopyData(data_list_, pacMap.data_list_);
+    if (!readOnly_) {
+        data_list_ = data;
+    }
 }
 
 /**
@@ -353,8 +394,7 @@ void PacMap::PutAll(PacMap &pacMap)
  */
 int PacMap::GetIntValue(const std::string &key, int defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Integer, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Integer, key, defaultValue);
 }
 
 /**
@@ -365,8 +405,7 @@ int PacMap::GetIntValue(const std::string &key, int defaultValue)
  */
 short PacMap::GetShortValue(const std::string &key, short defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Short, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Short, key, defaultValue);
 }
 
 /**
@@ -377,8 +416,7 @@ short PacMap::GetShortValue(const std::string &key, short defaultValue)
  */
 bool PacMap::GetBooleanValue(const std::string &key, bool defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Boolean, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Boolean, key, defaultValue);
 }
 
 /**
@@ -389,8 +427,7 @@ bool PacMap::GetBooleanValue(const std::string &key, bool defaultValue)
  */
 long PacMap::GetLongValue(const std::string &key, long defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Long, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Long, key, defaultValue);
 }
 
 /**
@@ -401,8 +438,7 @@ long PacMap::GetLongValue(const std::string &key, long defaultValue)
  */
 char PacMap::GetCharValue(const std::string &key, char defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Char, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Char, key, defaultValue);
 }
 
 /**
@@ -413,8 +449,7 @@ char PacMap::GetCharValue(const std::string &key, char defaultValue)
  */
 AAFwk::byte PacMap::GetByteValue(const std::string &key, AAFwk::byte defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Byte, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Byte, key, defaultValue);
 }
 
 /**
@@ -425,8 +460,7 @@ AAFwk::byte PacMap::GetByteValue(const std::string &key, AAFwk::byte defaultValu
  */
 float PacMap::GetFloatValue(const std::string &key, float defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Float, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Float, key, defaultValue);
 }
 
 /**
@@ -437,8 +471,7 @@ float PacMap::GetFloatValue(const std::string &key, float defaultValue)
  */
 double PacMap::GetDoubleValue(const std::string &key, double defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(Double, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(Double, key, defaultValue);
 }
 
 /**
@@ -449,8 +482,7 @@ double PacMap::GetDoubleValue(const std::string &key, double defaultValue)
  */
 std::string PacMap::GetStringValue(const std::string &key, const std::string &defaultValue)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_BASE(String, data_list_, key, defaultValue);
+    GET_PAC_MAP_BASE(String, key, defaultValue);
 }
 
 /**
@@ -460,8 +492,7 @@ std::string PacMap::GetStringValue(const std::string &key, const std::string &de
  */
 void PacMap::GetIntValueArray(const std::string &key, std::vector<int> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Integer, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Integer, key, value);
 }
 
 /**
@@ -471,8 +502,7 @@ void PacMap::GetIntValueArray(const std::string &key, std::vector<int> &value)
  */
 void PacMap::GetShortValueArray(const std::string &key, std::vector<short> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Short, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Short, key, value);
 }
 
 /**
@@ -482,8 +512,7 @@ void PacMap::GetShortValueArray(const std::string &key, std::vector<short> &valu
  */
 void PacMap::GetBooleanValueArray(const std::string &key, std::vector<bool> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Boolean, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Boolean, key, value);
 }
 
 /**
@@ -493,8 +522,7 @@ void PacMap::GetBooleanValueArray(const std::string &key, std::vector<bool> &val
  */
 void PacMap::GetLongValueArray(const std::string &key, std::vector<long> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Long, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Long, key, value);
 }
 
 /**
@@ -504,8 +532,7 @@ void PacMap::GetLongValueArray(const std::string &key, std::vector<long> &value)
  */
 void PacMap::GetCharValueArray(const std::string &key, std::vector<char> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Char, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Char, key, value);
 }
 
 /**
@@ -515,8 +542,7 @@ void PacMap::GetCharValueArray(const std::string &key, std::vector<char> &value)
  */
 void PacMap::GetByteValueArray(const std::string &key, std::vector<AAFwk::byte> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Byte, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Byte, key, value);
 }
 
 /**
@@ -526,8 +552,7 @@ void PacMap::GetByteValueArray(const std::string &key, std::vector<AAFwk::byte>
  */
 void PacMap::GetFloatValueArray(const std::string &key, std::vector<float> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Float, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Float, key, value);
 }
 
 /**
@@ -537,8 +562,7 @@ void PacMap::GetFloatValueArray(const std::string &key, std::vector<float> &valu
  */
 void PacMap::GetDoubleValueArray(const std::string &key, std::vector<double> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(Double, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(Double, key, value);
 }
 
 /**
@@ -548,8 +572,7 @@ void PacMap::GetDoubleValueArray(const std::string &key, std::vector<double> &va
  */
 void PacMap::GetStringValueArray(const std::string &key, std::vector<std::string> &value)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    GET_PAC_MAP_ARRAY(String, data_list_, key, value);
+    GET_PAC_MAP_ARRAY(String, key, value);
 }
 
 /**
@@ -559,9 +582,9 @@ void PacMap::GetStringValueArray(const std::string &key, std::vector<std::string
  */
 std::shared_ptr<TUserMapObject> PacMap::GetObject(const std::string &key)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    auto it = data_list_.find(key);
-    if (it == data_list_.end()) {
+    std::shared_ptr<const PacMapList> mapList = GetData();
+    auto it = mapList->find(key);
+    if (it == mapList->end()) {
         return nullptr;
     }
 
@@ -580,10 +603,8 @@ std::shared_ptr<TUserMapObject> PacMap::GetObject(const std::string &key)
  */
 std::map<std::string, PacMapObject::Object> PacMap::GetAll(void)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-
     PacMapList tmpMapList;
-    ShallowCopyData(tmpMapList, this->data_list_);
+    ShallowCopyData(tmpMapList, *GetData());
     return tmpMapList;
 }
 
@@ -614,12 +635,28 @@ void PacMap::ShallowCopyData(PacMapList &desPacMapList, const PacMapList &srcPac
     }
 }
 
-void PacMap::RemoveDataNode(const std::string &key)
+std::shared_ptr<const PacMapList> PacMap::GetData(void) const
+{
+    // the data of a snapshot is never changed.
+    if (readOnly_) {
+        return data_list_;
+    }
+    std::lock_guard<std::mutex> mLock(mapLock_);
+    return data_list_;
+}
+
+PacMapList *PacMap::GetMutableDataLocked(void)
 {
-    auto it = data_list_.find(key);
-    if (it != data_list_.end()) {
-        data_list_.erase(it);
+    if (readOnly_) {
+        return nullptr;
+    }
+    // the data still read by a snapshot or a running reader is kept as it is, the copy is changed instead.
+    if (data_list_.use_count() > 1) {
+        data_list_ = std::make_shared<PacMapList>(*data_list_);
     }
+    // the reads of the reader which released the data happen before the changes.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return data_list_.get();
 }
 
 bool PacMap::EqualPacMapData(const PacMapList &leftPacMapList, const PacMapList &rightPacMapList)
@@ -654,7 +691,6 @@ bool PacMap::EqualPacMapData(const PacMapList &leftPacMapList, const PacMapList
  */
 bool PacMap::Equals(const PacMap *pacMap)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
     if (pacMap == nullptr) {
         return false;
     }
@@ -663,11 +699,17 @@ bool PacMap::Equals(const PacMap *pacMap)
         return true;
     }
 
-    if (data_list_.size() != pacMap->data_list_.size()) {
+    std::shared_ptr<const PacMapList> left = GetData();
+    std::shared_ptr<const PacMapList> right = pacMap->GetData();
+    if (left == right) {
+        return true;
+    }
+
+    if (left->size() != right->size()) {
         return false;
     }
 
-    if (!EqualPacMapData(data_list_, pacMap->data_list_)) {
+    if (!EqualPacMapData(*left, *right)) {
         return false;
     }
 
@@ -685,7 +727,7 @@ bool PacMap::Equals(const PacMap &pacMap)
  */
 bool PacMap::IsEmpty(void) const
 {
-    return data_list_.empty();
+    return GetData()->empty();
 }
 
 /**
@@ -694,7 +736,7 @@ bool PacMap::IsEmpty(void) const
  */
 int PacMap::GetSize(void) const
 {
-    return data_list_.size();
+    return GetData()->size();
 }
 
 /**
@@ -702,10 +744,10 @@ int PacMap::GetSize(void) const
  */
 const std::set<std::string> PacMap::GetKeys(void)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
+    std::shared_ptr<const PacMapList> mapList = GetData();
     std::set<std::string> keys;
 
-    for (auto it = data_list_.begin(); it != data_list_.end(); it++) {
+    for (auto it = mapList->begin(); it != mapList->end(); it++) {
         keys.emplace(it->first);
     }
     return keys;
@@ -718,8 +760,8 @@ const std::set<std::string> PacMap::GetKeys(void)
  */
 bool PacMap::HasKey(const std::string &key)
 {
-    std::lock_guard<std::mutex> mLock(mapLock_);
-    return (data_list_.find(key) != data_list_.end());
+    std::shared_ptr<const PacMapList> mapList = GetData();
+    return (mapList->find(key) != mapList->end());
 }
 
 /**
@@ -729,9 +771,9 @@ bool PacMap::HasKey(const std::string &key)
 void PacMap::Remove(const std::string &key)
 {
     std::lock_guard<std::mutex> mLock(mapLock_);
-    auto it = data_list_.find(key);
-    if (it != data_list_.end()) {
-        data_list_.erase(it);
+    PacMapList *mapList = GetMutableDataLocked();
+    if (mapList != nullptr) {
+        mapList->erase(key);
     }
 }
 
@@ -770,7 +812,7 @@ bool PacMap::ReadBaseFromParcel(const std::string &key, int32_t dataType, Parcel
 {
     std::shared_ptr<PacMapNodeTypeBase> pnode = std::make_shared<PacMapNodeTypeBase>();
     if (pnode->Unmarshalling(dataType, parcel)) {
-        data_list_.emplace(key, pnode);
+        data_list_->emplace(key, pnode);
         return true;
     }
     return false;
@@ -780,7 +822,7 @@ bool PacMap::ReadArrayFromParcel(const std::string &key, int32_t dataType, Parce
 {
     std::shared_ptr<PacMapNodeTypeArray> pnode = std::make_shared<PacMapNodeTypeArray>();
     if (pnode->Unmarshalling(dataType, parcel)) {
-        data_list_.emplace(key, pnode);
+        data_list_->emplace(key, pnode);
         return true;
     }
     return false;
@@ -790,7 +832,7 @@ bool PacMap::ReadObjectFromParcel(const std::string &key, int32_t dataType, Parc
 {
     std::shared_ptr<PacMapNodeTypeObject> pnode = std::make_shared<PacMapNodeTypeObject>();
     if (pnode->Unmarshalling(dataType, parcel)) {
-        data_list_.emplace(key, pnode);
+        data_list_->emplace(key, pnode);
         return true;
     }
     return false;
@@ -805,6 +847,12 @@ bool PacMap::ReadFromParcel(Parcel &parcel)
     // read element count
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, size);
 
+    // the nodes read are added to data_list_ directly, it is not shared while the lock is held.
+    std::lock_guard<std::mutex> mLock(mapLock_);
+    if (GetMutableDataLocked() == nullptr) {
+        return false;
+    }
+
     for (int32_t i = 0; i < size; i++) {
         std::string key;
         data_type = 0;
@@ -844,14 +892,15 @@ bool PacMap::ReadFromParcel(Parcel &parcel)
  */
 bool PacMap::Marshalling(Parcel &parcel) const
 {
+    std::shared_ptr<const PacMapList> mapList = GetData();
     // write element count
-    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, data_list_.size());
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, mapList->size());
 
-    if (IsEmpty()) {
+    if (mapList->empty()) {
         return true;
     }
 
-    for (auto it = data_list_.begin(); it != data_list_.end(); it++) {
+    for (auto it = mapList->begin(); it != mapList->end(); it++) {
         if (it->second->IsBase()) {
             if (!WriteBaseToParcel(it->first, it->second, parcel)) {
                 return false;
@@ -14,11 +14,118 @@
  */
 
 #include "ohos/aafwk/content/patterns_matcher.h"
+
+#include <cctype>
+#include <cstring>
+#include <vector>
+
 #include "parcel_macro.h"
 using namespace OHOS::AppExecFwk;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+// characters which make a PATTERN type pattern fall back to std::regex.
+const char *const REGEX_SPECIAL_CHARS = "[](){}|+?^$";
+}  // namespace
+
+/**
+ * @struct CompiledPattern
+ * CompiledPattern is a PATTERN type pattern compiled once. A pattern made of literals, '.', '*' and escaped
+ * punctuations is matched by a small automaton, others by std::regex.
+ */
+struct PatternsMatcher::CompiledPattern {
+    struct Token {
+        bool any;
+        bool repeat;
+        char ch;
+
+        bool Accepts(char c) const
+        {
+            // '.' of ECMAScript does not match line terminators.
+            return any ? (c != '\n' && c != '\r') : (c == ch);
+        }
+    };
+
+    bool simple = true;
+    std::vector<Token> tokens;
+    std::regex regex;
+
+    static std::shared_ptr<const CompiledPattern> Compile(std::string_view pattern);
+    bool Match(std::string_view str) const;
+    void Closure(std::vector<char> &states) const;
+};
+
+std::shared_ptr<const PatternsMatcher::CompiledPattern> PatternsMatcher::CompiledPattern::Compile(
+    std::string_view pattern)
+{
+    auto compiled = std::make_shared<CompiledPattern>();
+    for (size_t i = 0; i < pattern.length() && compiled->simple; i++) {
+        char c = pattern[i];
+        if (c == '*') {
+            if (compiled->tokens.empty() || compiled->tokens.back().repeat) {
+                compiled->simple = false;
+            } else {
+                compiled->tokens.back().repeat = true;
+            }
+        } else if (c == '\\') {
+            // escaped letters and digits are character classes or back references.
+            if (i + 1 >= pattern.length() || std::isalnum(static_cast<unsigned char>(pattern[i + 1]))) {
+                compiled->simple = false;
+            } else {
+                compiled->tokens.push_back({false, false, pattern[++i]});
+            }
+        } else if (c == '\0' || std::strchr(REGEX_SPECIAL_CHARS, c) != nullptr) {
+            compiled->simple = false;
+        } else {
+            compiled->tokens.push_back({c == '.', false, c});
+        }
+    }
+    if (!compiled->simple) {
+        compiled->tokens.clear();
+        compiled->regex = std::regex(pattern.begin(), pattern.end());
+    }
+    return compiled;
+}
+
+void PatternsMatcher::CompiledPattern::Closure(std::vector<char> &states) const
+{
+    // a repeated token may match nothing, so the state after it is reachable as well.
+    for (size_t i = 0; i < tokens.size(); i++) {
+        if (states[i] && tokens[i].repeat) {
+            states[i + 1] = true;
+        }
+    }
+}
+
+bool PatternsMatcher::CompiledPattern::Match(std::string_view str) const
+{
+    if (!simple) {
+        return std::regex_match(str.begin(), str.end(), regex);
+    }
+
+    // simulate all the token positions at once, linear in the length of str.
+    std::vector<char> current(tokens.size() + 1, false);
+    std::vector<char> next(tokens.size() + 1, false);
+    current[0] = true;
+    Closure(current);
+    for (char c : str) {
+        bool alive = false;
+        std::fill(next.begin(), next.end(), false);
+        for (size_t i = 0; i < tokens.size(); i++) {
+            if (current[i] && tokens[i].Accepts(c)) {
+                next[tokens[i].repeat ? i : i + 1] = true;
+                alive = true;
+            }
+        }
+        if (!alive) {
+            return false;
+        }
+        Closure(next);
+        current.swap(next);
+    }
+    return current[tokens.size()];
+}
 
 /**
  * @brief A parameterized constructor used to create a PatternsMatcher instance.
@@ -39,6 +146,7 @@ PatternsMatcher::PatternsMatcher(const PatternsMatcher &patternsMatcher)
 {
     pattern_ = patternsMatcher.GetPattern();
     type_ = patternsMatcher.GetType();
+    compiledPattern_ = std::atomic_load(&patternsMatcher.compiledPattern_);
 }
 
 /**
@@ -77,14 +185,49 @@ MatchType PatternsMatcher::GetType() const
 }
 
 /**
- * @brief Match this PatternsMatcher against a string data.
+ * @brief Match this PatternsMatcher against a string data. A PATTERN type pattern is compiled on the first
+ * match and the compiled pattern is kept for the later ones.
+ *
+ * @param str The desired string to look for.
+ * @return Returns either a valid match constant.
+ */
+bool PatternsMatcher::match(std::string_view match) const
+{
+    if (type_ != MatchType::PATTERN) {
+        return MatchPattern(pattern_, match, type_);
+    }
+    if (match.empty()) {
+        return false;
+    }
+    return GetCompiledPattern()->Match(match);
+}
+
+/**
+ * @brief Match this PatternsMatcher against a string data. Kept for the callers built against the old
+ * signature, it calls match(std::string_view).
  *
  * @param str The desired string to look for.
  * @return Returns either a valid match constant.
  */
 bool PatternsMatcher::match(std::string match)
 {
-    return MatchPattern(pattern_, match, type_);
+    return static_cast<const PatternsMatcher *>(this)->match(std::string_view(match));
+}
+
+/**
+ * @brief Obtains the compiled pattern of a PATTERN type pattern, compiles it on the first call.
+ *
+ * @return Returns the compiled pattern.
+ */
+std::shared_ptr<const PatternsMatcher::CompiledPattern> PatternsMatcher::GetCompiledPattern() const
+{
+    auto compiled = std::atomic_load(&compiledPattern_);
+    if (compiled == nullptr) {
+        // racing threads compile the same pattern, whichever stored last wins.
+        compiled = CompiledPattern::Compile(pattern_);
+        std::atomic_store(&compiledPattern_, compiled);
+    }
+    return compiled;
 }
 
 /**
@@ -96,7 +239,7 @@ bool PatternsMatcher::match(std::string match)
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, MatchType type)
+bool PatternsMatcher::MatchPattern(std::string_view pattern, std::string_view match, MatchType type)
 {
     if (match.empty()) {
         return false;
@@ -106,11 +249,10 @@ bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, Match
             return pattern == match;
         }
         case MatchType::PREFIX: {
-            return match.find(pattern) == 0;
+            return match.compare(0, pattern.length(), pattern) == 0;
         }
         case MatchType::PATTERN: {
-            std::regex regex_(pattern);
-            return regex_match(match, regex_);
+            return CompiledPattern::Compile(pattern)->Match(match);
         }
         case MatchType::GLOBAL: {
             return GlobPattern(pattern, match);
@@ -130,16 +272,16 @@ bool PatternsMatcher::MatchPattern(std::string pattern, std::string match, Match
  *
  * @return Returns either a valid match constant.
  */
-bool PatternsMatcher::GlobPattern(std::string pattern, std::string match)
+bool PatternsMatcher::GlobPattern(std::string_view pattern, std::string_view match)
 {
     size_t indexP = 0;
     size_t find_pos = 0;
     size_t indexM = 0;
-    while (indexP < pattern.length() && find_pos != std::string::npos) {
-        find_pos = pattern.find("*", indexP);
-        std::string p;
-        if (find_pos == std::string::npos) {
-            p = pattern.substr(indexP, pattern.length());
+    while (indexP < pattern.length() && find_pos != std::string_view::npos) {
+        find_pos = pattern.find('*', indexP);
+        std::string_view p;
+        if (find_pos == std::string_view::npos) {
+            p = pattern.substr(indexP);
         } else {
             p = pattern.substr(indexP, find_pos - indexP);
         }
@@ -148,13 +290,13 @@ bool PatternsMatcher::GlobPattern(std::string pattern, std::string match)
             continue;
         }
         size_t find_pos_m = match.find(p, indexM);
-        if (find_pos_m == std::string::npos) {
+        if (find_pos_m == std::string_view::npos) {
             return false;
         }
         indexP = find_pos;
         indexM = find_pos_m + p.length();
     }
-    if (indexM < match.length() && !(pattern.rfind("*") == pattern.length() - 1)) {
+    if (indexM < match.length() && !(pattern.rfind('*') == pattern.length() - 1)) {
         return false;
     }
     return true;
@@ -201,6 +343,7 @@ bool PatternsMatcher::ReadFromParcel(Parcel &parcel)
     int32_t type;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, type);
     type_ = static_cast<MatchType>(type);
+    std::atomic_store(&compiledPattern_, std::shared_ptr<const CompiledPattern>());
 
     return true;
 }
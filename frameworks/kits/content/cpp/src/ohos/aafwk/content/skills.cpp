@@ -14,13 +14,18 @@
  */
 
 #include "ohos/aafwk/content/skills.h"
+
+#include <deque>
+#include <string_view>
+#include <unordered_set>
+
 #include "parcel_macro.h"
 using namespace OHOS;
 using namespace OHOS::AppExecFwk;
 namespace OHOS {
 namespace AAFwk {
 
-const int LENGTH_FOR_FINDMINETYPE = 3;
+const size_t LENGTH_FOR_FINDMINETYPE = 3;
 /**
  * @brief Default constructor used to create a Skills instance.
  */
@@ -49,6 +54,9 @@ Skills::Skills(const Skills &skills)
     schemeSpecificParts_ = skills.schemeSpecificParts_;
     // types_
     types_ = skills.types_;
+    hasPartialTypes_ = skills.hasPartialTypes_;
+    // the index is immutable, share it until either side changes.
+    matchIndex_ = skills.matchIndex_;
 }
 
 Skills::~Skills()
@@ -93,6 +101,7 @@ std::string Skills::GetEntity(int index) const
  */
 void Skills::AddEntity(const std::string &entity)
 {
+    matchIndex_ = nullptr;
     auto it = std::find(entities_.begin(), entities_.end(), entity);
     if (it == entities_.end()) {
         entities_.emplace_back(entity);
@@ -116,6 +125,7 @@ bool Skills::HasEntity(const std::string &entity)
  */
 void Skills::RemoveEntity(const std::string &entity)
 {
+    matchIndex_ = nullptr;
     if (!entities_.empty()) {
         auto it = std::find(entities_.begin(), entities_.end(), entity);
         if (it != entities_.end()) {
@@ -154,6 +164,7 @@ std::string Skills::GetAction(int index) const
  */
 void Skills::AddAction(const std::string &action)
 {
+    matchIndex_ = nullptr;
     auto it = std::find(actions_.begin(), actions_.end(), action);
     if (it == actions_.end()) {
         actions_.emplace_back(action);
@@ -177,6 +188,7 @@ bool Skills::HasAction(const std::string &action)
  */
 void Skills::RemoveAction(const std::string &action)
 {
+    matchIndex_ = nullptr;
     if (!actions_.empty()) {
         auto it = std::find(actions_.begin(), actions_.end(), action);
         if (it != actions_.end()) {
@@ -201,6 +213,7 @@ int Skills::CountActions() const
  */
 std::vector<std::string>::iterator Skills::ActionsIterator()
 {
+    matchIndex_ = nullptr;
     return actions_.begin();
 }
 
@@ -225,6 +238,7 @@ std::string Skills::GetAuthority(int index) const
  */
 void Skills::AddAuthority(const std::string &authority)
 {
+    matchIndex_ = nullptr;
     auto it = std::find(authorities_.begin(), authorities_.end(), authority);
     if (it == authorities_.end()) {
         authorities_.emplace_back(authority);
@@ -248,6 +262,7 @@ bool Skills::HasAuthority(const std::string &authority)
  */
 void Skills::RemoveAuthority(const std::string &authority)
 {
+    matchIndex_ = nullptr;
     if (!authorities_.empty()) {
         auto it = std::find(authorities_.begin(), authorities_.end(), authority);
         if (it != authorities_.end()) {
@@ -285,6 +300,7 @@ std::string Skills::GetPath(int index) const
  */
 void Skills::AddPath(const std::string &path)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(path, MatchType::DEFAULT);
     AddPath(pm);
 }
@@ -296,7 +312,8 @@ void Skills::AddPath(const std::string &path)
  */
 void Skills::AddPath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    matchIndex_ = nullptr;
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -313,6 +330,7 @@ void Skills::AddPath(const PatternsMatcher &patternsMatcher)
  */
 void Skills::AddPath(const std::string &path, const MatchType &matchType)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(path, matchType);
     AddPath(pm);
 }
@@ -325,7 +343,7 @@ void Skills::AddPath(const std::string &path, const MatchType &matchType)
 bool Skills::HasPath(const std::string &path)
 {
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
     return hasPath != paths_.end();
 }
 
@@ -336,8 +354,9 @@ bool Skills::HasPath(const std::string &path)
  */
 void Skills::RemovePath(const std::string &path)
 {
+    matchIndex_ = nullptr;
     auto hasPath = std::find_if(
-        paths_.begin(), paths_.end(), [&path](const PatternsMatcher pm) { return pm.GetPattern() == path; });
+        paths_.begin(), paths_.end(), [&path](const PatternsMatcher &pm) { return pm.GetPattern() == path; });
 
     if (hasPath != paths_.end()) {
         paths_.erase(hasPath);
@@ -351,7 +370,8 @@ void Skills::RemovePath(const std::string &path)
  */
 void Skills::RemovePath(const PatternsMatcher &patternsMatcher)
 {
-    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    matchIndex_ = nullptr;
+    auto hasPath = std::find_if(paths_.begin(), paths_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -368,6 +388,7 @@ void Skills::RemovePath(const PatternsMatcher &patternsMatcher)
  */
 void Skills::RemovePath(const std::string &path, const MatchType &matchType)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(path, matchType);
     RemovePath(pm);
 }
@@ -401,6 +422,7 @@ std::string Skills::GetScheme(int index) const
  */
 void Skills::AddScheme(const std::string &scheme)
 {
+    matchIndex_ = nullptr;
     auto it = std::find(schemes_.begin(), schemes_.end(), scheme);
     if (it == schemes_.end()) {
         schemes_.emplace_back(scheme);
@@ -424,6 +446,7 @@ bool Skills::HasScheme(const std::string &scheme)
  */
 void Skills::RemoveScheme(const std::string &scheme)
 {
+    matchIndex_ = nullptr;
     if (!schemes_.empty()) {
         auto it = std::find(schemes_.begin(), schemes_.end(), scheme);
         if (it != schemes_.end()) {
@@ -461,9 +484,10 @@ std::string Skills::GetSchemeSpecificPart(int index) const
  */
 void Skills::AddSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher patternsMatcher(schemeSpecificPart, MatchType::DEFAULT);
     auto it = std::find_if(
-        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+        schemeSpecificParts_.begin(), schemeSpecificParts_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
             return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
         });
 
@@ -481,7 +505,7 @@ bool Skills::HasSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
     return it != schemeSpecificParts_.end();
 }
 
@@ -492,9 +516,10 @@ bool Skills::HasSchemeSpecificPart(const std::string &schemeSpecificPart)
  */
 void Skills::RemoveSchemeSpecificPart(const std::string &schemeSpecificPart)
 {
+    matchIndex_ = nullptr;
     auto it = std::find_if(schemeSpecificParts_.begin(),
         schemeSpecificParts_.end(),
-        [&schemeSpecificPart](const PatternsMatcher pm) { return pm.GetPattern() == schemeSpecificPart; });
+        [&schemeSpecificPart](const PatternsMatcher &pm) { return pm.GetPattern() == schemeSpecificPart; });
 
     if (it != schemeSpecificParts_.end()) {
         schemeSpecificParts_.erase(it);
@@ -530,6 +555,7 @@ std::string Skills::GetType(int index) const
  */
 void Skills::AddType(const std::string &type)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(type, MatchType::DEFAULT);
     AddType(pm);
 }
@@ -542,6 +568,7 @@ void Skills::AddType(const std::string &type)
  */
 void Skills::AddType(const std::string &type, const MatchType &matchType)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(type, matchType);
     AddType(pm);
 }
@@ -553,6 +580,7 @@ void Skills::AddType(const std::string &type, const MatchType &matchType)
  */
 void Skills::AddType(const PatternsMatcher &patternsMatcher)
 {
+    matchIndex_ = nullptr;
     const size_t posNext = 1;
     const size_t posOffset = 2;
     std::string type = patternsMatcher.GetPattern();
@@ -590,7 +618,7 @@ void Skills::AddType(const PatternsMatcher &patternsMatcher)
 bool Skills::HasType(const std::string &type)
 {
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
     return it != types_.end();
 }
 
@@ -601,8 +629,9 @@ bool Skills::HasType(const std::string &type)
  */
 void Skills::RemoveType(const std::string &type)
 {
+    matchIndex_ = nullptr;
     auto it = std::find_if(
-        types_.begin(), types_.end(), [&type](const PatternsMatcher pm) { return pm.GetPattern() == type; });
+        types_.begin(), types_.end(), [&type](const PatternsMatcher &pm) { return pm.GetPattern() == type; });
 
     if (it != types_.end()) {
         types_.erase(it);
@@ -616,7 +645,8 @@ void Skills::RemoveType(const std::string &type)
  */
 void Skills::RemoveType(const PatternsMatcher &patternsMatcher)
 {
-    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher pm) {
+    matchIndex_ = nullptr;
+    auto it = std::find_if(types_.begin(), types_.end(), [&patternsMatcher](const PatternsMatcher &pm) {
         return (pm.GetPattern() == patternsMatcher.GetPattern()) && (pm.GetType() == patternsMatcher.GetType());
     });
 
@@ -633,6 +663,7 @@ void Skills::RemoveType(const PatternsMatcher &patternsMatcher)
  */
 void Skills::RemoveType(const std::string &type, const MatchType &matchType)
 {
+    matchIndex_ = nullptr;
     PatternsMatcher pm(type, matchType);
     RemoveType(pm);
 }
@@ -646,24 +677,143 @@ int Skills::CountTypes() const
     return types_.empty() ? 0 : types_.size();
 }
 
+namespace {
+/**
+ * @struct PatternsBucket
+ * PatternsBucket holds the patterns of paths or scheme specific parts bucketed by their match type.
+ */
+struct PatternsBucket {
+    // every pattern matches itself, besides what its match type matches.
+    std::unordered_set<std::string_view> exact;
+    std::vector<std::string_view> prefixes;
+    std::vector<PatternsMatcher> matchers;
+
+    bool Empty() const
+    {
+        return exact.empty();
+    }
+
+    bool Match(std::string_view str) const
+    {
+        if (exact.find(str) != exact.end()) {
+            return true;
+        }
+        if (str.empty()) {
+            return false;
+        }
+        for (auto prefix : prefixes) {
+            if (str.compare(0, prefix.length(), prefix) == 0) {
+                return true;
+            }
+        }
+        for (auto &matcher : matchers) {
+            if (matcher.match(str)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+}  // namespace
+
+/**
+ * @struct MatchIndex
+ * MatchIndex is the immutable index a skill is matched with. It owns the strings it looks up.
+ */
+struct Skills::MatchIndex {
+    // a deque never moves its elements, so the views into them stay valid.
+    std::deque<std::string> storage;
+
+    std::unordered_set<std::string_view> actions;
+    std::unordered_set<std::string_view> entities;
+    std::unordered_set<std::string_view> schemes;
+    std::unordered_set<std::string_view> authorities;
+    PatternsBucket paths;
+    PatternsBucket schemeSpecificParts;
+
+    // mime types, the whole patterns and the major types of the "major/minor" patterns.
+    std::unordered_set<std::string_view> types;
+    std::unordered_set<std::string_view> majorTypes;
+
+    std::string_view Store(const std::string &str)
+    {
+        return storage.emplace_back(str);
+    }
+
+    void AddStrings(std::unordered_set<std::string_view> &set, const std::vector<std::string> &strings)
+    {
+        for (auto &str : strings) {
+            set.insert(Store(str));
+        }
+    }
+
+    void AddPatterns(PatternsBucket &bucket, const std::vector<PatternsMatcher> &patterns)
+    {
+        for (auto &pattern : patterns) {
+            std::string_view view = Store(pattern.GetPattern());
+            bucket.exact.insert(view);
+            if (pattern.GetType() == MatchType::PREFIX) {
+                bucket.prefixes.emplace_back(view);
+            } else if (pattern.GetType() != MatchType::DEFAULT) {
+                bucket.matchers.emplace_back(pattern);
+            }
+        }
+    }
+
+    void AddTypes(const std::vector<PatternsMatcher> &patterns)
+    {
+        for (auto &pattern : patterns) {
+            std::string_view view = Store(pattern.GetPattern());
+            types.insert(view);
+            size_t slashpos = view.find('/');
+            if (slashpos != std::string_view::npos && slashpos > 0) {
+                majorTypes.insert(view.substr(0, slashpos));
+            }
+        }
+    }
+};
+
+/**
+ * @brief Obtains the match index, builds it if the skill has changed since the last match.
+ *
+ * @return the match index.
+ */
+const Skills::MatchIndex &Skills::GetMatchIndex()
+{
+    if (matchIndex_ == nullptr) {
+        auto index = std::make_shared<MatchIndex>();
+        index->AddStrings(index->actions, actions_);
+        index->AddStrings(index->entities, entities_);
+        index->AddStrings(index->schemes, schemes_);
+        index->AddStrings(index->authorities, authorities_);
+        index->AddPatterns(index->paths, paths_);
+        index->AddPatterns(index->schemeSpecificParts, schemeSpecificParts_);
+        index->AddTypes(types_);
+        matchIndex_ = index;
+    }
+    return *matchIndex_;
+}
+
 /**
- * @brief Match this skill against a Want's data.
+ * @brief Match this skill against a Want's data. The match index of the skill is built on the first match
+ * after a change, the match itself allocates nothing.
  *
  * @param want The desired want data to match for.
  */
 bool Skills::Match(const Want &want)
 {
-    if (want.GetAction() != std::string() && !MatchAction(want.GetAction())) {
+    const MatchIndex &index = GetMatchIndex();
+    std::string action = want.GetAction();
+    if (action != std::string() && index.actions.find(action) == index.actions.end()) {
         return false;
     }
 
-    int dataMatch = MatchData(want.GetType(), want.GetScheme(), want.GetUri());
+    int dataMatch = MatchData(index, want.GetType(), want);
     if (dataMatch < 0) {
         return false;
     }
 
-    std::string entityMismatch = MatchEntities(want.GetEntities());
-    if (entityMismatch == std::string()) {
+    if (!MatchEntities(index, want.GetEntities())) {
         return false;
     }
 
@@ -671,99 +821,61 @@ bool Skills::Match(const Want &want)
 }
 
 /**
- * @brief Match this skills against a Want's entities.  Each entity in
- * the Want must be specified by the skills; if any are not in the
- * skills, the match fails.
+ * @brief Match this skills against a Want's entities.
  *
+ * @param index The match index of this skills.
  * @param entities The entities included in the want, as returned by
  *                   Want.getEntities().
  *
- * @return If all entities match (success), null; else the name of the
- *         first entity that didn't match.
+ * @return True if any entity of the want is listed in the skills.
  */
-std::string Skills::MatchEntities(const std::vector<std::string> &entities)
+bool Skills::MatchEntities(const MatchIndex &index, const std::vector<std::string> &entities) const
 {
-    if (!entities.empty()) {
-        size_t size = entities.size();
-        for (size_t i = 0; i < size; i++) {
-            auto it = std::find(entities_.begin(), entities_.end(), entities[i]);
-            if (it != entities_.end()) {
-                return entities[i];
-            }
+    for (auto &entity : entities) {
+        if (index.entities.find(entity) != index.entities.end()) {
+            return true;
         }
     }
-
-    return std::string();
-}
-
-/**
- * @brief Match this skills against a Want's action.  If the skills does not
- * specify any actions, the match will always fail.
- *
- * @param action The desired action to look for.
- *
- * @return True if the action is listed in the skills.
- */
-bool Skills::MatchAction(const std::string &action)
-{
-    return HasAction(action);
+    return false;
 }
 
 /**
  * @brief Match this skills against a Want's data (type, scheme and path).
  *
+ * @param index The match index of this skills.
  * @param type The desired data type to look for.
- * @param scheme The desired data scheme to look for.
- * @param data The full data string to match against.
+ * @param want The want whose uri to match against.
  *
  * @return Returns either a valid match constant.
  */
-int Skills::MatchData(const std::string &type, const std::string &scheme, Uri data)
+int Skills::MatchData(const MatchIndex &index, const std::string &type, const Want &want) const
 {
-    std::vector<std::string> types;
-    for (auto it = types_.begin(); it != types_.end(); it++) {
-        types.emplace_back(it->GetPattern());
-    }
-    std::vector<std::string> schemes = schemes_;
-
     int match = RESULT_EMPTY;
 
-    if (types.empty() && schemes.empty()) {
+    if (index.types.empty() && index.schemes.empty()) {
         return (type == std::string() ? (RESULT_EMPTY + RESULT_NORMAL) : DISMATCH_DATA);
     }
 
-    if (!schemes.empty()) {
-        auto it = std::find(schemes.begin(), schemes.end(), scheme);
-        if (it != schemes.end()) {
-            match = RESULT_SCHEME;
-        } else {
+    Uri data = want.GetUri();
+    std::string scheme = data.GetScheme();
+    if (!index.schemes.empty()) {
+        if (index.schemes.find(scheme) == index.schemes.end()) {
             return DISMATCH_DATA;
         }
 
-        std::vector<PatternsMatcher> schemeSpecificParts = schemeSpecificParts_;
-        if (schemeSpecificParts.size() >= 0) {
-            match = HasSchemeSpecificPart(data.GetSchemeSpecificPart()) ? RESULT_SCHEME_SPECIFIC_PART : DISMATCH_DATA;
-        }
-        if (match != RESULT_SCHEME_SPECIFIC_PART) {
-            std::vector<std::string> authorities = authorities_;
-            if (authorities.size() >= 0) {
-                bool authMatch = HasAuthority(data.GetAuthority());
-                if (authMatch == true) {
-                    std::vector<PatternsMatcher> paths = paths_;
-                    if (paths.size() <= 0) {
-                        match = authMatch;
-                    } else if (HasPath(data.GetPath())) {
-                        match = RESULT_PATH;
-                    } else {
-                        return DISMATCH_DATA;
-                    }
-                } else {
-                    return DISMATCH_DATA;
-                }
+        if (index.schemeSpecificParts.Match(data.GetSchemeSpecificPart())) {
+            match = RESULT_SCHEME_SPECIFIC_PART;
+        } else {
+            if (index.authorities.find(data.GetAuthority()) == index.authorities.end()) {
+                return DISMATCH_DATA;
+            }
+            if (index.paths.Empty()) {
+                match = RESULT_SCHEME;
+            } else if (index.paths.Match(data.GetPath())) {
+                match = RESULT_PATH;
+            } else {
+                return DISMATCH_DATA;
             }
-        }
-        if (match == DISMATCH_DATA) {
-            return DISMATCH_DATA;
         }
     } else {
         if (scheme != std::string() && scheme != "content" && scheme != "file") {
@@ -771,8 +883,8 @@ int Skills::MatchData(const std::string &type, const std::string &scheme, Uri da
         }
     }
 
-    if (!types.empty()) {
-        if (FindMimeType(type)) {
+    if (!index.types.empty()) {
+        if (FindMimeType(index, type)) {
             match = RESULT_TYPE;
         } else {
             return DISMATCH_TYPE;
@@ -786,79 +898,42 @@ int Skills::MatchData(const std::string &type, const std::string &scheme, Uri da
     return match + RESULT_NORMAL;
 }
 
-bool Skills::FindMimeType(const std::string &type)
+bool Skills::FindMimeType(const MatchIndex &index, const std::string &type) const
 {
-    const int posNext = 1;
-    const int posOffset = 2;
-    std::vector<PatternsMatcher> types = types_;
+    const size_t posNext = 1;
+    const size_t posOffset = 2;
 
     if (type == std::string()) {
         return false;
     }
-    auto it = types.begin();
-    for (; it != types.end(); it++) {
-        if (it->GetPattern() == type) {
-            break;
-        }
-    }
-    if (it != types.end()) {
+    if (index.types.find(type) != index.types.end()) {
         return true;
     }
 
-    int typeLength = type.length();
-    if (typeLength == LENGTH_FOR_FINDMINETYPE && type == "*/*") {
-        return !types.empty();
+    if (type.length() == LENGTH_FOR_FINDMINETYPE && type == "*/*") {
+        return !index.types.empty();
     }
 
-    auto hasType =
-        std::find_if(types.begin(), types.end(), [](const PatternsMatcher pm) { return pm.GetPattern() == "*"; });
-    if (hasPartialTypes_ && hasType != types.end()) {
+    if (hasPartialTypes_ && index.types.find("*") != index.types.end()) {
         return true;
     }
 
-    auto typeIt = type.find(0, 1, '/');
-    int slashpos = type.size() - typeIt;
-    if (slashpos > 0) {
-        std::string typeSubstr = type.substr(0, slashpos);
-
-        auto hasType = std::find_if(types.begin(), types.end(), [&typeSubstr](const PatternsMatcher pm) {
-            return pm.GetPattern() == typeSubstr;
-        });
-        if (hasPartialTypes_ && hasType != types.end()) {
+    size_t slashpos = type.find('/');
+    if (slashpos != std::string::npos && slashpos > 0) {
+        std::string_view majorType = std::string_view(type).substr(0, slashpos);
+        if (hasPartialTypes_ && index.types.find(majorType) != index.types.end()) {
             return true;
         }
 
-        if (typeLength == slashpos + posOffset && type.at(slashpos + posNext) == '*') {
-            int numTypes = types.size();
-            for (int i = 0; i < numTypes; i++) {
-                std::string value = types.at(i).GetPattern();
-                if (RegionMatches(type, 0, value, 0, slashpos + posNext)) {
-                    return true;
-                }
-            }
+        // "major/*" matches any "major/minor" type.
+        if (type.length() == slashpos + posOffset && type.at(slashpos + posNext) == '*') {
+            return index.majorTypes.find(majorType) != index.majorTypes.end();
         }
     }
 
     return false;
 }
 
-bool Skills::RegionMatches(const std::string &type, int toffset, const std::string &other, int ooffset, int len)
-{
-    int to = toffset;
-    int po = ooffset;
-    // Note: toffset, ooffset, or len might be near -1>>>1.
-    if ((ooffset < 0) || (toffset < 0) || (toffset > (long)type.size() - len) ||
-        (ooffset > (long)other.length() - len)) {
-        return false;
-    }
-    while (len-- > 0) {
-        if (type.at(to++) != other.at(po++)) {
-            return false;
-        }
-    }
-    return true;
-}
-
 /**
  * @brief Obtains the want params data.
  *
@@ -970,6 +1045,7 @@ Skills *Skills::Unmarshalling(Parcel &parcel)
 
 bool Skills::ReadFromParcel(Parcel &parcel)
 {
+    matchIndex_ = nullptr;
     int32_t empty;
     int32_t size = 0;
     PatternsMatcher *pm = nullptr;
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_URI_CODEC_H
+#define OHOS_AAFWK_URI_CODEC_H
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ohos/aafwk/base/array_wrapper.h"
+#include "ohos/aafwk/base/base_object.h"
+#include "ohos/aafwk/base/bool_wrapper.h"
+#include "ohos/aafwk/base/byte_wrapper.h"
+#include "ohos/aafwk/base/double_wrapper.h"
+#include "ohos/aafwk/base/float_wrapper.h"
+#include "ohos/aafwk/base/int_wrapper.h"
+#include "ohos/aafwk/base/long_wrapper.h"
+#include "ohos/aafwk/base/short_wrapper.h"
+#include "ohos/aafwk/base/string_wrapper.h"
+#include "ohos/aafwk/base/zchar_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @struct UriField
+ * UriField is a field of the URI form, written as prefix, prop, '=', value and ';'.
+ * The prefix is the type signature and '.' for a parameter, empty for the other fields.
+ */
+struct UriField {
+    std::string_view prefix;
+    std::string_view prop;
+    std::string_view value;
+};
+
+/**
+ * @class UriCodec
+ * UriCodec writes and reads the URI form of Want and Intent, "<head>prop=value;...;end", where '\', '=' and ';'
+ * in prop and value are escaped as "\\", "\075" and "\073".
+ * The URI is written into a single allocation of its exact size. It is read as views of the URI, only the
+ * decoded values are allocated.
+ */
+class UriCodec {
+public:
+    static constexpr char ESCAPE = '\\';
+    static constexpr char EQUALS = '=';
+    static constexpr char SEMICOLON = ';';
+    static constexpr std::string_view OCT_EQUALSTO = "075";
+    static constexpr std::string_view OCT_SEMICOLON = "073";
+    static constexpr std::string_view URI_END = "end";
+    static constexpr size_t TYPE_TAG_SIZE = 2;
+
+    static size_t GetEncodedLength(std::string_view str)
+    {
+        size_t length = str.size();
+        for (char c : str) {
+            if (c == ESCAPE) {
+                length++;
+            } else if (c == EQUALS || c == SEMICOLON) {
+                length += OCT_EQUALSTO.size();
+            }
+        }
+        return length;
+    }
+
+    static void AppendEncoded(std::string_view str, std::string &out)
+    {
+        size_t begin = 0;
+        for (size_t i = 0; i < str.size(); i++) {
+            char c = str[i];
+            if (c != ESCAPE && c != EQUALS && c != SEMICOLON) {
+                continue;
+            }
+            out.append(str.data() + begin, i - begin);
+            out += ESCAPE;
+            if (c == ESCAPE) {
+                out += ESCAPE;
+            } else {
+                out.append(c == EQUALS ? OCT_EQUALSTO : OCT_SEMICOLON);
+            }
+            begin = i + 1;
+        }
+        out.append(str.data() + begin, str.size() - begin);
+    }
+
+    /**
+     * write the URI of the fields, the string is allocated once with its exact size.
+     */
+    static std::string Build(std::string_view head, const std::vector<UriField> &fields)
+    {
+        size_t length = head.size() + URI_END.size();
+        for (const auto &field : fields) {
+            length += field.prefix.size() + GetEncodedLength(field.prop) + GetEncodedLength(field.value) + 2;
+        }
+        std::string uri;
+        uri.reserve(length);
+        uri.append(head);
+        for (const auto &field : fields) {
+            uri.append(field.prefix);
+            AppendEncoded(field.prop, uri);
+            uri += EQUALS;
+            AppendEncoded(field.value, uri);
+            uri += SEMICOLON;
+        }
+        uri.append(URI_END);
+        return uri;
+    }
+
+    static std::string Decode(std::string_view str)
+    {
+        std::string decoded;
+        decoded.reserve(str.size());
+        size_t begin = 0;
+        while (begin < str.size()) {
+            size_t escape = str.find(ESCAPE, begin);
+            if (escape == std::string_view::npos) {
+                decoded.append(str.data() + begin, str.size() - begin);
+                break;
+            }
+            decoded.append(str.data() + begin, escape - begin);
+            begin = escape + 1;
+            if (begin >= str.size()) {
+                decoded += ESCAPE;
+                break;
+            }
+            if (str[begin] == ESCAPE) {
+                decoded += ESCAPE;
+                begin++;
+            } else if (str.compare(begin, OCT_EQUALSTO.size(), OCT_EQUALSTO) == 0) {
+                decoded += EQUALS;
+                begin += OCT_EQUALSTO.size();
+            } else if (str.compare(begin, OCT_SEMICOLON.size(), OCT_SEMICOLON) == 0) {
+                decoded += SEMICOLON;
+                begin += OCT_SEMICOLON.size();
+            } else {
+                // an unknown escape is kept as it is.
+                decoded += ESCAPE;
+                decoded += str[begin];
+                begin++;
+            }
+        }
+        return decoded;
+    }
+
+    /**
+     * decode str into storage only if it has an escape.
+     *
+     * @return Returns str itself or the view of storage.
+     */
+    static std::string_view Decode(std::string_view str, std::string &storage)
+    {
+        if (str.find(ESCAPE) == std::string_view::npos) {
+            return str;
+        }
+        storage = Decode(str);
+        return storage;
+    }
+
+    /**
+     * get the fields of uri between head and the final "end".
+     *
+     * @return Returns false if uri does not start with head or does not end with ";end".
+     */
+    static bool GetBody(std::string_view uri, std::string_view head, std::string_view &body)
+    {
+        // the ';' before "end" may be the last character of head.
+        size_t endLength = URI_END.size() + 1;
+        if (uri.size() < std::max(head.size() + URI_END.size(), endLength) || uri.compare(0, head.size(), head) != 0 ||
+            uri.compare(uri.size() - endLength, endLength, ";end") != 0) {
+            return false;
+        }
+        body = uri.substr(head.size(), uri.size() - head.size() - URI_END.size());
+        return true;
+    }
+
+    /**
+     * take the next field terminated by ';' from body, a trailing part without ';' is not a field.
+     */
+    static bool NextField(std::string_view &body, std::string_view &field)
+    {
+        size_t pos = body.find(SEMICOLON);
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        field = body.substr(0, pos);
+        body.remove_prefix(pos + 1);
+        return true;
+    }
+
+    /**
+     * split a field at its first '='.
+     *
+     * @return Returns false if the field has no '='.
+     */
+    static bool SplitField(std::string_view field, std::string_view &prop, std::string_view &value)
+    {
+        size_t pos = field.find(EQUALS);
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        prop = field.substr(0, pos);
+        value = field.substr(pos + 1);
+        return true;
+    }
+
+    /**
+     * get the prefix of a parameter, its type signature and '.'.
+     * The interface id of the value is checked first, which needs a single virtual call.
+     */
+    static std::string_view GetParamPrefix(IInterface *value)
+    {
+        static const ParamType types[] = {
+            {&g_IID_IString, {String::SIGNATURE, '.'}},
+            {&g_IID_IBoolean, {Boolean::SIGNATURE, '.'}},
+            {&g_IID_IChar, {Char::SIGNATURE, '.'}},
+            {&g_IID_IByte, {Byte::SIGNATURE, '.'}},
+            {&g_IID_IShort, {Short::SIGNATURE, '.'}},
+            {&g_IID_IInteger, {Integer::SIGNATURE, '.'}},
+            {&g_IID_ILong, {Long::SIGNATURE, '.'}},
+            {&g_IID_IFloat, {Float::SIGNATURE, '.'}},
+            {&g_IID_IDouble, {Double::SIGNATURE, '.'}},
+            {&g_IID_IArray, {Array::SIGNATURE, '.'}},
+        };
+        InterfaceID iid = value->GetInterfaceID(value);
+        for (const auto &type : types) {
+            if (iid == *type.iid) {
+                return std::string_view(type.prefix, TYPE_TAG_SIZE);
+            }
+        }
+        for (const auto &type : types) {
+            if (value->Query(*type.iid) != nullptr) {
+                return std::string_view(type.prefix, TYPE_TAG_SIZE);
+            }
+        }
+        return std::string_view(".");
+    }
+
+    /**
+     * parse the value of a parameter by its type signature.
+     *
+     * @param object, output the value, nullptr if the type is unknown.
+     * @return Returns false if the value does not match its type.
+     */
+    static bool ParseParam(char signature, const std::string &value, sptr<IInterface> &object)
+    {
+        switch (signature) {
+            case String::SIGNATURE:
+                object = String::Parse(value);
+                break;
+            case Boolean::SIGNATURE:
+                object = Boolean::Parse(value);
+                break;
+            case Char::SIGNATURE:
+                object = Char::Parse(value);
+                break;
+            case Byte::SIGNATURE:
+                object = Byte::Parse(value);
+                break;
+            case Short::SIGNATURE:
+                object = Short::Parse(value);
+                break;
+            case Integer::SIGNATURE:
+                object = Integer::Parse(value);
+                break;
+            case Long::SIGNATURE:
+                object = Long::Parse(value);
+                break;
+            case Float::SIGNATURE:
+                object = Float::Parse(value);
+                break;
+            case Double::SIGNATURE:
+                object = Double::Parse(value);
+                break;
+            case Array::SIGNATURE:
+                object = Array::Parse(value);
+                break;
+            default:
+                object = nullptr;
+                return true;
+        }
+        return object != nullptr;
+    }
+
+private:
+    struct ParamType {
+        const InterfaceID *iid;
+        char prefix[TYPE_TAG_SIZE];
+    };
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_URI_CODEC_H
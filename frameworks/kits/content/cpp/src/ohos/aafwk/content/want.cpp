@@ -31,6 +31,7 @@
 #include "ohos/aafwk/base/double_wrapper.h"
 #include "ohos/aafwk/base/string_wrapper.h"
 #include "ohos/aafwk/base/zchar_wrapper.h"
+#include "uri_codec.h"
 
 using namespace OHOS::AppExecFwk;
 using OHOS::AppExecFwk::ElementName;
@@ -45,11 +46,13 @@ const std::string Want::ENTITY_HOME("entity.system.home");
 const std::string Want::ENTITY_VIDEO("entity.system.video");
 const std::string Want::FLAG_HOME_INTENT_FROM_SYSTEM("flag.home.intent.from.system");
 
-const std::string Want::OCT_EQUALSTO("075");   // '='
-const std::string Want::OCT_SEMICOLON("073");  // ';'
 const std::string Want::MIME_TYPE("mime-type");
 const std::string Want::WANT_HEADER("#Want;");
 
+namespace {
+constexpr size_t URI_OPERATION_FIELD_COUNT = 6;  // action, uri, flag, device, bundle and ability
+}  // namespace
+
 /**
  * @description:Default construcotr of Want class, which is used to initialzie flags and URI.
  * @param None
@@ -1156,56 +1159,24 @@ Want *Want::CloneOperation()
  */
 Want *Want::ParseUri(const std::string &uri)
 {
-    if (uri.length() <= 0) {
-        return nullptr;
-    }
-
-    std::string head = WANT_HEADER;
-    std::string end = ";end";
-
-    if (uri.find(head) != 0) {
+    std::string_view body;
+    if (!UriCodec::GetBody(uri, WANT_HEADER, body)) {
         return nullptr;
     }
 
-    if (uri.rfind(end) != (uri.length() - end.length())) {
-        return nullptr;
-    }
-
-    bool ret = true;
-    std::string content;
-    std::size_t pos;
-    std::size_t begin = head.length();
     ElementName element;
     Want *want = new (std::nothrow) Want();
     if (want == nullptr) {
         return nullptr;
     }
-
-    pos = uri.find_first_of(";", begin);
-    do {
-        if (pos != std::string::npos) {
-            content = uri.substr(begin, pos - begin);
-            ret = ParseUriInternal(content, element, *want);
-            if (!ret) {
-                break;
-            }
-            begin = pos + 1;
-            pos = uri.find(";", begin);
-            if (pos == std::string::npos) {
-                break;
-            }
-        } else {
-            break;
+    std::string_view content;
+    while (UriCodec::NextField(body, content)) {
+        if (!ParseUriInternal(content, element, *want)) {
+            delete want;
+            return nullptr;
         }
-    } while (true);
-
-    if (ret) {
-        want->SetElement(element);
-    } else {
-        delete want;
-        want = nullptr;
     }
-
+    want->SetElement(element);
     return want;
 }
 
@@ -1293,69 +1264,52 @@ std::string Want::WantToUri(Want &want)
  */
 std::string Want::ToUri() const
 {
-    std::string uriString = WANT_HEADER;
-    if (operation_.GetAction().length() > 0) {
-        uriString += "action=" + Encode(operation_.GetAction()) + ";";
+    std::string action = operation_.GetAction();
+    std::string uri = GetUriString();
+    std::string device = operation_.GetDeviceId();
+    std::string bundle = operation_.GetBundleName();
+    std::string ability = operation_.GetAbilityName();
+    const std::vector<std::string> &entities = operation_.GetEntities();
+    const std::map<std::string, sptr<IInterface>> &params = parameters_.GetParams();
+
+    // the fields are views of the strings above, the uri is written at once with its exact size.
+    std::vector<UriField> fields;
+    fields.reserve(URI_OPERATION_FIELD_COUNT + entities.size() + params.size());
+    if (action.length() > 0) {
+        fields.push_back({"", "action", action});
     }
-    if (GetUriString().length() > 0) {
-        uriString += "uri=" + Encode(GetUriString()) + ";";
+    if (uri.length() > 0) {
+        fields.push_back({"", "uri", uri});
     }
-    for (auto entity : operation_.GetEntities()) {
+    for (const auto &entity : entities) {
         if (entity.length() > 0) {
-            uriString += "entity=" + Encode(entity) + ";";
+            fields.push_back({"", "entity", entity});
         }
     }
+    char flag[HEX_STRING_BUF_LEN]{0};
     if (operation_.GetFlags() != 0) {
-        uriString += "flag=";
-        char buf[HEX_STRING_BUF_LEN]{0};
-        std::size_t len = snprintf_s(buf, HEX_STRING_BUF_LEN, HEX_STRING_BUF_LEN - 1, "0x%08x", operation_.GetFlags());
+        std::size_t len = snprintf_s(flag, HEX_STRING_BUF_LEN, HEX_STRING_BUF_LEN - 1, "0x%08x", operation_.GetFlags());
         if (len == HEX_STRING_LEN) {
-            std::string flag = buf;
-            uriString += Encode(flag);
-            uriString += ";";
+            fields.push_back({"", "flag", std::string_view(flag, len)});
         }
     }
-    if (operation_.GetDeviceId().length() > 0) {
-        uriString += "device=" + Encode(operation_.GetDeviceId()) + ";";
-    }
-    if (operation_.GetBundleName().length() > 0) {
-        uriString += "bundle=" + Encode(operation_.GetBundleName()) + ";";
-    }
-    if (operation_.GetAbilityName().length() > 0) {
-        uriString += "ability=" + Encode(operation_.GetAbilityName()) + ";";
-    }
-    auto params = parameters_.GetParams();
-    auto iter = params.cbegin();
-    while (iter != params.cend()) {
-        sptr<IInterface> o = iter->second;
-        if (IString::Query(o) != nullptr) {
-            uriString += String::SIGNATURE;
-        } else if (IBoolean::Query(o) != nullptr) {
-            uriString += Boolean::SIGNATURE;
-        } else if (IChar::Query(o) != nullptr) {
-            uriString += Char::SIGNATURE;
-        } else if (IByte::Query(o) != nullptr) {
-            uriString += Byte::SIGNATURE;
-        } else if (IShort::Query(o) != nullptr) {
-            uriString += Short::SIGNATURE;
-        } else if (IInteger::Query(o) != nullptr) {
-            uriString += Integer::SIGNATURE;
-        } else if (ILong::Query(o) != nullptr) {
-            uriString += Long::SIGNATURE;
-        } else if (IFloat::Query(o) != nullptr) {
-            uriString += Float::SIGNATURE;
-        } else if (IDouble::Query(o) != nullptr) {
-            uriString += Double::SIGNATURE;
-        } else if (IArray::Query(o) != nullptr) {
-            uriString += Array::SIGNATURE;
-        }
-        uriString += "." + Encode(iter->first) + "=" + Encode(Object::ToString(*(o.GetRefPtr()))) + ";";
-        iter++;
+    if (device.length() > 0) {
+        fields.push_back({"", "device", device});
     }
-
-    uriString += "end";
-
-    return uriString;
+    if (bundle.length() > 0) {
+        fields.push_back({"", "bundle", bundle});
+    }
+    if (ability.length() > 0) {
+        fields.push_back({"", "ability", ability});
+    }
+    std::vector<std::string> values;
+    values.reserve(params.size());
+    for (const auto &param : params) {
+        IInterface *value = param.second.GetRefPtr();
+        values.emplace_back(Object::ToString(*value));
+        fields.push_back({UriCodec::GetParamPrefix(value), param.first, values.back()});
+    }
+    return UriCodec::Build(WANT_HEADER, fields);
 }
 
 /**
@@ -1655,25 +1609,26 @@ bool Want::ReadFromParcel(Parcel &parcel)
     return true;
 }
 
-bool Want::ParseUriInternal(const std::string &content, ElementName &element, Want &want)
+bool Want::ParseUriInternal(std::string_view content, ElementName &element, Want &want)
 {
-    static constexpr int TYPE_TAG_SIZE = 2;
-
-    std::string prop;
-    std::string value;
+    std::string_view rawProp;
+    std::string_view rawValue;
 
     if (content.empty() || content[0] == '=') {
         return true;
     }
 
-    if (!ParseContent(content, prop, value)) {
+    if (!UriCodec::SplitField(content, rawProp, rawValue)) {
         return false;
     }
 
-    if (value.empty()) {
+    if (rawValue.empty()) {
         return true;
     }
 
+    std::string propStorage;
+    std::string_view prop = UriCodec::Decode(rawProp, propStorage);
+    std::string value = UriCodec::Decode(rawValue);
     if (prop == "action") {
         want.SetAction(value);
     } else if (prop == "entity") {
@@ -1688,9 +1643,8 @@ bool Want::ParseUriInternal(const std::string &content, ElementName &element, Wa
         element.SetBundleName(value);
     } else if (prop == "ability") {
         element.SetAbilityName(value);
-    } else if (prop.length() > TYPE_TAG_SIZE) {
-        std::string key = prop.substr(TYPE_TAG_SIZE);
-        if (!Want::CheckAndSetParameters(want, key, prop, value)) {
+    } else if (prop.length() > UriCodec::TYPE_TAG_SIZE) {
+        if (!Want::CheckAndSetParameters(want, prop, value)) {
             return false;
         }
     }
@@ -1698,20 +1652,6 @@ bool Want::ParseUriInternal(const std::string &content, ElementName &element, Wa
     return true;
 }
 
-bool Want::ParseContent(const std::string &content, std::string &prop, std::string &value)
-{
-    std::string subString;
-    std::size_t pos = content.find("=");
-    if (pos != std::string::npos) {
-        subString = content.substr(0, pos);
-        prop = Decode(subString);
-        subString = content.substr(pos + 1, content.length() - pos - 1);
-        value = Decode(subString);
-        return true;
-    }
-    return false;
-}
-
 bool Want::ParseFlag(const std::string &content, Want &want)
 {
     std::string contentLower = LowerStr(content);
@@ -1733,124 +1673,17 @@ bool Want::ParseFlag(const std::string &content, Want &want)
     return true;
 }
 
-std::string Want::Decode(const std::string &str)
+bool Want::CheckAndSetParameters(Want &want, std::string_view prop, const std::string &value)
 {
-    std::string decode;
-
-    for (std::size_t i = 0; i < str.length();) {
-        if (str[i] == '\\') {
-            if (++i >= str.length()) {
-                decode += "\\";
-                break;
-            }
-            if (str[i] == '\\') {
-                decode += "\\";
-                i++;
-            } else if (str[i] == '0') {
-                if (str.compare(i, OCT_EQUALSTO.length(), OCT_EQUALSTO) == 0) {
-                    decode += "=";
-                    i += OCT_EQUALSTO.length();
-                } else if (str.compare(i, OCT_SEMICOLON.length(), OCT_SEMICOLON) == 0) {
-                    decode += ";";
-                    i += OCT_SEMICOLON.length();
-                } else {
-                    decode += "\\" + str.substr(i, 1);
-                    i++;
-                }
-            } else {
-                decode += "\\" + str.substr(i, 1);
-                i++;
-            }
-        } else {
-            decode += str[i];
-            i++;
-        }
+    if (prop[1] != '.') {
+        return true;
     }
-
-    return decode;
-}
-
-std::string Want::Encode(const std::string &str)
-{
-    std::string encode;
-
-    for (std::size_t i = 0; i < str.length(); i++) {
-        if (str[i] == '\\') {
-            encode += "\\\\";
-        } else if (str[i] == '=') {
-            encode += "\\" + OCT_EQUALSTO;
-        } else if (str[i] == ';') {
-            encode += "\\" + OCT_SEMICOLON;
-        } else {
-            encode += str[i];
-        }
+    sptr<IInterface> valueObj;
+    if (!UriCodec::ParseParam(prop[0], value, valueObj)) {
+        return false;
     }
-
-    return encode;
-}
-
-bool Want::CheckAndSetParameters(Want &want, const std::string &key, std::string &prop, const std::string &value)
-{
-    if (prop[0] == String::SIGNATURE && prop[1] == '.') {
-        sptr<IString> valueObj = String::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Boolean::SIGNATURE && prop[1] == '.') {
-        sptr<IBoolean> valueObj = Boolean::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Char::SIGNATURE && prop[1] == '.') {
-        sptr<IChar> valueObj = Char::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Byte::SIGNATURE && prop[1] == '.') {
-        sptr<IByte> valueObj = Byte::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Short::SIGNATURE && prop[1] == '.') {
-        sptr<IShort> valueObj = Short::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Integer::SIGNATURE && prop[1] == '.') {
-        sptr<IInteger> valueObj = Integer::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Long::SIGNATURE && prop[1] == '.') {
-        sptr<ILong> valueObj = Long::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Float::SIGNATURE && prop[1] == '.') {
-        sptr<IFloat> valueObj = Float::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Double::SIGNATURE && prop[1] == '.') {
-        sptr<IDouble> valueObj = Double::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
-    } else if (prop[0] == Array::SIGNATURE && prop[1] == '.') {
-        sptr<IArray> valueObj = Array::Parse(value);
-        if (valueObj == nullptr) {
-            return false;
-        }
-        want.parameters_.SetParam(key, valueObj);
+    if (valueObj != nullptr) {
+        want.parameters_.SetParam(std::string(prop.substr(UriCodec::TYPE_TAG_SIZE)), valueObj);
     }
     return true;
 }
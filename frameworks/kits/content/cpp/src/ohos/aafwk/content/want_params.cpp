@@ -64,8 +64,6 @@ std::string WantParams::GetStringByType(const sptr<IInterface> iIt, int typeId)
     }
     return "";
 }
-template <typename T1, typename T2, typename T3>
-static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray, sptr<AAFwk::IArray> &ao);
 /**
  * @description: A constructor used to create an IntentParams instance by using the parameters of an existing
  * IntentParams object.
@@ -79,69 +77,49 @@ WantParams::WantParams(const WantParams &wantParams)
 // inner use function
 bool WantParams::NewParams(const WantParams &source, WantParams &dest)
 {
-    // Deep copy
+    // Boxed primitives, strings and nested params can not be changed once boxed, so the copy shares them.
+    // Only arrays can be changed in place and are duplicated.
     for (auto it = source.params_.begin(); it != source.params_.end(); it++) {
-        sptr<IInterface> o = it->second;
-        if (IString::Query(o) != nullptr) {
-            dest.params_[it->first] = String::Box(String::Unbox(IString::Query(o)));
-        } else if (IBoolean::Query(o) != nullptr) {
-            dest.params_[it->first] = Boolean::Box(Boolean::Unbox(IBoolean::Query(o)));
-        } else if (IByte::Query(o) != nullptr) {
-            dest.params_[it->first] = Byte::Box(Byte::Unbox(IByte::Query(o)));
-        } else if (IChar::Query(o) != nullptr) {
-            dest.params_[it->first] = Char::Box(Char::Unbox(IChar::Query(o)));
-        } else if (IShort::Query(o) != nullptr) {
-            dest.params_[it->first] = Short::Box(Short::Unbox(IShort::Query(o)));
-        } else if (IInteger::Query(o) != nullptr) {
-            dest.params_[it->first] = Integer::Box(Integer::Unbox(IInteger::Query(o)));
-        } else if (ILong::Query(o) != nullptr) {
-            dest.params_[it->first] = Long::Box(Long::Unbox(ILong::Query(o)));
-        } else if (IFloat::Query(o) != nullptr) {
-            dest.params_[it->first] = Float::Box(Float::Unbox(IFloat::Query(o)));
-        } else if (IDouble::Query(o) != nullptr) {
-            dest.params_[it->first] = Double::Box(Double::Unbox(IDouble::Query(o)));
-        } else if (IWantParams::Query(o) != nullptr) {
-            WantParams newDest(WantParamWrapper::Unbox(IWantParams::Query(o)));
-            dest.params_[it->first] = WantParamWrapper::Box(newDest);
-        } else if (IArray::Query(o) != nullptr) {
-            sptr<IArray> destAO = nullptr;
-            if (!NewArrayData(IArray::Query(o), destAO)) {
-                continue;
-            }
-            dest.params_[it->first] = destAO;
+        if (it->second == nullptr) {
+            continue;
+        }
+        IArray *ao = IArray::Query(it->second);
+        if (ao == nullptr) {
+            dest.params_.emplace_hint(dest.params_.end(), it->first, it->second);
+            continue;
+        }
+        sptr<IArray> destAO = nullptr;
+        if (!NewArrayData(ao, destAO)) {
+            continue;
         }
+        dest.params_.emplace_hint(dest.params_.end(), it->first, destAO);
     }
     return true;
-}  // namespace AAFwk
+}
 // inner use
 bool WantParams::NewArrayData(IArray *source, sptr<IArray> &dest)
 {
-    if (Array::IsBooleanArray(source)) {
-        SetNewArray<bool, AAFwk::Boolean, AAFwk::IBoolean>(AAFwk::g_IID_IBoolean, source, dest);
-    } else if (Array::IsCharArray(source)) {
-        SetNewArray<char, AAFwk::Char, AAFwk::IChar>(AAFwk::g_IID_IChar, source, dest);
-    } else if (Array::IsByteArray(source)) {
-        SetNewArray<byte, AAFwk::Byte, AAFwk::IByte>(AAFwk::g_IID_IByte, source, dest);
-    } else if (Array::IsShortArray(source)) {
-        SetNewArray<short, AAFwk::Short, AAFwk::IShort>(AAFwk::g_IID_IShort, source, dest);
-    } else if (Array::IsIntegerArray(source)) {
-        SetNewArray<int, AAFwk::Integer, AAFwk::IInteger>(AAFwk::g_IID_IInteger, source, dest);
-    } else if (Array::IsLongArray(source)) {
-        SetNewArray<long, AAFwk::Long, AAFwk::ILong>(AAFwk::g_IID_ILong, source, dest);
-    } else if (Array::IsFloatArray(source)) {
-        SetNewArray<float, AAFwk::Float, AAFwk::IFloat>(AAFwk::g_IID_IFloat, source, dest);
-    } else if (Array::IsDoubleArray(source)) {
-        SetNewArray<double, AAFwk::Double, AAFwk::IDouble>(AAFwk::g_IID_IDouble, source, dest);
-    } else if (Array::IsStringArray(source)) {
-        SetNewArray<std::string, AAFwk::String, AAFwk::IString>(AAFwk::g_IID_IString, source, dest);
-    } else {
+    if (!Array::IsBooleanArray(source) && !Array::IsCharArray(source) && !Array::IsByteArray(source) &&
+        !Array::IsShortArray(source) && !Array::IsIntegerArray(source) && !Array::IsLongArray(source) &&
+        !Array::IsFloatArray(source) && !Array::IsDoubleArray(source) && !Array::IsStringArray(source)) {
         return false;
     }
 
+    InterfaceID id;
+    long size = 0;
+    if (source->GetType(id) != ERR_OK || source->GetLength(size) != ERR_OK) {
+        return false;
+    }
+    dest = new (std::nothrow) Array(size, id);
     if (dest == nullptr) {
         return false;
     }
-
+    // the elements are boxed primitives or strings, share them with the source array.
+    for (long i = 0; i < size; i++) {
+        sptr<IInterface> value = nullptr;
+        source->Get(i, value);
+        dest->Set(i, value);
+    }
     return true;
 }
 /**
@@ -162,7 +140,7 @@ bool WantParams::operator==(const WantParams &other)
     if (this->params_.size() != other.params_.size()) {
         return false;
     }
-    for (auto itthis : this->params_) {
+    for (const auto &itthis : this->params_) {
         auto itother = other.params_.find(itthis.first);
         if (itother == other.params_.end()) {
             return false;
@@ -311,7 +289,7 @@ const std::set<std::string> WantParams::KeySet() const
     std::set<std::string> keySet;
     keySet.clear();
 
-    for (auto it : params_) {
+    for (const auto &it : params_) {
         keySet.emplace(it.first);
     }
 
@@ -533,35 +511,6 @@ static void FillArray(IArray *ao, std::vector<T1> &array)
     };
     Array::ForEach(ao, func);
 }
-// inner use template function
-template <typename T1, typename T2, typename T3>
-static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray, sptr<AAFwk::IArray> &ao)
-{
-    if (orgIArray == nullptr) {
-        return;
-    }
-    std::vector<T1> array;
-    auto func = [&](IInterface *object) {
-        if (object != nullptr) {
-            T3 *value = T3::Query(object);
-            if (value != nullptr) {
-                array.push_back(T2::Unbox(value));
-            }
-        }
-    };
-    Array::ForEach(orgIArray, func);
-
-    typename std::vector<T1>::size_type size = array.size();
-    if (size > 0) {
-        ao = new (std::nothrow) AAFwk::Array(size, id);
-        if (ao != nullptr) {
-            for (typename std::vector<T1>::size_type i = 0; i < size; i++) {
-                ao->Set(i, T2::Box(array[i]));
-            }
-        }
-    }
-}
-
 bool WantParams::WriteArrayToParcelString(Parcel &parcel, IArray *ao) const
 {
     if (ao == nullptr) {
@@ -14,8 +14,12 @@
  */
 #include "ohos/aafwk/content/want_params_wrapper.h"
 #include <algorithm>
+#include <charconv>
 namespace OHOS {
 namespace AAFwk {
+namespace {
+constexpr size_t ESTIMATED_ENTRY_SIZE = 32;
+}  // namespace
 IINTERFACE_IMPL_1(WantParamWrapper, Object, IWantParams);
 const InterfaceID g_IID_IWantParams = {
     0xa75b9db6, 0x9813, 0x4371, 0x8848, {0xd, 0x2, 0x9, 0x6, 0x6, 0xc, 0xe, 0x6, 0xe, 0xc, 0x6, 0x8}};
@@ -35,27 +39,38 @@ bool WantParamWrapper::Equals(IObject &other)
 std::string WantParamWrapper::ToString()
 {
     std::string result;
-    if (wantParams_.Size() != 0) {
-        result += "{";
-        for (auto it : wantParams_.GetParams()) {
-            int typeId = WantParams::GetDataType(it.second);
-            result = result + "\"" + it.first + "\":{\"" + std::to_string(typeId) + "\":";
-            if (IWantParams::Query(it.second) != nullptr) {
-                result = result + static_cast<WantParamWrapper *>(IWantParams::Query(it.second))->ToString();
-            } else {
-                result = result + "\"" + WantParams::GetStringByType(it.second, typeId) + "\"";
-            }
-            if (it == *wantParams_.GetParams().rbegin()) {
-                result += "}";
-            } else {
-                result += "},";
-            }
+    result.reserve(ESTIMATED_ENTRY_SIZE * static_cast<size_t>(wantParams_.Size()) + 2);
+    AppendString(result);
+    return result;
+}
+
+void WantParamWrapper::AppendString(std::string &result)
+{
+    result += '{';
+    bool first = true;
+    for (const auto &it : wantParams_.GetParams()) {
+        if (!first) {
+            result += ',';
+        }
+        first = false;
+        int typeId = WantParams::GetDataType(it.second);
+        result += '"';
+        result += it.first;
+        result += "\":{\"";
+        result += std::to_string(typeId);
+        result += "\":";
+        IWantParams *wantParams = IWantParams::Query(it.second);
+        if (wantParams != nullptr) {
+            // nested params are written into the same string.
+            static_cast<WantParamWrapper *>(wantParams)->AppendString(result);
+        } else {
+            result += '"';
+            result += WantParams::GetStringByType(it.second, typeId);
+            result += '"';
         }
-        result += "}";
-    } else {
-        result = "{}";
+        result += '}';
     }
-    return result;
+    result += '}';
 }
 
 sptr<IWantParams> WantParamWrapper::Box(const WantParams &value)
@@ -99,53 +114,64 @@ bool WantParamWrapper::ValidateStr(const std::string &str)
 }
 sptr<IWantParams> WantParamWrapper::Parse(const std::string &str)
 {
-    WantParams wantPaqrams;
-    std::string key = "";
-    int typeId = 0;
-    if (ValidateStr(str)) {
-        for (unsigned int strnum = 0; strnum < str.size(); strnum++) {
-            if (str[strnum] == '{' && key != "" && typeId == WantParams::VALUE_TYPE_WANTPARAMS) {
-                unsigned int num;
-                int count = 0;
-                for (num = strnum; num < str.size(); num++) {
-                    if (str[num] == '{') {
-                        count++;
-                    } else if (str[num] == '}') {
-                        count--;
-                    }
-                    if (count == 0) {
-                        break;
-                    }
-                }
-                wantPaqrams.SetParam(key, WantParamWrapper::Parse(str.substr(strnum, num - strnum)));
-                key = "";
-                typeId = 0;
-                strnum = num + 1;
-            } else if (str[strnum] == '"') {
-                if (key == "") {
-                    strnum++;
-                    key = str.substr(strnum, str.find('"', strnum) - strnum);
-                    strnum = str.find('"', strnum);
-                } else if (typeId == 0) {
-                    strnum++;
-                    typeId = atoi(str.substr(strnum, str.find('"', strnum) - strnum).c_str());
-                    if (errno == ERANGE) {
-                        return nullptr;
-                    }
-                    strnum = str.find('"', strnum);
-                } else {
-                    strnum++;
-                    wantPaqrams.SetParam(key,
-                        WantParams::GetInterfaceByType(typeId, str.substr(strnum, str.find('"', strnum) - strnum)));
-                    strnum = str.find('"', strnum);
-                    typeId = 0;
-                    key = "";
+    if (!ValidateStr(str)) {
+        return new WantParamWrapper(WantParams());
+    }
+
+    // the params being parsed, from the outermost to the innermost.
+    std::vector<ParseFrame> frames(1);
+    std::string_view view(str);
+    int depth = 0;
+    for (size_t pos = 0; pos < view.size(); pos++) {
+        ParseFrame &frame = frames.back();
+        if (view[pos] == '{') {
+            depth++;
+            if (!frame.key.empty() && frame.typeId == WantParams::VALUE_TYPE_WANTPARAMS) {
+                frames.emplace_back();
+                frames.back().depth = depth;
+            }
+        } else if (view[pos] == '}') {
+            if (frames.size() > 1 && depth == frame.depth) {
+                PopFrame(frames);
+            }
+            depth--;
+        } else if (view[pos] == '"') {
+            size_t end = view.find('"', pos + 1);
+            if (end == std::string_view::npos) {
+                break;
+            }
+            std::string_view token = view.substr(pos + 1, end - pos - 1);
+            pos = end;
+            if (frame.key.empty()) {
+                frame.key = token;
+            } else if (frame.typeId == 0) {
+                auto result = std::from_chars(token.data(), token.data() + token.size(), frame.typeId);
+                if (result.ec == std::errc::result_out_of_range) {
+                    return nullptr;
                 }
+            } else {
+                frame.params.SetParam(
+                    std::string(frame.key), WantParams::GetInterfaceByType(frame.typeId, std::string(token)));
+                frame.key = std::string_view();
+                frame.typeId = 0;
             }
         }
     }
-    sptr<IWantParams> iwantParams = new WantParamWrapper(wantPaqrams);
+    while (frames.size() > 1) {
+        PopFrame(frames);
+    }
+    sptr<IWantParams> iwantParams = new WantParamWrapper(frames.back().params);
     return iwantParams;
 }
+
+void WantParamWrapper::PopFrame(std::vector<ParseFrame> &frames)
+{
+    sptr<IWantParams> nested = new WantParamWrapper(frames.back().params);
+    frames.pop_back();
+    ParseFrame &parent = frames.back();
+    parent.params.SetParam(std::string(parent.key), nested);
+    parent.key = std::string_view();
+    parent.typeId = 0;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -14,6 +14,8 @@
  */
 #ifndef OHOS_AAFWK_WANT_PARAMS_WRAPPER_H
 #define OHOS_AAFWK_WANT_PARAMS_WRAPPER_H
+#include <string_view>
+#include <vector>
 #include "ohos/aafwk/content/want_params.h"
 #include "ohos/aafwk/base/base_def.h"
 #include "ohos/aafwk/base/base_object.h"
@@ -59,6 +61,19 @@ public:
     static constexpr char SIGNATURE = 'W';
 
 private:
+    struct ParseFrame {
+        WantParams params;
+        std::string_view key;  // a view of the parsed string
+        int typeId = 0;
+        int depth = 0;  // the brace depth of the params
+    };
+
+    // write the params at the end of result, so that nested params share one string.
+    void AppendString(std::string &result);
+
+    // put the innermost params into its parent.
+    static void PopFrame(std::vector<ParseFrame> &frames);
+
     WantParams wantParams_;
 };
 }  // namespace AAFwk
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "ohos/aafwk/content/patterns_matcher.h"
@@ -23,6 +24,20 @@ using OHOS::Parcel;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+constexpr int BENCHMARK_LOOPS = 100000;
+
+long long BenchmarkMatch(const PatternsMatcher &matcher, const std::string &str)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_LOOPS; i++) {
+        matcher.match(str);
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() /
+           BENCHMARK_LOOPS;
+}
+}  // namespace
+
 class PatternsMatcherBaseTest : public testing::Test {
 public:
     PatternsMatcherBaseTest()
@@ -170,5 +185,55 @@ HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0400, Function | M
         EXPECT_EQ(PatternsMatcherIn_->match("abcABC12345"), false);
     }
 }
+
+/**
+ * @tc.number: AaFwk_PatternsMatcher_Match_0500
+ * @tc.name: Match
+ * @tc.desc: Match PATTERN type patterns outside and inside the simple subset, and then check result.
+ */
+HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0500, Function | MediumTest | Level1)
+{
+    PatternsMatcher escaped("a\\.b.*", MatchType::PATTERN);
+    EXPECT_EQ(escaped.match("a.b"), true);
+    EXPECT_EQ(escaped.match("a.bcd"), true);
+    EXPECT_EQ(escaped.match("axb"), false);
+    EXPECT_EQ(escaped.match("a.b\n"), false);
+
+    PatternsMatcher regex("[a-c]+d?", MatchType::PATTERN);
+    EXPECT_EQ(regex.match("abcabc"), true);
+    EXPECT_EQ(regex.match("abcd"), true);
+    EXPECT_EQ(regex.match("abce"), false);
+
+    PatternsMatcher copied(regex);
+    EXPECT_EQ(copied.match(std::string_view("cccd")), true);
+    EXPECT_EQ(PatternsMatcher::MatchPattern("a*b", "aaab", MatchType::PATTERN), true);
+}
+
+/**
+ * @tc.number: AaFwk_PatternsMatcher_Match_0600
+ * @tc.name: Match
+ * @tc.desc: Benchmark the matchers of DEFAULT, PREFIX, GLOBAL and PATTERN type.
+ */
+HWTEST_F(PatternsMatcherBaseTest, AaFwk_PatternsMatcher_Match_0600, Function | MediumTest | Level1)
+{
+    const std::string path = "/com/example/myapplication/MainAbility/detail";
+    PatternsMatcher defaultMatcher(path, MatchType::DEFAULT);
+    PatternsMatcher prefixMatcher("/com/example", MatchType::PREFIX);
+    PatternsMatcher globalMatcher("/com/*/MainAbility*", MatchType::GLOBAL);
+    PatternsMatcher patternMatcher("/com/exa.*e/.*Ability/.*", MatchType::PATTERN);
+    PatternsMatcher regexMatcher("/com/[a-z]+/.*", MatchType::PATTERN);
+
+    EXPECT_EQ(defaultMatcher.match(path), true);
+    EXPECT_EQ(prefixMatcher.match(path), true);
+    EXPECT_EQ(globalMatcher.match(path), true);
+    EXPECT_EQ(patternMatcher.match(path), true);
+    EXPECT_EQ(regexMatcher.match(path), true);
+
+    GTEST_LOG_(INFO) << "DEFAULT " << BenchmarkMatch(defaultMatcher, path) << " ns/match";
+    GTEST_LOG_(INFO) << "PREFIX " << BenchmarkMatch(prefixMatcher, path) << " ns/match";
+    GTEST_LOG_(INFO) << "GLOBAL " << BenchmarkMatch(globalMatcher, path) << " ns/match";
+    GTEST_LOG_(INFO) << "PATTERN " << BenchmarkMatch(patternMatcher, path) << " ns/match";
+    GTEST_LOG_(INFO) << "PATTERN regex " << BenchmarkMatch(regexMatcher, path) << " ns/match";
+}
 }  // namespace AAFwk
 }  // namespace OHOS
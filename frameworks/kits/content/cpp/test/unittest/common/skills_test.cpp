@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "ohos/aafwk/content/skills.h"
@@ -907,5 +908,83 @@ INSTANTIATE_TEST_CASE_P(SkillsParamsTestCaseP, SkillsParamsTest,
         testParamsType(std::string(LARGE_STR_LEN + 1, 'k'), std::string(LARGE_STR_LEN + 1, 'k')),
         testParamsType("#$%^&*(!@\":<>{},/", "#$%^&*(!@\":<>{},/")));
 
+/**
+ * @tc.number: AaFwk_Skills_match_0200
+ * @tc.name: Match
+ * @tc.desc: Verify the data match of schemes, authorities, path patterns and types, and that a change of the
+ *           skills takes effect on the next match.
+ */
+HWTEST_F(SkillsBaseTest, AaFwk_Skills_match_0200, Function | MediumTest | Level1)
+{
+    base_->AddEntity("entity.system.home");
+    base_->AddAction("action.system.view");
+    base_->AddScheme("http");
+    base_->AddAuthority("www.example.com");
+    base_->AddPath("/data", MatchType::PREFIX);
+    base_->AddType("image/*");
+
+    Want want;
+    want.AddEntity("entity.system.home");
+    want.SetAction("action.system.view");
+    want.SetUri("http://www.example.com/data/1");
+    want.SetType("image/png");
+    EXPECT_EQ(true, base_->Match(want));
+
+    want.SetType("video/mp4");
+    EXPECT_EQ(false, base_->Match(want));
+
+    want.SetType("image/png");
+    want.SetUri("http://www.example.com/other/1");
+    EXPECT_EQ(false, base_->Match(want));
+
+    base_->AddPath("/other/*", MatchType::GLOBAL);
+    EXPECT_EQ(true, base_->Match(want));
+
+    base_->RemoveAction("action.system.view");
+    EXPECT_EQ(false, base_->Match(want));
+}
+
+/**
+ * @tc.number: AaFwk_Skills_match_0300
+ * @tc.name: Match
+ * @tc.desc: Benchmark resolving a want against 5000 skills.
+ */
+HWTEST_F(SkillsBaseTest, AaFwk_Skills_match_0300, Function | MediumTest | Level1)
+{
+    constexpr int skillsCount = 5000;
+    constexpr int loops = 20;
+    std::vector<Skills> skillsList(skillsCount);
+    for (int i = 0; i < skillsCount; i++) {
+        std::string index = std::to_string(i);
+        skillsList[i].AddEntity("entity.system.home");
+        skillsList[i].AddEntity("entity.system.entity" + index);
+        skillsList[i].AddAction("action.system.view");
+        skillsList[i].AddAction("action.system.action" + index);
+        skillsList[i].AddScheme("http");
+        skillsList[i].AddAuthority("www.example" + index + ".com");
+        skillsList[i].AddPath("/data/" + index, MatchType::PREFIX);
+        skillsList[i].AddType("image/*");
+    }
+
+    Want want;
+    want.AddEntity("entity.system.home");
+    want.SetAction("action.system.view");
+    want.SetUri("http://www.example" + std::to_string(skillsCount - 1) + ".com/data/" +
+                std::to_string(skillsCount - 1) + "/photo");
+    want.SetType("image/png");
+
+    int matched = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; loop++) {
+        matched = 0;
+        for (auto &skills : skillsList) {
+            matched += skills.Match(want) ? 1 : 0;
+        }
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(1, matched);
+    GTEST_LOG_(INFO) << "resolving a want against " << skillsCount << " skills costs " << cost.count() / loops
+                     << " us";
+}
 }  // namespace AAFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
@@ -13,14 +13,17 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
+#include "ohos/aafwk/base/array_wrapper.h"
 #include "ohos/aafwk/base/string_wrapper.h"
 #include "ohos/aafwk/base/bool_wrapper.h"
 #include "ohos/aafwk/base/int_wrapper.h"
 #include "ohos/aafwk/base/long_wrapper.h"
 
 #include "ohos/aafwk/content/want_params.h"
+#include "ohos/aafwk/content/want_params_wrapper.h"
 
 using namespace testing::ext;
 using namespace OHOS::AAFwk;
@@ -137,5 +140,95 @@ HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Parcelable_0400, Function | Medium
     std::shared_ptr<WantParams> wantParamsOut_(WantParams::Unmarshalling(in));
     EXPECT_EQ(valueLong, Long::Unbox(ILong::Query(wantParamsOut_->GetParam(keyStr))));
 }
+
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0100
+ * @tc.name: WantParams
+ * @tc.desc: copy WantParams, and then check that the copy keeps all values and owns its arrays.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0100, Function | MediumTest | Level1)
+{
+    WantParams nested;
+    nested.SetParam("nestedKey", String::Box("nestedValue"));
+    sptr<IArray> array = new Array(2, g_IID_IInteger);
+    array->Set(0, Integer::Box(1));
+    array->Set(1, Integer::Box(2));
+    sptr<IArray> emptyArray = new Array(0, g_IID_IString);
+    wantParamsIn_->SetParam("string", String::Box("value"));
+    wantParamsIn_->SetParam("bool", Boolean::Box(true));
+    wantParamsIn_->SetParam("long", Long::Box(1234567));
+    wantParamsIn_->SetParam("array", array);
+    wantParamsIn_->SetParam("emptyArray", emptyArray);
+    wantParamsIn_->SetParam("nested", WantParamWrapper::Box(nested));
+
+    WantParams copy(*wantParamsIn_);
+    EXPECT_EQ(wantParamsIn_->Size(), copy.Size());
+    EXPECT_EQ("value", String::Unbox(IString::Query(copy.GetParam("string"))));
+    EXPECT_EQ(true, Boolean::Unbox(IBoolean::Query(copy.GetParam("bool"))));
+    EXPECT_EQ(1234567, Long::Unbox(ILong::Query(copy.GetParam("long"))));
+    WantParams nestedCopy = WantParamWrapper::Unbox(IWantParams::Query(copy.GetParam("nested")));
+    EXPECT_EQ("nestedValue", String::Unbox(IString::Query(nestedCopy.GetParam("nestedKey"))));
+
+    IArray *copyArray = IArray::Query(copy.GetParam("array"));
+    ASSERT_NE(nullptr, copyArray);
+    EXPECT_NE(IArray::Query(array), copyArray);
+    array->Set(0, Integer::Box(100));
+    sptr<IInterface> first = nullptr;
+    copyArray->Get(0, first);
+    EXPECT_EQ(1, Integer::Unbox(IInteger::Query(first)));
+    EXPECT_TRUE(copy.HasParam("emptyArray"));
+}
+
+/**
+ * @tc.number: AaFwk_WantParams_Copy_0200
+ * @tc.name: WantParams
+ * @tc.desc: benchmark copy, lookup and marshalling of WantParams with 50 keys.
+ */
+HWTEST_F(WantParamsBaseTest, AaFwk_WantParams_Copy_0200, Function | MediumTest | Level1)
+{
+    constexpr int keyCount = 50;
+    constexpr int loops = 1000;
+    for (int i = 0; i < keyCount; i++) {
+        std::string key = "key" + std::to_string(i);
+        if (i % 2 == 0) {
+            wantParamsIn_->SetParam(key, Integer::Box(i));
+        } else {
+            wantParamsIn_->SetParam(key, String::Box("value" + std::to_string(i)));
+        }
+    }
+    std::vector<std::string> intKeys;
+    for (int i = 0; i < keyCount; i += 2) {
+        intKeys.emplace_back("key" + std::to_string(i));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; loop++) {
+        WantParams copy(*wantParamsIn_);
+        EXPECT_EQ(keyCount, copy.Size());
+    }
+    auto copyCost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    long sum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; loop++) {
+        for (auto &key : intKeys) {
+            sum += Integer::Unbox(IInteger::Query(wantParamsIn_->GetParam(key)));
+        }
+    }
+    auto lookupCost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_GT(sum, 0);
+
+    start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; loop++) {
+        Parcel parcel;
+        EXPECT_TRUE(wantParamsIn_->Marshalling(parcel));
+    }
+    auto marshallingCost =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    GTEST_LOG_(INFO) << "WantParams of " << keyCount << " keys, copy costs " << copyCost.count() / loops
+                     << " ns, lookup of " << intKeys.size() << " keys costs " << lookupCost.count() / loops
+                     << " ns, marshalling costs " << marshallingCost.count() / loops << " ns";
 }
-}
\ No newline at end of file
+}  // namespace AAFwk
+}  // namespace OHOS
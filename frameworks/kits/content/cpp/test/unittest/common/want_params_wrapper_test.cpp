@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <random>
 #include <gtest/gtest.h>
 
 #define private public
@@ -33,6 +35,20 @@ const std::string STRING_WANT_PARAMS_KEY_02 = "key02";
 const std::string STRING_WANT_PARAMS_VALUE_02 = "value02";
 const std::string STRING_WANT_PARAMS_STRING_0201 =
     "{\"key01\":{\"21\":{\"key02\":{\"9\":\"value02\"}}},\"key02\":{\"9\":\"value02\"}}";
+
+// nest params depth times, each level has the params of the next level and a string.
+WantParams MakeNestedParams(int depth)
+{
+    WantParams wantParams;
+    wantParams.SetParam(STRING_WANT_PARAMS_KEY_02, String::Box(STRING_WANT_PARAMS_VALUE_02));
+    for (int level = 0; level < depth; level++) {
+        WantParams outer;
+        outer.SetParam(STRING_WANT_PARAMS_KEY_01, WantParamWrapper::Box(wantParams));
+        outer.SetParam(STRING_WANT_PARAMS_KEY_02, String::Box(STRING_WANT_PARAMS_VALUE_02));
+        wantParams = outer;
+    }
+    return wantParams;
+}
 }  // namespace
 
 class WantParamWrapperBaseTest : public testing::Test {
@@ -337,3 +353,102 @@ HWTEST_F(WantParamWrapperBaseTest, Want_Param_Wrapper_1800, Function | MediumTes
 
     EXPECT_EQ(wantParams_ == wantParams, true);
 }
+
+/**
+ * @tc.number: Want_Param_Wrapper_1900
+ * @tc.name: from ToString to Parse
+ * @tc.desc: Verify the "from ToString to Parse" function with nested params.
+ */
+HWTEST_F(WantParamWrapperBaseTest, Want_Param_Wrapper_1900, Function | MediumTest | Level1)
+{
+    auto wantParamsPtr = WantParamWrapper::Parse(STRING_WANT_PARAMS_STRING_0201);
+    auto wantParams = WantParamWrapper::Unbox(wantParamsPtr);
+    EXPECT_EQ(wantParams.Size(), 2);
+
+    auto nested = WantParamWrapper::Unbox(IWantParams::Query(wantParams.GetParam(STRING_WANT_PARAMS_KEY_01)));
+    EXPECT_EQ(String::Unbox(IString::Query(nested.GetParam(STRING_WANT_PARAMS_KEY_02))), STRING_WANT_PARAMS_VALUE_02);
+    EXPECT_EQ(WantParamWrapper(wantParams).ToString(), STRING_WANT_PARAMS_STRING_0201);
+}
+
+/**
+ * @tc.number: Want_Param_Wrapper_2000
+ * @tc.name: from ToString to Parse
+ * @tc.desc: Verify the round trip of deeply nested params and log its cost.
+ */
+HWTEST_F(WantParamWrapperBaseTest, Want_Param_Wrapper_2000, Function | MediumTest | Level3)
+{
+    constexpr int depth = 1000;
+    WantParamWrapper wantParamWrapper(MakeNestedParams(depth));
+
+    auto start = std::chrono::steady_clock::now();
+    std::string wantParamsString = wantParamWrapper.ToString();
+    auto wantParamsPtr = WantParamWrapper::Parse(wantParamsString);
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    GTEST_LOG_(INFO) << "round trip of params nested " << depth << " times costs " << cost.count() << " us";
+
+    ASSERT_NE(wantParamsPtr, nullptr);
+    EXPECT_EQ(static_cast<WantParamWrapper *>(wantParamsPtr.GetRefPtr())->ToString(), wantParamsString);
+}
+
+/**
+ * @tc.number: Want_Param_Wrapper_2100
+ * @tc.name: from ToString to Parse
+ * @tc.desc: Verify the round trip of params with 1000 keys and log its cost.
+ */
+HWTEST_F(WantParamWrapperBaseTest, Want_Param_Wrapper_2100, Function | MediumTest | Level3)
+{
+    constexpr int keyCount = 1000;
+    WantParams wantParams;
+    for (int i = 0; i < keyCount; i++) {
+        wantParams.SetParam("key" + std::to_string(i), String::Box("value" + std::to_string(i)));
+    }
+    WantParamWrapper wantParamWrapper(wantParams);
+
+    auto start = std::chrono::steady_clock::now();
+    std::string wantParamsString = wantParamWrapper.ToString();
+    auto wantParamsPtr = WantParamWrapper::Parse(wantParamsString);
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    GTEST_LOG_(INFO) << "round trip of params with " << keyCount << " keys costs " << cost.count() << " us";
+
+    auto wantParamsOut = WantParamWrapper::Unbox(wantParamsPtr);
+    EXPECT_EQ(wantParamsOut.Size(), keyCount);
+    EXPECT_EQ(wantParams == wantParamsOut, true);
+}
+
+/**
+ * @tc.number: Want_Param_Wrapper_2200
+ * @tc.name: Parse
+ * @tc.desc: Verify the "Parse" function with strings of damaged structure.
+ */
+HWTEST_F(WantParamWrapperBaseTest, Want_Param_Wrapper_2200, Function | MediumTest | Level2)
+{
+    constexpr int loops = 2000;
+    const std::string source = WantParamWrapper(MakeNestedParams(3)).ToString();
+    // only the structure is damaged, the values are left to their own parsers.
+    const std::string symbols = "{}\":,";
+    std::vector<size_t> positions;
+    for (size_t pos = 0; pos < source.size(); pos++) {
+        if (symbols.find(source[pos]) != std::string::npos) {
+            positions.emplace_back(pos);
+        }
+    }
+    std::mt19937 random(0);
+    for (int loop = 0; loop < loops; loop++) {
+        std::string damaged = source;
+        size_t pos = positions[random() % positions.size()];
+        switch (random() % 3) {
+            case 0:
+                damaged.erase(pos, 1);
+                break;
+            case 1:
+                damaged.insert(pos, 1, symbols[random() % symbols.size()]);
+                break;
+            default:
+                damaged[pos] = symbols[random() % symbols.size()];
+                break;
+        }
+        auto wantParamsPtr = WantParamWrapper::Parse(damaged);
+        ASSERT_NE(wantParamsPtr, nullptr);
+        static_cast<WantParamWrapper *>(wantParamsPtr.GetRefPtr())->ToString();
+    }
+}
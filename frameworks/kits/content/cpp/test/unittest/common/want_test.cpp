@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "ohos/aafwk/content/want.h"
@@ -3897,5 +3898,67 @@ HWTEST_F(WantBaseTest, AaFwk_Want_HasParameter_0200, Function | MediumTest | Lev
     std::shared_ptr<Want> p2(newWant);
     CompareWant(p1, p2);
 }
+
+/**
+ * @tc.number:  AaFwk_Want_ParseUri_ToUri_1500
+ * @tc.name: ParseUri and ToUri
+ * @tc.desc: Verify the function when params of different types have special characters.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_ParseUri_ToUri_1500, Function | MediumTest | Level1)
+{
+    std::vector<std::string> array = {"a;b", "c=d", "e\\f"};
+    Want wantOrigin;
+    wantOrigin.SetAction("action;=\\");
+    wantOrigin.SetParam("bool;", true);
+    wantOrigin.SetParam("int=", 100);
+    wantOrigin.SetParam("long\\", 10000000000L);
+    wantOrigin.SetParam("string", std::string("\\075\\073;="));
+    wantOrigin.SetParam("array", array);
+
+    std::string uri = wantOrigin.ToUri();
+    std::unique_ptr<Want> wantNew(Want::ParseUri(uri));
+    ASSERT_NE(nullptr, wantNew);
+    EXPECT_EQ(wantOrigin.GetAction(), wantNew->GetAction());
+    EXPECT_EQ(true, wantNew->GetBoolParam("bool;", false));
+    EXPECT_EQ(100, wantNew->GetIntParam("int=", 0));
+    EXPECT_EQ(10000000000L, wantNew->GetLongParam("long\\", 0));
+    EXPECT_EQ("\\075\\073;=", wantNew->GetStringParam("string"));
+    EXPECT_EQ(array, wantNew->GetStringArrayParam("array"));
+    EXPECT_EQ(uri, wantNew->ToUri());
+}
+
+/**
+ * @tc.number:  AaFwk_Want_ParseUri_ToUri_1600
+ * @tc.name: ParseUri and ToUri
+ * @tc.desc: Verify the round trip of Want with 0, 10 and 100 params and log its cost.
+ */
+HWTEST_F(WantBaseTest, AaFwk_Want_ParseUri_ToUri_1600, Function | MediumTest | Level3)
+{
+    constexpr int loops = 1000;
+    for (int paramCount : {0, 10, 100}) {
+        Want want;
+        want.SetAction("action.system.test");
+        want.AddEntity("entity.system.test");
+        want.SetElementName("device", "com.example.bundle", "MainAbility");
+        for (int i = 0; i < paramCount; i++) {
+            std::string key = "key" + std::to_string(i);
+            if (i % 2 == 0) {
+                want.SetParam(key, "value=" + std::to_string(i));
+            } else {
+                want.SetParam(key, i);
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int loop = 0; loop < loops; loop++) {
+            std::unique_ptr<Want> result(Want::ParseUri(want.ToUri()));
+            ASSERT_NE(nullptr, result);
+            EXPECT_EQ(paramCount, result->GetParams().Size());
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        GTEST_LOG_(INFO) << "uri round trip of Want with " << paramCount << " params costs " << cost.count() / loops
+                         << " ns";
+    }
+}
 }  // namespace AAFwk
 }  // namespace OHOS
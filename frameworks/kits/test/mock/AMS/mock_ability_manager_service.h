@@ -37,6 +37,11 @@ public:
     ~MockAbilityManagerService();
     int StartAbility(const Want &want, int requestCode = -1) override;
     int StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
+    int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override
+    {
+        return 0;
+    }
     int TerminateAbility(
         const sptr<IRemoteObject> &token, int resultCode = -1, const Want *resultWant = nullptr) override;
     int ConnectAbility(
@@ -87,6 +92,10 @@ public:
         const int32_t numMax, const int32_t flags, std::vector<AbilityMissionInfo> &recentList) override;
 
     int GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot) override;
+    int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot) override
+    {
+        return 0;
+    }
 
     int RemoveMission(int id) override;
 
@@ -36,6 +36,11 @@ public:
     ~MockServiceAbilityManagerService();
     int StartAbility(const Want &want, int requestCode = -1) override;
     int StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
+    int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override
+    {
+        return 0;
+    }
     int TerminateAbility(
         const sptr<IRemoteObject> &token, int resultCode = -1, const Want *resultWant = nullptr) override;
     int ConnectAbility(
@@ -125,6 +130,11 @@ public:
         return 0;
     }
 
+    int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+    {
+        return 0;
+    }
+
     sptr<IAbilityScheduler> abilityScheduler_ = nullptr;  // kit interface used to schedule ability life
     Want want_;
     bool startAbility = false;
@@ -108,6 +108,17 @@ public:
      */
     ErrCode StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1);
 
+    /**
+     * StartAbilities, start the abilities in order, only the last one is brought to the front.
+     *
+     * @param wants, the wants of the abilities to start.
+     * @param callerToken, caller ability token.
+     * @param requestCode Ability request code.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1);
+
     /**
      * TerminateAbility with want, return want from ability manager service.
      *
@@ -230,6 +241,15 @@ public:
      */
     ErrCode GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot);
 
+    /**
+     * Update the snapshot of the mission, it is served by GetMissionSnapshot until the mission is removed.
+     *
+     * @param missionId the id of the mission.
+     * @param snapshot the snapshot, its pixels are sent through shared memory.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    ErrCode UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot);
+
     /**
      * Ask that the mission associated with a given mission ID be moved to the
      * front of the stack, so it is now visible to the user.
@@ -209,6 +209,11 @@ enum {
      * Result(2097193) for system is lock mission state.
      */
     LOCK_MISSION_STATE_DENY_REQUEST,
+
+    /**
+     * Result(2097194) for StartAbility: The waiting queue is full.
+     */
+    START_ABILITY_QUEUE_FULL,
 };
 
 enum {
@@ -36,6 +36,7 @@
 namespace OHOS {
 namespace AAFwk {
 const std::string ABILITY_MANAGER_SERVICE_NAME = "AbilityManagerService";
+constexpr size_t MAX_START_ABILITIES = 16;
 /**
  * @class IAbilityManager
  * IAbilityManager interface is used to access ability manager services.
@@ -63,6 +64,18 @@ public:
      */
     virtual int StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1) = 0;
 
+    /**
+     * StartAbilities, start the abilities in order, as if each one was started by the previous one.
+     * Only the last ability is brought to the front, the others are loaded when they are returned to.
+     *
+     * @param wants, the wants of the abilities to start, at most MAX_START_ABILITIES.
+     * @param callerToken, caller ability token.
+     * @param requestCode, Ability request code.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) = 0;
+
     /**
      * TerminateAbility, terminate the special ability.
      *
@@ -236,6 +249,15 @@ public:
      */
     virtual int GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot) = 0;
 
+    /**
+     * Update the snapshot of the mission, it is served by GetMissionSnapshot until the mission is removed.
+     *
+     * @param missionId the id of the mission.
+     * @param snapshot the snapshot, its pixels are sent through shared memory.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot) = 0;
+
     /**
      * Ask that the mission associated with a given mission ID be moved to the
      * front of the stack, so it is now visible to the user.
@@ -494,6 +516,12 @@ public:
 
         GET_PENDING_REQUEST_WANT,
 
+        // ipc id for starting abilities in one request
+        START_ABILITIES,
+
+        // ipc id for updating the snapshot of a mission
+        UPDATE_MISSION_SNAPSHOT,
+
         // ipc id 2001-3000 for tools
         // ipc id for dumping state (2001)
         DUMP_STATE = 2001,
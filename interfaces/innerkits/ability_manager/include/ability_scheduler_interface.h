@@ -21,13 +21,17 @@
 #include "dummy_values_bucket.h"
 #include "dummy_data_ability_predicates.h"
 #include "dummy_result_set.h"
+#include "data_ability_operation.h"
+#include "data_ability_result.h"
 #include "lifecycle_state_info.h"
 #include "pac_map.h"
 #include "want.h"
 
 namespace OHOS {
 namespace AAFwk {
+using OHOS::AppExecFwk::DataAbilityOperation;
 using OHOS::AppExecFwk::DataAbilityPredicates;
+using OHOS::AppExecFwk::DataAbilityResult;
 using OHOS::AppExecFwk::PacMap;
 using OHOS::AppExecFwk::ResultSet;
 using OHOS::AppExecFwk::ValuesBucket;
@@ -42,6 +46,8 @@ public:
 
     /*
      * ScheduleAbilityTransaction,  schedule ability to transform life state.
+     * The lifecycle scheduling calls are one-way, they return without waiting for the app, the app reports
+     * the result by AbilityTransitionDone or the other done calls of the ability manager.
      *
      * @param Want, Special Want for service type's ability.
      * @param targetState, The lifecycle state to be transformed
@@ -196,6 +202,17 @@ public:
      */
     virtual int BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values) = 0;
 
+    /**
+     * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+     * of the operations before it.
+     *
+     * @param operations Indicates the operations to perform, in order.
+     *
+     * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+     */
+    virtual std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations) = 0;
+
     enum {
         // ipc id for scheduling ability to a state of life cycle
         SCHEDULE_ABILITY_TRANSACTION = 0,
@@ -249,7 +266,10 @@ public:
         SCHEDULE_BATCHINSERT,
 
         // ipc id for display unlock message
-        DISPLAY_UNLOCK_MISSION_MESSAGE
+        DISPLAY_UNLOCK_MISSION_MESSAGE,
+
+        // ipc id for scheduling ExecuteBatch
+        SCHEDULE_EXECUTEBATCH
     };
 };
 }  // namespace AAFwk
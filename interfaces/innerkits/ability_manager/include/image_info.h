@@ -19,6 +19,8 @@
 #include <string>
 
 #include "ability_record_info.h"
+#include "ashmem.h"
+#include "message_parcel.h"
 #include "mission_description_info.h"
 #include "parcel.h"
 #include "want.h"
@@ -56,19 +58,35 @@ struct ImageInfo : public Parcelable {
     /**
      * Size of the image data (in bytes)
      */
-    uint32_t dataSize;
+    uint32_t dataSize = 0;
 
-    uint8_t *data;
+    uint8_t *data = nullptr;
 
-    uint32_t userDataSize;
+    uint32_t userDataSize = 0;
     /**
-     * User-defined data
+     * User-defined data, it is not transferred.
      */
-    void *userData;
+    void *userData = nullptr;
+
+    /**
+     * Shared memory holding the image data. On the receiving side data points into its read-only mapping,
+     * which lives as long as pixels.
+     */
+    sptr<Ashmem> pixels;
 
     bool ReadFromParcel(Parcel &parcel);
     virtual bool Marshalling(Parcel &parcel) const override;
     static ImageInfo *Unmarshalling(Parcel &parcel);
+
+    /**
+     * Write the shared memory of the image data after the image, the pixels are not copied into the parcel.
+     */
+    bool WritePixels(MessageParcel &parcel) const;
+
+    /**
+     * Read the shared memory written by WritePixels and map it for reading.
+     */
+    bool ReadPixels(MessageParcel &parcel);
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -16,6 +16,10 @@
 #ifndef OHOS_AppExecFwk_PAC_MAP_NODE_ARRAY_H
 #define OHOS_AppExecFwk_PAC_MAP_NODE_ARRAY_H
 
+#include <string>
+#include <variant>
+#include <vector>
+
 #include "parcel.h"
 #include "base_types.h"
 #include "array_wrapper.h"
@@ -35,7 +39,7 @@ namespace OHOS {
 namespace AppExecFwk {
 class PacMapNodeTypeArray : public PacMapNode {
 public:
-    PacMapNodeTypeArray() : PacMapNode(DT_PACMAP_ARRAY), value_(nullptr)
+    PacMapNodeTypeArray() : PacMapNode(DT_PACMAP_ARRAY)
     {}
     virtual ~PacMapNodeTypeArray() = default;
 
@@ -234,11 +238,12 @@ public:
     virtual bool Unmarshalling(int32_t dataType, Parcel &parcel) override;
 
 private:
-    sptr<AAFwk::IArray> value_;
+    // the values are kept contiguous, char values are stored as bytes.
+    using ArrayValue = std::variant<std::monostate, std::vector<short>, std::vector<int>, std::vector<long>,
+        std::vector<bool>, std::vector<AAFwk::byte>, std::vector<float>, std::vector<double>, std::vector<std::string>>;
+    ArrayValue value_;
 
     void InnerDeepCopy(const PacMapNodeTypeArray *other);
-    bool WriteLongVector(Parcel &parcel, const std::vector<long> &value) const;
-    bool ReadLongVector(Parcel &parcel, std::vector<long> &value);
 
     bool MarshallingArrayString(Parcel &parcel) const;
     bool MarshallingArrayBoolean(Parcel &parcel) const;
@@ -16,6 +16,7 @@
 #define OHOS_AAFWK_INTENT_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "intent_params.h"
@@ -119,9 +120,6 @@ private:
 
     OHOS::AppExecFwk::ElementName element_;
 
-    static const std::string OCT_EQUALSTO;
-    static const std::string OCT_SEMICOLON;
-
     // no object in parcel
     static constexpr int VALUE_NULL = -1;
     // object exist in parcel
@@ -129,10 +127,7 @@ private:
 
 private:
     static bool ParseFlag(const std::string &content, Intent &intent);
-    static std::string Decode(const std::string &str);
-    static std::string Encode(const std::string &str);
-    static bool ParseContent(const std::string &content, std::string &prop, std::string &value);
-    static bool ParseUriInternal(const std::string &content, OHOS::AppExecFwk::ElementName &element, Intent &intent);
+    static bool ParseUriInternal(std::string_view content, OHOS::AppExecFwk::ElementName &element, Intent &intent);
     bool ReadFromParcel(Parcel &parcel);
 };
 
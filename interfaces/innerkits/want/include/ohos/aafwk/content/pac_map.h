@@ -75,6 +75,13 @@ public:
      */
     PacMap DeepCopy(void);
 
+    /**
+     * @brief Creates a read-only snapshot sharing the data of this PacMap, the data is copied only when this
+     * PacMap is changed afterwards. The snapshot is read without locking, it can not be changed.
+     * @return A snapshot of this instance.
+     */
+    PacMap Snapshot(void) const;
+
     /**
      * @brief Adds a short value matching a specified key.
      * @param key A specified key.
@@ -423,12 +430,16 @@ public:
     static PacMap *Unmarshalling(Parcel &parcel);
 
 private:
-    PacMapList data_list_;
-    std::mutex mapLock_;
-
+    // the data is shared with snapshots and running reads, it is copied before it is changed while shared.
+    std::shared_ptr<PacMapList> data_list_ = std::make_shared<PacMapList>();
+    bool readOnly_ = false;
+    mutable std::mutex mapLock_;
+
+    PacMap(const std::shared_ptr<PacMapList> &data, bool readOnly);
+    std::shared_ptr<const PacMapList> GetData(void) const;
+    PacMapList *GetMutableDataLocked(void);
     void DeepCopyData(PacMapList &desPacMapList, const PacMapList &srcPacMapList);
     void ShallowCopyData(PacMapList &desPacMapList, const PacMapList &srcPacMapList);
-    void RemoveDataNode(const std::string &key);
     bool EqualPacMapData(const PacMapList &leftPacMapList, const PacMapList &rightPacMapList);
     bool WriteBaseToParcel(const std::string &key, const std::shared_ptr<PacMapNode> &nodeData, Parcel &parcel) const;
     bool WriteArrayToParcel(const std::string &key, const std::shared_ptr<PacMapNode> &nodeData, Parcel &parcel) const;
@@ -18,6 +18,7 @@
 #include "match_type.h"
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <regex>
 #include "parcel.h"
@@ -65,7 +66,17 @@ public:
     MatchType GetType() const;
 
     /**
-     * @brief Match this PatternsMatcher against a string data.
+     * @brief Match this PatternsMatcher against a string data. A PATTERN type pattern is compiled on the first
+     * match and the compiled pattern is kept for the later ones.
+     *
+     * @param str The desired string to look for.
+     * @return Returns either a valid match constant.
+     */
+    bool match(std::string_view str) const;
+
+    /**
+     * @brief Match this PatternsMatcher against a string data. Kept for the callers built against the old
+     * signature, it calls match(std::string_view).
      *
      * @param str The desired string to look for.
      * @return Returns either a valid match constant.
@@ -81,7 +92,7 @@ public:
      *
      * @return Returns either a valid match constant.
      */
-    static bool MatchPattern(std::string pattern, std::string match, MatchType type);
+    static bool MatchPattern(std::string_view pattern, std::string_view match, MatchType type);
 
     /**
      * @brief Marshals this Sequenceable object into a Parcel.
@@ -98,8 +109,11 @@ public:
     static PatternsMatcher *Unmarshalling(Parcel &parcel);
 
 private:
+    struct CompiledPattern;
+
     std::string pattern_;
     MatchType type_;
+    mutable std::shared_ptr<const CompiledPattern> compiledPattern_;
 
 private:
     /**
@@ -110,7 +124,14 @@ private:
      *
      * @return Returns either a valid match constant.
      */
-    static bool GlobPattern(std::string pattern, std::string match);
+    static bool GlobPattern(std::string_view pattern, std::string_view match);
+
+    /**
+     * @brief Obtains the compiled pattern of a PATTERN type pattern, compiles it on the first call.
+     *
+     * @return Returns the compiled pattern.
+     */
+    std::shared_ptr<const CompiledPattern> GetCompiledPattern() const;
 
     bool ReadFromParcel(Parcel &parcel);
 };
@@ -16,6 +16,7 @@
 #ifndef OHOS_AAFWK_SKILLS_H
 #define OHOS_AAFWK_SKILLS_H
 
+#include <memory>
 #include <vector>
 #include <string>
 #include "want.h"
@@ -399,7 +400,9 @@ public:
     int CountTypes() const;
 
     /**
-     * @brief Match this skill against a Want's data.
+     * @brief Match this skill against a Want's data. The match index of the skill is built on the first match
+     * after a change. The lookups in the index allocate nothing, only the action, type and uri read from the
+     * want are copies.
      *
      * @param want The desired want data to match for.
      */
@@ -458,6 +461,10 @@ private:
     WantParams wantParams_;
     bool hasPartialTypes_ = false;
 
+    // immutable index for Match, dropped on any change of the skill.
+    struct MatchIndex;
+    std::shared_ptr<const MatchIndex> matchIndex_;
+
     // no object in parcel
     static constexpr int VALUE_NULL = -1;
     // object exist in parcel
@@ -467,42 +474,35 @@ private:
     bool ReadFromParcel(Parcel &parcel);
 
     /**
-     * @brief Match this skills against a Want's action.  If the skills does not
-     * specify any actions, the match will always fail.
-     *
-     * @param action The desired action to look for.
+     * @brief Obtains the match index, builds it if the skill has changed since the last match.
      *
-     * @return True if the action is listed in the skills.
+     * @return the match index.
      */
-    bool MatchAction(const std::string &action);
+    const MatchIndex &GetMatchIndex();
 
     /**
      * @brief Match this skills against a Want's data (type, scheme and path).
      *
+     * @param index The match index of this skills.
      * @param type The desired data type to look for.
-     * @param scheme The desired data scheme to look for.
-     * @param data The full data string to match against.
+     * @param want The want whose uri to match against.
      *
      * @return Returns either a valid match constant.
      */
-    int MatchData(const std::string &type, const std::string &scheme, Uri data);
-
-    bool FindMimeType(const std::string &type);
+    int MatchData(const MatchIndex &index, const std::string &type, const Want &want) const;
 
-    bool RegionMatches(const std::string &type, int toffset, const std::string &other, int ooffset, int len);
+    bool FindMimeType(const MatchIndex &index, const std::string &type) const;
 
     /**
-     * @brief Match this skills against a Want's entities.  Each entity in
-     * the Want must be specified by the skills; if any are not in the
-     * skills, the match fails.
+     * @brief Match this skills against a Want's entities.
      *
+     * @param index The match index of this skills.
      * @param entities The entities included in the want, as returned by
      *                   Want.getEntities().
      *
-     * @return If all entities match (success), null; else the name of the
-     *         first entity that didn't match.
+     * @return True if any entity of the want is listed in the skills.
      */
-    std::string MatchEntities(const std::vector<std::string> &entities);
+    bool MatchEntities(const MatchIndex &index, const std::vector<std::string> &entities) const;
 };
 
 }  // namespace AAFwk
@@ -17,6 +17,7 @@
 #define OHOS_AAFWK_WANT_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
@@ -771,8 +772,6 @@ private:
     Operation operation_;
     Want *picker_;
 
-    static const std::string OCT_EQUALSTO;
-    static const std::string OCT_SEMICOLON;
     static const std::string MIME_TYPE;
     static const std::string WANT_HEADER;
 
@@ -783,12 +782,9 @@ private:
 
 private:
     static bool ParseFlag(const std::string &content, Want &want);
-    static std::string Decode(const std::string &str);
-    static std::string Encode(const std::string &str);
-    static bool ParseContent(const std::string &content, std::string &prop, std::string &value);
-    static bool ParseUriInternal(const std::string &content, OHOS::AppExecFwk::ElementName &element, Want &want);
+    static bool ParseUriInternal(std::string_view content, OHOS::AppExecFwk::ElementName &element, Want &want);
     bool ReadFromParcel(Parcel &parcel);
-    static bool CheckAndSetParameters(Want &want, const std::string &key, std::string &prop, const std::string &value);
+    static bool CheckAndSetParameters(Want &want, std::string_view prop, const std::string &value);
     Uri GetLowerCaseScheme(const Uri &uri);
 };
 }  // namespace AAFwk
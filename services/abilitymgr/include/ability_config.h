@@ -35,6 +35,8 @@ const std::string SYSTEM_DIALOG_KEY = "OHOS_RESULT_PERMISSION_KEY";
 
 const std::string DEVICE_MANAGER_BUNDLE_NAME = "com.ohos.devicemanagerui";
 const std::string DEVICE_MANAGER_NAME = "com.ohos.devicemanagerui.MainAbility";
+
+const std::string PENDING_WANT_JOURNAL_PATH = "/data/abilitymgr/pending_want.journal";
 }  // namespace AbilityConfig
 }  // namespace AAFwk
 }  // namespace OHOS
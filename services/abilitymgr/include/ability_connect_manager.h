@@ -19,6 +19,8 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "ability_connect_callback_interface.h"
 #include "ability_event_handler.h"
@@ -333,6 +335,24 @@ private:
      */
     void RemoveServiceAbility(const std::shared_ptr<AbilityRecord> &service);
 
+    /**
+     * AddCallerToIndex, index the service by the caller and the request code, replacing the previous request
+     * code of the same caller.
+     *
+     * @param service, the ptr of the service ability record.
+     * @param callerToken, caller ability token.
+     * @param requestCode, ability request code.
+     */
+    void AddCallerToIndex(
+        const std::shared_ptr<AbilityRecord> &service, const sptr<IRemoteObject> &callerToken, int requestCode);
+
+    /**
+     * RemoveServiceFromIndex, remove the service and its callers from the indexes.
+     *
+     * @param service, the ptr of the service ability record.
+     */
+    void RemoveServiceFromIndex(const std::shared_ptr<AbilityRecord> &service);
+
     /**
      * GetOrCreateServiceRecord.
      *
@@ -406,6 +426,10 @@ private:
     ConnectMapType connectMap_;
     ServiceMapType serviceMap_;
     RecipientMapType recipientMap_;
+    // the indexes of serviceMap_ and connectMap_, they are changed together with the maps.
+    std::unordered_map<IRemoteObject *, std::shared_ptr<AbilityRecord>> serviceTokenIndex_;
+    std::map<std::pair<AbilityRecord *, int>, std::shared_ptr<AbilityRecord>> serviceCallerIndex_;
+    std::unordered_map<int, sptr<IRemoteObject>> connectRecordIndex_;  // connection record id -> callback
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
 
     DISALLOW_COPY_AND_MOVE(AbilityConnectManager);
@@ -41,11 +41,6 @@ public:
      */
     void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override;
 
-private:
-    void ProcessLoadTimeOut(int64_t eventId);
-    void ProcessActiveTimeOut(int64_t eventId);
-    void ProcessInactiveTimeOut(int64_t eventId);
-
 private:
     std::weak_ptr<AbilityManagerService> server_;
 };
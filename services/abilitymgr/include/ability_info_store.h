@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_INFO_STORE_H
+#define OHOS_AAFWK_ABILITY_INFO_STORE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ability_info.h"
+#include "application_info.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityInfoStore
+ * AbilityInfoStore interns the ability and application infos of the ability records, so that all records of
+ * the same ability share one immutable copy instead of a copy each.
+ * The infos are keyed by bundle name, name and the version of the bundle, the version is bumped when the bundle
+ * is added, removed or changed. The store only holds weak references, an info is freed with its last record.
+ * Without the bundle events bumping the versions the store is disabled, and every record gets its own copies.
+ */
+class AbilityInfoStore {
+    DECLARE_DELAYED_SINGLETON(AbilityInfoStore)
+public:
+    static constexpr uint64_t SWEEP_INTERVAL = 256;
+
+    /**
+     * get the shared copy of info, the same content of the same bundle version gets the same copy.
+     *
+     * @param info, the ability info.
+     * @return Returns the shared ability info.
+     */
+    std::shared_ptr<const AppExecFwk::AbilityInfo> Intern(const AppExecFwk::AbilityInfo &info);
+
+    /**
+     * get the shared copy of info, the same content of the same bundle version gets the same copy.
+     *
+     * @param info, the application info.
+     * @return Returns the shared application info.
+     */
+    std::shared_ptr<const AppExecFwk::ApplicationInfo> Intern(const AppExecFwk::ApplicationInfo &info);
+
+    /**
+     * bump the version of bundle, the infos interned afterwards are not shared with the earlier ones.
+     *
+     * @param bundleName, the bundle name, all bundles are bumped if it is empty.
+     */
+    void Invalidate(const std::string &bundleName);
+
+    /**
+     * enable or disable sharing, a disabled store returns a new copy for every info.
+     *
+     * @param enabled, whether the infos are shared.
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * get the approximate bytes of info, including the strings it owns.
+     */
+    static size_t GetMemorySize(const AppExecFwk::AbilityInfo &info);
+    static size_t GetMemorySize(const AppExecFwk::ApplicationInfo &info);
+
+    static bool IsSameInfo(const AppExecFwk::AbilityInfo &left, const AppExecFwk::AbilityInfo &right);
+    static bool IsSameInfo(const AppExecFwk::ApplicationInfo &left, const AppExecFwk::ApplicationInfo &right);
+
+    /**
+     * dump the interned infos, and the metadata bytes per record when every record had its own copies
+     * compared with the shared copies.
+     */
+    void Dump(std::vector<std::string> &info);
+
+    size_t GetSize();
+    uint64_t GetHitCount();
+    uint64_t GetMissCount();
+
+private:
+    template<typename Info>
+    struct StoreEntry {
+        uint64_t version = 0;
+        size_t memorySize = 0;
+        std::weak_ptr<const Info> info;
+    };
+
+    template<typename Info>
+    using StoreTable = std::unordered_map<std::string, std::vector<StoreEntry<Info>>>;
+
+    struct TableUsage {
+        size_t count = 0;       // live interned infos
+        size_t references = 0;  // holders of the infos
+        size_t sharedBytes = 0;
+        size_t copiedBytes = 0;
+    };
+
+    template<typename Info>
+    std::shared_ptr<const Info> InternLocked(StoreTable<Info> &table, const std::string &bundleName, const Info &info);
+    template<typename Info>
+    static void Sweep(StoreTable<Info> &table);
+    template<typename Info>
+    static TableUsage GetUsage(const StoreTable<Info> &table);
+    uint64_t GetVersionLocked(const std::string &bundleName) const;
+
+    std::mutex mutex_;
+    bool enabled_ = true;
+    uint64_t nextVersion_ = 1;
+    uint64_t baseVersion_ = 0;
+    std::unordered_map<std::string, uint64_t> bundleVersions_;
+    StoreTable<AppExecFwk::AbilityInfo> abilityInfos_;
+    StoreTable<AppExecFwk::ApplicationInfo> applicationInfos_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_INFO_STORE_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_LIFECYCLE_TRACER_H
+#define OHOS_AAFWK_ABILITY_LIFECYCLE_TRACER_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @enum LifecycleTransition
+ * LifecycleTransition defines the ability lifecycle transitions measured by AbilityLifecycleTracer.
+ */
+enum LifecycleTransition : uint8_t {
+    TRANSITION_LOAD = 0,  // LoadAbility -> CompleteActive
+    TRANSITION_ACTIVATE,
+    TRANSITION_INACTIVATE,
+    TRANSITION_BACKGROUND,
+    TRANSITION_TERMINATE,
+    TRANSITION_COUNT,
+};
+
+/**
+ * @class LatencyHistogram
+ * LatencyHistogram counts latencies in log-linear buckets, four buckets per power of two microseconds,
+ * so a percentile is off by at most a quarter. Recording is lock free.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 2;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr uint32_t MAX_VALUE_BITS = 27;  // about 134s, longer than any lifecycle timeout
+    static constexpr uint32_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram() = default;
+    ~LatencyHistogram() = default;
+
+    void Record(uint64_t latency);
+
+    /**
+     * get the latency below which the given part of the records are.
+     *
+     * @param percentile, in (0, 100].
+     * @return Returns the upper bound of the bucket holding the percentile in microseconds, 0 if empty.
+     */
+    uint64_t GetPercentile(double percentile) const;
+
+    uint64_t GetCount() const;
+    uint64_t GetMax() const;
+    uint64_t GetAverage() const;
+
+    static uint32_t GetBucketIndex(uint64_t latency);
+    static uint64_t GetBucketUpperBound(uint32_t index);
+
+private:
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> count_ {0};
+    std::atomic<uint64_t> sum_ {0};
+    std::atomic<uint64_t> max_ {0};
+};
+
+/**
+ * @struct LifecycleStats
+ * LifecycleStats holds the latency histograms of every transition for a bundle.
+ */
+struct LifecycleStats {
+    uint16_t bundleId = 0;
+    std::string bundleName;
+    LatencyHistogram histograms[TRANSITION_COUNT];
+};
+
+/**
+ * @class AbilityLifecycleTracer
+ * AbilityLifecycleTracer records the lifecycle transitions of ability records into global and per-bundle
+ * latency histograms and into a fixed size binary trace ring.
+ * Only GetBundleStats takes a lock, records keep the stats of their bundle and record without locking.
+ */
+class AbilityLifecycleTracer {
+public:
+    static constexpr uint32_t TRACE_CAPACITY = 1024;  // power of two
+    static constexpr uint32_t MAX_BUNDLE_COUNT = 128;
+    static constexpr uint32_t TRACE_FORMAT_VERSION = 1;
+    static constexpr uint32_t TRACE_RECORD_SIZE = 20;  // bytes
+
+    enum TracePhase : uint8_t {
+        PHASE_BEGIN = 0,
+        PHASE_COMPLETE,
+    };
+
+    AbilityLifecycleTracer();
+    ~AbilityLifecycleTracer() = default;
+
+    /**
+     * get the stats of the bundle, the bundles beyond MAX_BUNDLE_COUNT share one stats.
+     *
+     * @param bundleName, the bundle name.
+     * @return Returns the stats of the bundle.
+     */
+    std::shared_ptr<LifecycleStats> GetBundleStats(const std::string &bundleName);
+
+    /**
+     * stamp the beginning of a transition.
+     *
+     * @param stats, the stats of the bundle of the record.
+     * @param recordId, the ability record id.
+     * @param transition, the transition.
+     * @return Returns the time stamp in microseconds.
+     */
+    int64_t BeginTransition(
+        const std::shared_ptr<LifecycleStats> &stats, int32_t recordId, LifecycleTransition transition);
+
+    /**
+     * stamp the completion of a transition and record its latency.
+     *
+     * @param stats, the stats of the bundle of the record.
+     * @param recordId, the ability record id.
+     * @param transition, the transition.
+     * @param beginTime, the time stamp returned by BeginTransition.
+     */
+    void CompleteTransition(const std::shared_ptr<LifecycleStats> &stats, int32_t recordId,
+        LifecycleTransition transition, int64_t beginTime);
+
+    const LatencyHistogram &GetHistogram(LifecycleTransition transition) const;
+
+    /**
+     * dump the global and the per-bundle percentiles of every transition.
+     */
+    void Dump(std::vector<std::string> &info);
+
+    /**
+     * dump the trace ring in binary, one hex encoded record per line, oldest first.
+     */
+    void DumpTrace(std::vector<std::string> &info);
+
+    static int64_t GetCurrentTime();
+    static std::string GetTransitionName(LifecycleTransition transition);
+
+private:
+    struct TraceSlot {
+        std::atomic<uint64_t> sequence {0};  // odd while being written
+        std::atomic<uint64_t> time {0};
+        std::atomic<uint64_t> latencyAndRecord {0};
+        std::atomic<uint64_t> bundleAndEvent {0};
+    };
+
+    void WriteTrace(int64_t time, uint32_t latency, int32_t recordId, uint16_t bundleId,
+        LifecycleTransition transition, TracePhase phase);
+    static void DumpHistograms(const std::string &title, const LatencyHistogram *histograms,
+        std::vector<std::string> &info);
+
+    LatencyHistogram histograms_[TRANSITION_COUNT];
+    TraceSlot trace_[TRACE_CAPACITY];
+    std::atomic<uint64_t> traceIndex_ {0};
+
+    std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<LifecycleStats>> bundleStats_;
+    std::shared_ptr<LifecycleStats> otherStats_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_LIFECYCLE_TRACER_H
@@ -53,6 +53,17 @@ public:
      */
     virtual int StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
 
+    /**
+     * StartAbilities, start the abilities in order, only the last one is brought to the front.
+     *
+     * @param wants, the wants of the abilities to start.
+     * @param callerToken, caller ability token.
+     * @param requestCode, Ability request code.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
+
     /**
      * TerminateAbility, terminate the special ability.
      *
@@ -227,6 +238,15 @@ public:
      */
     virtual int GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot) override;
 
+    /**
+     * Update the snapshot of the mission, it is served by GetMissionSnapshot until the mission is removed.
+     *
+     * @param missionId the id of the mission.
+     * @param snapshot the snapshot, its pixels are sent through shared memory.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot) override;
+
     /**
      * Ask that the mission associated with a given mission ID be moved to the
      * front of the stack, so it is now visible to the user.
@@ -23,14 +23,18 @@
 
 #include "ability_connect_manager.h"
 #include "ability_event_handler.h"
+#include "ability_lifecycle_tracer.h"
 #include "ability_manager_stub.h"
+#include "ability_resolve_cache.h"
 #include "ability_stack_manager.h"
+#include "ability_timeout_scheduler.h"
 #include "app_scheduler.h"
 #include "bundlemgr/bundle_mgr_interface.h"
 #include "data_ability_manager.h"
 #include "hilog_wrapper.h"
 #include "iremote_object.h"
 #include "kernal_system_app_manager.h"
+#include "mission_snapshot_cache.h"
 #include "system_ability.h"
 #include "uri.h"
 #include "ability_config.h"
@@ -75,6 +79,21 @@ public:
      */
     virtual int StartAbility(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
 
+    /**
+     * StartAbilities, start the abilities in order, only the last one is brought to the front.
+     * All the wants are resolved, and the page abilities are checked against the lock mission and dialog rules,
+     * before any ability is started. Nothing is started if one of them fails.
+     * The service and system ui abilities are started first in the order of wants, then the page abilities are
+     * put into the stacks together. A start failing after that leaves the abilities started before it running.
+     *
+     * @param wants, the wants of the abilities to start.
+     * @param callerToken, caller ability token.
+     * @param requestCode the resultCode of the abilities to start.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int StartAbilities(
+        const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode = -1) override;
+
     /**
      * TerminateAbility, terminate the special ability.
      *
@@ -190,6 +209,20 @@ public:
      */
     std::shared_ptr<AbilityEventHandler> GetEventHandler();
 
+    /**
+     * GetTimeoutScheduler, get the scheduler of the ability lifecycle timeouts.
+     *
+     * @return Returns AbilityTimeoutScheduler ptr.
+     */
+    std::shared_ptr<AbilityTimeoutScheduler> GetTimeoutScheduler();
+
+    /**
+     * GetLifecycleTracer, get the tracer of the ability lifecycle transitions.
+     *
+     * @return Returns AbilityLifecycleTracer ptr.
+     */
+    std::shared_ptr<AbilityLifecycleTracer> GetLifecycleTracer();
+
     /**
      * SetStackManager, set the user id of stack manager.
      *
@@ -271,6 +304,15 @@ public:
      */
     virtual int GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot) override;
 
+    /**
+     * UpdateMissionSnapshot, store the snapshot of the mission, it is downscaled and kept in shared memory.
+     *
+     * @param missionId, the mission id.
+     * @param snapshot, the snapshot, snapshot.data holds the pixels.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    virtual int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot) override;
+
     /**
      * Ask that the mission associated with a given mission ID be moved to the
      * front of the stack, so it is now visible to the user.
@@ -428,9 +470,7 @@ public:
      */
     void StartSystemUi(const std::string name);
 
-    void HandleLoadTimeOut(int64_t eventId);
-    void HandleActiveTimeOut(int64_t eventId);
-    void HandleInactiveTimeOut(int64_t eventId);
+    void HandleTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord);
 
     // MSG 0 - 20 represents timeout message
     static constexpr uint32_t LOAD_TIMEOUT_MSG = 0;
@@ -462,7 +502,12 @@ public:
         KEY_DUMP_WAIT_QUEUE,
         KEY_DUMP_SERVICE,
         KEY_DUMP_DATA,
-        KEY_DUMP_SYSTEM_UI
+        KEY_DUMP_SYSTEM_UI,
+        KEY_DUMP_RESOLVE_CACHE,
+        KEY_DUMP_TIMEOUT,
+        KEY_DUMP_LIFECYCLE,
+        KEY_DUMP_SNAPSHOT,
+        KEY_DUMP_INFO_STORE
     };
 
     friend class AbilityStackManager;
@@ -501,6 +546,7 @@ private:
 
     bool VerificationToken(const sptr<IRemoteObject> &token);
     void RequestPermission(const Want *resultWant);
+    void RemoveStaleSnapshots();
 
     void DumpInner(const std::string &args, std::vector<std::string> &info);
     void DumpStackListInner(const std::string &args, std::vector<std::string> &info);
@@ -511,7 +557,13 @@ private:
     void DumpStateInner(const std::string &args, std::vector<std::string> &info);
     void DataDumpStateInner(const std::string &args, std::vector<std::string> &info);
     void SystemDumpStateInner(const std::string &args, std::vector<std::string> &info);
+    void DumpResolveCacheInner(const std::string &args, std::vector<std::string> &info);
+    void DumpTimeoutInner(const std::string &args, std::vector<std::string> &info);
+    void DumpLifecycleInner(const std::string &args, std::vector<std::string> &info);
+    void DumpSnapshotInner(const std::string &args, std::vector<std::string> &info);
+    void DumpInfoStoreInner(const std::string &args, std::vector<std::string> &info);
     void DumpFuncInit();
+    void SubscribeBundleEvent();
     using DumpFuncType = void (AbilityManagerService::*)(const std::string &args, std::vector<std::string> &info);
     std::map<uint32_t, DumpFuncType> dumpFuncMap_;
 
@@ -519,6 +571,7 @@ private:
 
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<AbilityEventHandler> handler_;
+    std::shared_ptr<AbilityTimeoutScheduler> timeoutScheduler_;
     ServiceRunningState state_;
     std::unordered_map<int, std::shared_ptr<AbilityStackManager>> stackManagers_;
     std::shared_ptr<AbilityStackManager> currentStackManager_;
@@ -528,6 +581,10 @@ private:
     std::shared_ptr<DataAbilityManager> dataAbilityManager_;
     std::shared_ptr<PendingWantManager> pendingWantManager_;
     std::shared_ptr<KernalSystemAppManager> systemAppManager_;
+    const std::shared_ptr<AbilityResolveCache> resolveCache_;
+    std::shared_ptr<AbilityLifecycleTracer> lifecycleTracer_;
+    std::shared_ptr<MissionSnapshotCache> snapshotCache_;
+    std::shared_ptr<BundleEventSubscriber> bundleEventSubscriber_;
     const static std::map<std::string, AbilityManagerService::DumpKey> dumpMap;
 };
 }  // namespace AAFwk
@@ -16,6 +16,7 @@
 #ifndef OHOS_AAFWK_ABILITY_RECORD_H
 #define OHOS_AAFWK_ABILITY_RECORD_H
 
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <list>
@@ -23,6 +24,7 @@
 #include <vector>
 
 #include "ability_info.h"
+#include "ability_lifecycle_tracer.h"
 #include "ability_token_stub.h"
 #include "app_scheduler.h"
 #include "application_info.h"
@@ -114,7 +116,7 @@ struct AbilityRequest {
     int requestCode = -1;
     bool restart = false;
     sptr<IRemoteObject> callerToken;
-    void Dump(std::vector<std::string> &state)
+    void Dump(std::vector<std::string> &state) const
     {
         std::string dumpInfo = "      want [" + want.ToUri() + "]";
         state.push_back(dumpInfo);
@@ -273,18 +275,26 @@ public:
     std::shared_ptr<AbilityRecord> GetBackAbilityRecord() const;
 
     /**
-     * set event id.
+     * arm the lifecycle timeout of the ability, the pending one is cancelled.
      *
-     * @param eventId
+     * @param msg, the timeout message dispatched to the ability manager.
+     * @param timeOut, the timeout in milliseconds.
+     * @param task, run on timeout instead of dispatching msg if it is not nullptr.
      */
-    void SetEventId(int64_t eventId);
+    void ArmTimeout(uint32_t msg, uint32_t timeOut, const Closure &task = nullptr);
 
     /**
-     * get event id.
+     * cancel the pending lifecycle timeout of the ability.
+     */
+    void CancelTimeout();
+
+    /**
+     * stamp the completion of a lifecycle transition, called when the ability reports the target state.
+     * completing TRANSITION_ACTIVATE completes the pending TRANSITION_LOAD too.
      *
-     * @return eventId
+     * @param transition, the transition completed.
      */
-    int64_t GetEventId() const;
+    void CompleteTransition(LifecycleTransition transition);
 
     /**
      * check whether the ability is ready.
@@ -601,6 +611,11 @@ public:
     void SetKernalSystemAbility();
     bool IsKernalSystemAbility() const;
 
+    /**
+     * revoke the token when the owning manager drops the ability, the token is no longer verified.
+     */
+    void RevokeToken();
+
     void SetLauncherRoot();
     bool IsLauncherRoot() const;
 
@@ -622,13 +637,13 @@ private:
      */
     void GetAbilityTypeString(std::string &typeStr);
     void OnSchedulerDied(const wptr<IRemoteObject> &remote);
-    void SendEvent(uint32_t msg, uint32_t timeOut);
+    void BeginTransition(LifecycleTransition transition);
 
     static int64_t abilityRecordId;
     int recordId_;                                      // record id
     Want want_;                                         // want to start this ability
-    AppExecFwk::AbilityInfo abilityInfo_;               // the ability info get from BMS
-    AppExecFwk::ApplicationInfo applicationInfo_;       // the ability info get from BMS
+    std::shared_ptr<const AppExecFwk::AbilityInfo> abilityInfo_;          // the ability info get from BMS, shared
+    std::shared_ptr<const AppExecFwk::ApplicationInfo> applicationInfo_;  // the application info get from BMS, shared
     sptr<Token> token_;                                 // used to interact with kit and wms
     std::weak_ptr<MissionRecord> missionRecord_;        // mission of this ability
     std::weak_ptr<AbilityRecord> preAbilityRecord_;     // who starts this ability record
@@ -639,10 +654,11 @@ private:
     bool isReady_ = false;                              // is ability thread attached?
     bool isWindowAttached_ = false;                     // Is window of this ability attached?
     bool isLauncherAbility_ = false;                    // is launcher?
-    int64_t eventId_ = 0;                               // post event id
+    std::atomic<uint64_t> timeoutHandle_ {0};           // pending lifecycle timeout
+    std::shared_ptr<LifecycleStats> lifecycleStats_;    // lifecycle latency of the bundle
+    int64_t transitionTime_[TRANSITION_COUNT] = {};     // begin time of the pending transitions, 0 if none
     static constexpr int64_t NANOSECONDS = 1000000000;  // NANOSECONDS mean 10^9 nano second
     static constexpr int64_t MICROSECONDS = 1000000;    // MICROSECONDS mean 10^6 millias second
-    static int64_t g_abilityRecordEventId_;
     sptr<IAbilityScheduler> scheduler_;       // kit scheduler
     bool isTerminating_ = false;              // is terminating ?
     LifeCycleStateInfo lifeCycleStateInfo_;   // target life state info
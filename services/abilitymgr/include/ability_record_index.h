@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_RECORD_INDEX_H
+#define OHOS_AAFWK_ABILITY_RECORD_INDEX_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "ability_record.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityRecordIndex
+ * AbilityRecordIndex maps ability token and record id to the ability records of one mission stack.
+ * It is maintained by MissionStack and MissionRecord, callers must hold the stack lock.
+ */
+class AbilityRecordIndex {
+public:
+    AbilityRecordIndex() = default;
+    virtual ~AbilityRecordIndex() = default;
+
+    /**
+     * add ability record to index, an existing entry is replaced by the new owner mission.
+     *
+     * @param ability, target ability record.
+     * @param missionId, id of the mission which owns the ability record.
+     */
+    void Add(const std::shared_ptr<AbilityRecord> &ability, int missionId);
+
+    /**
+     * remove ability record from index, only if it's still owned by the mission.
+     *
+     * @param ability, target ability record.
+     * @param missionId, id of the mission which owns the ability record.
+     */
+    void Remove(const std::shared_ptr<AbilityRecord> &ability, int missionId);
+
+    /**
+     * get the ability record by token.
+     *
+     * @param token, the token of ability.
+     * @return ability record.
+     */
+    std::shared_ptr<AbilityRecord> GetAbilityRecordByToken(const sptr<IRemoteObject> &token) const;
+
+    /**
+     * get the ability record by record id.
+     *
+     * @param recordId, ability record id.
+     * @return ability record.
+     */
+    std::shared_ptr<AbilityRecord> GetAbilityRecordById(const int64_t recordId) const;
+
+    /**
+     * get the number of indexed ability records.
+     *
+     * @return count.
+     */
+    int GetSize() const;
+
+    void Clear();
+
+private:
+    struct IndexEntry {
+        std::weak_ptr<AbilityRecord> ability;
+        int missionId = -1;
+    };
+
+    std::unordered_map<IRemoteObject *, IndexEntry> tokenIndex_;
+    std::unordered_map<int64_t, IndexEntry> recordIdIndex_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_RECORD_INDEX_H
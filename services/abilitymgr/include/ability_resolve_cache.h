@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+#define OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bundlemgr/bundle_mgr_interface.h"
+#include "common_event_subscriber.h"
+#include "want.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityResolveCache
+ * AbilityResolveCache keeps the recent results of the bundle manager queries used to resolve abilities,
+ * so that starting, connecting and acquiring the same abilities again needs no binder call.
+ * The cache is bounded with least recently used eviction, only successful queries are cached.
+ * The cache is only enabled while the bundle events invalidating it are received.
+ */
+class AbilityResolveCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+    explicit AbilityResolveCache(size_t capacity = DEFAULT_CAPACITY);
+    ~AbilityResolveCache() = default;
+
+    /**
+     * query the ability info matching the resolving fields of want, ask bms on miss.
+     *
+     * @param bms, the bundle manager.
+     * @param want, the want to resolve.
+     * @param abilityInfo, output the ability info.
+     * @return Returns true if the ability is resolved.
+     */
+    bool QueryAbilityInfo(
+        const sptr<AppExecFwk::IBundleMgr> &bms, const Want &want, AppExecFwk::AbilityInfo &abilityInfo);
+
+    /**
+     * query the data ability info matching uri, ask bms on miss.
+     *
+     * @param bms, the bundle manager.
+     * @param uri, the uri of data ability.
+     * @param abilityInfo, output the ability info.
+     * @return Returns true if the ability is resolved.
+     */
+    bool QueryAbilityInfoByUri(
+        const sptr<AppExecFwk::IBundleMgr> &bms, const std::string &uri, AppExecFwk::AbilityInfo &abilityInfo);
+
+    /**
+     * get the default bundle info of bundle, ask bms on miss.
+     *
+     * @param bms, the bundle manager.
+     * @param bundleName, the bundle name.
+     * @param bundleInfo, output the bundle info.
+     * @return Returns true if the bundle info is got.
+     */
+    bool GetBundleInfo(
+        const sptr<AppExecFwk::IBundleMgr> &bms, const std::string &bundleName, AppExecFwk::BundleInfo &bundleInfo);
+
+    /**
+     * drop the results related to bundle, called when the bundle is added, removed or changed.
+     * the implicit query results are dropped as well, since the bundle may match them now.
+     *
+     * @param bundleName, the bundle name, all results are dropped if it is empty.
+     */
+    void Invalidate(const std::string &bundleName);
+
+    void Clear();
+
+    /**
+     * enable or disable the cache, a disabled cache drops its results and asks bms for every query.
+     *
+     * @param enabled, whether the results are cached.
+     */
+    void SetEnabled(bool enabled);
+
+    void Dump(std::vector<std::string> &info);
+
+    uint64_t GetHitCount();
+    uint64_t GetMissCount();
+    uint64_t GetInvalidationCount();
+    size_t GetSize();
+
+private:
+    template<typename Info>
+    struct CacheEntry {
+        std::string key;
+        std::string bundleName;
+        bool implicit = false;
+        Info info;
+    };
+
+    template<typename Info>
+    struct CacheTable {
+        // the most recently used entry is at the front.
+        std::list<CacheEntry<Info>> entries;
+        std::unordered_map<std::string, typename std::list<CacheEntry<Info>>::iterator> index;
+    };
+
+    static std::string MakeWantKey(const Want &want);
+    template<typename Info>
+    bool Lookup(CacheTable<Info> &table, const std::string &key, Info &info);
+    template<typename Info>
+    void Insert(CacheTable<Info> &table, CacheEntry<Info> &&entry);
+    template<typename Info>
+    size_t Erase(CacheTable<Info> &table, const std::string &bundleName);
+    size_t SizeLocked() const;
+    bool IsStaleLocked(const std::string &bundleName, bool implicit, uint64_t generation) const;
+
+    std::mutex mutex_;
+    size_t capacity_;
+    bool enabled_ = true;
+    CacheTable<AppExecFwk::AbilityInfo> abilities_;
+    CacheTable<AppExecFwk::AbilityInfo> uriAbilities_;
+    CacheTable<AppExecFwk::BundleInfo> bundles_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t invalidationCount_ = 0;
+    uint64_t evictionCount_ = 0;
+    // bumped by every invalidation, a query result older than the invalidation of its bundle is not cached.
+    uint64_t generation_ = 0;
+    uint64_t allBundlesGeneration_ = 0;
+    std::unordered_map<std::string, uint64_t> bundleGenerations_;
+};
+
+/**
+ * @class BundleEventSubscriber
+ * BundleEventSubscriber invalidates the resolve cache when a package is added, removed or changed.
+ */
+class BundleEventSubscriber : public EventFwk::CommonEventSubscriber {
+public:
+    BundleEventSubscriber(
+        const EventFwk::CommonEventSubscribeInfo &subscribeInfo, const std::shared_ptr<AbilityResolveCache> &cache);
+    virtual ~BundleEventSubscriber() = default;
+
+    virtual void OnReceiveEvent(const EventFwk::CommonEventData &data) override;
+
+private:
+    std::weak_ptr<AbilityResolveCache> cache_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_RESOLVE_CACHE_H
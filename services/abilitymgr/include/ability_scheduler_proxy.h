@@ -190,6 +190,17 @@ public:
      */
     int BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values) override;
 
+    /**
+     * @brief Performs a batch of operations on the database in one call, an operation may reference the results
+     * of the operations before it.
+     *
+     * @param operations Indicates the operations to perform, in order.
+     *
+     * @return Returns the results of the operations performed, the batch stops at the first failed operation.
+     */
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations) override;
+
 private:
     bool WriteInterfaceToken(MessageParcel &data);
 
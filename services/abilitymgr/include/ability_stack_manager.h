@@ -16,14 +16,15 @@
 #ifndef OHOS_AAFWK_ABILITY_STACK_MANAGER_H
 #define OHOS_AAFWK_ABILITY_STACK_MANAGER_H
 
+#include <atomic>
 #include <mutex>
 #include <list>
-#include <queue>
 #include <unordered_map>
 #include <vector>
 
 #include "ability_info.h"
 #include "ability_record.h"
+#include "ability_start_scheduler.h"
 #include "application_info.h"
 #include "mission_record.h"
 #include "mission_stack.h"
@@ -59,6 +60,23 @@ public:
      */
     int StartAbility(const AbilityRequest &abilityRequest);
 
+    /**
+     * StartAbilities with requests, the abilities are pushed into the stacks in order under one lock.
+     * Only the last ability is loaded or activated, the others are loaded when they are returned to.
+     *
+     * @param abilityRequests, the requests of the abilities to start.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int StartAbilities(const std::vector<AbilityRequest> &abilityRequests);
+
+    /**
+     * check the requests against the lock mission and dialog rules of StartAbilities, nothing is started.
+     *
+     * @param abilityRequests, the requests of the page abilities to start.
+     * @return Returns ERR_OK if the abilities may be started, others on failure.
+     */
+    int CheckStartAbilities(const std::vector<AbilityRequest> &abilityRequests);
+
     /**
      * TerminateAbility with token and result want.
      *
@@ -156,6 +174,23 @@ public:
      */
     std::shared_ptr<MissionRecord> GetMissionRecordFromAllStacks(int id) const;
 
+    /**
+     * whether the mission is in any stack, the stacks are locked.
+     *
+     * @param id, the record id of mission.
+     * @return Returns true if the mission exists.
+     */
+    bool IsExistMission(int id);
+
+    /**
+     * whether an ability of the bundle is in the mission, the stacks are locked.
+     *
+     * @param id, the record id of mission.
+     * @param bundleName, the bundle name.
+     * @return Returns true if the bundle has an ability in the mission.
+     */
+    bool IsExistBundleInMission(int id, const std::string &bundleName);
+
     /**
      * remove the mission record by record id.
      *
@@ -308,7 +343,7 @@ public:
      */
     void UninstallApp(const std::string &bundleName);
 
-    void OnTimeOut(uint32_t msgId, int64_t eventId);
+    void OnTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord);
     bool IsFirstInMission(const sptr<IRemoteObject> &token);
 
     /**
@@ -358,6 +393,17 @@ private:
     int StartAbilityLocked(
         const std::shared_ptr<AbilityRecord> &currentTopAbility, const AbilityRequest &abilityRequest);
 
+    /**
+     * push the ability of the request onto the stacks above currentTopAbility, without scheduling it.
+     *
+     * @param currentTopAbility, the ability below the ability to push.
+     * @param abilityRequest the request of the ability to push.
+     * @param targetAbilityRecord, output the pushed ability.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int PushAbilityLocked(const std::shared_ptr<AbilityRecord> &currentTopAbility,
+        const AbilityRequest &abilityRequest, std::shared_ptr<AbilityRecord> &targetAbilityRecord);
+
     /**
      * TerminateAbilityLocked.
      *
@@ -388,8 +434,9 @@ private:
      * push waitting ability to queue.
      *
      * @param abilityRequest, the request of ability.
+     * @return Returns START_ABILITY_WAITING, START_ABILITY_QUEUE_FULL if the queue is full.
      */
-    void EnqueueWaittingAbility(const AbilityRequest &abilityRequest);
+    int EnqueueWaittingAbility(const AbilityRequest &abilityRequest);
 
     /**
      * start waitting ability.
@@ -425,20 +472,6 @@ private:
      */
     bool IsLauncherMission(int id);
 
-    /**
-     * Get the list of the missions that the user has recently launched,
-     * with the most recent being first and older ones after in order.
-     *
-     * @param recentList recent mission info
-     * @param numMax The maximum number of entries to return in the list. The
-     * actual number returned may be smaller, depending on how many tasks the
-     * user has started and the maximum number the system can remember.
-     * @param falgs Information about what to return.  May be any combination
-     * of {@link #RECENT_WITH_EXCLUDED} and {@link #RECENT_IGNORE_UNAVAILABLE}.
-     * @return Returns ERR_OK on success, others on failure.
-     */
-    int GetRecentMissionsLocked(const int32_t numMax, const int32_t flags, std::vector<AbilityMissionInfo> &recentList);
-
     void CreateRecentMissionInfo(const MissionRecordInfo &mission, AbilityMissionInfo &recentMissionInfo);
 
     /**
@@ -510,12 +543,7 @@ private:
      */
     std::shared_ptr<AbilityRecord> GetLauncherRootAbility() const;
 
-    /**
-     * Get ability record by event id.
-     * @param eventId
-     * @return Returns target record.
-     */
-    std::shared_ptr<AbilityRecord> GetAbilityRecordByEventId(int64_t eventId) const;
+    void OnTimeOutLocked(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord);
 
     void ActiveTopAbility(const std::shared_ptr<AbilityRecord> &abilityRecord);
     void ActiveTopAbility(const bool isAll, int32_t stackId);
@@ -533,6 +561,46 @@ private:
     bool CanStopInLockMissionState(const std::shared_ptr<AbilityRecord> &terminateAbility) const;
     void SendUnlockMissionMessage();
 
+    /**
+     * StackModel is an immutable copy of the stacks for the read only queries.
+     * It is built on the first query after a change of the stacks and shared by the queries until the next change.
+     */
+    struct StackModel {
+        uint64_t version = 0;
+        bool initialized = false;
+        StackInfo stackInfo;
+        // the missions of the default stack, the unavailable ones included.
+        std::vector<AbilityMissionInfo> recentMissions;
+        std::vector<bool> available;
+        int lockModeState = LockMissionContainer::LockMissionState::LOCK_MISSION_STATE_NONE;
+        // the tokens are held, so that their addresses are not reused while the model is in use.
+        std::unordered_map<IRemoteObject *, sptr<IRemoteObject>> bottomAbilityTokens;
+    };
+
+    /**
+     * StackChangeGuard locks the stacks for a change, the published model is out of date once it is released.
+     */
+    class StackChangeGuard {
+    public:
+        explicit StackChangeGuard(AbilityStackManager &stackManager)
+            : stackManager_(stackManager), guard_(stackManager.stackLock_)
+        {}
+        ~StackChangeGuard()
+        {
+            stackManager_.modelVersion_.fetch_add(1, std::memory_order_release);
+        }
+
+    private:
+        AbilityStackManager &stackManager_;
+        std::lock_guard<std::recursive_mutex> guard_;
+    };
+
+    /**
+     * get the model of the current version, without locking the stacks if it is already published.
+     */
+    std::shared_ptr<const StackModel> GetStackModel();
+    std::shared_ptr<const StackModel> BuildStackModelLocked(uint64_t version);
+
 private:
     const std::string MISSION_NAME_MARK_HEAD = "#";
     const std::string MISSION_NAME_SEPARATOR = ":";
@@ -541,6 +609,8 @@ private:
     int userId_;
     bool powerOffing_ = false;
     std::recursive_mutex stackLock_;
+    std::atomic<uint64_t> modelVersion_ {1};
+    std::shared_ptr<const StackModel> stackModel_;  // accessed by std::atomic_load and std::atomic_store
     std::shared_ptr<MissionStack> launcherMissionStack_;
     std::shared_ptr<MissionStack> defaultMissionStack_;
     std::shared_ptr<MissionStack> currentMissionStack_;
@@ -548,7 +618,7 @@ private:
     std::list<std::shared_ptr<MissionStack>> missionStackList_;
     std::list<std::shared_ptr<AbilityRecord>> terminateAbilityRecordList_;  // abilities on terminating put in this
                                                                             // list.
-    std::queue<AbilityRequest> waittingAbilityQueue_;
+    AbilityStartScheduler waittingAbilityQueue_;
     std::shared_ptr<PowerStorage> powerStorage_;
     // find AbilityRecord by windowToken. one windowToken has one and only one AbilityRecord.
     std::unordered_map<int, std::shared_ptr<AbilityRecord>> windowTokenToAbilityMap_;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_START_SCHEDULER_H
+#define OHOS_AAFWK_ABILITY_START_SCHEDULER_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ability_record.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityStartScheduler
+ * AbilityStartScheduler holds the start requests waiting for the top ability to become active.
+ * Repeated identical starts of a singleton or singletop ability are collapsed, system ui and launcher starts run
+ * before the others, and the number of waiting requests is bounded.
+ * It is not thread safe, it is guarded by the lock of the manager owning it.
+ */
+class AbilityStartScheduler {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    enum Priority {
+        PRIORITY_NORMAL = 0,
+        PRIORITY_HIGH,
+        PRIORITY_COUNT,
+    };
+
+    explicit AbilityStartScheduler(size_t capacity = DEFAULT_CAPACITY);
+    ~AbilityStartScheduler() = default;
+
+    /**
+     * enqueue the start request, a waiting identical start of a singleton or singletop ability is replaced in
+     * place.
+     *
+     * @param abilityRequest, the start request.
+     * @return Returns START_ABILITY_WAITING on success, START_ABILITY_QUEUE_FULL if there is no room.
+     */
+    int Enqueue(const AbilityRequest &abilityRequest);
+
+    /**
+     * dequeue the request to start next, the request with higher priority goes first.
+     *
+     * @param abilityRequest, output the start request.
+     * @return Returns true if a request is dequeued.
+     */
+    bool Dequeue(AbilityRequest &abilityRequest);
+
+    bool IsEmpty() const;
+    size_t GetSize() const;
+    void Clear();
+
+    /**
+     * dump the statistics and the waiting requests in start order.
+     */
+    void Dump(std::vector<std::string> &info) const;
+
+    static Priority GetPriority(const AbilityRequest &abilityRequest);
+
+private:
+    struct WaittingStart {
+        AbilityRequest request;
+        std::string key;
+        Priority priority = PRIORITY_NORMAL;
+        int64_t enqueueTime = 0;
+        uint32_t coalescedCount = 0;
+    };
+
+    using WaittingList = std::list<WaittingStart>;
+
+    static std::string MakeKey(const AbilityRequest &abilityRequest);
+    static bool IsCoalescible(const AbilityRequest &abilityRequest);
+    static bool IsSameStart(WaittingStart &waittingStart, const AbilityRequest &abilityRequest);
+    static int64_t GetCurrentTime();
+
+    size_t capacity_;
+    WaittingList queues_[PRIORITY_COUNT];
+    std::unordered_map<std::string, WaittingList::iterator> coalesceIndex_;
+    uint64_t startCount_ = 0;
+    uint64_t coalesceCount_ = 0;
+    uint64_t rejectCount_ = 0;
+    int64_t totalWaitTime_ = 0;
+    int64_t maxWaitTime_ = 0;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_START_SCHEDULER_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_TIMEOUT_SCHEDULER_H
+#define OHOS_AAFWK_ABILITY_TIMEOUT_SCHEDULER_H
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "event_handler.h"
+
+namespace OHOS {
+namespace AAFwk {
+class AbilityRecord;
+/**
+ * @class AbilityTimeoutScheduler
+ * AbilityTimeoutScheduler keeps the lifecycle timeouts of ability records in a hierarchical timer wheel.
+ * A timeout is armed and cancelled by handle in constant time, and fires with the record it was armed for.
+ * The wheel is advanced on the event handler only while timeouts are pending.
+ */
+class AbilityTimeoutScheduler : public std::enable_shared_from_this<AbilityTimeoutScheduler> {
+public:
+    using TimeoutCallback = std::function<void(uint32_t, const std::shared_ptr<AbilityRecord> &)>;
+
+    static constexpr uint64_t INVALID_HANDLE = 0;
+    static constexpr int64_t TICK = 50;  // ms
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint32_t SLOT_COUNT = 1 << SLOT_BITS;
+    static constexpr uint32_t LEVEL_COUNT = 3;
+
+    /**
+     * @param handler, the handler that advances the wheel, the wheel is advanced by Advance only if it is nullptr.
+     * @param callback, called with the message and the ability record when a timeout without task fires.
+     */
+    AbilityTimeoutScheduler(const std::shared_ptr<AppExecFwk::EventHandler> &handler, const TimeoutCallback &callback);
+    ~AbilityTimeoutScheduler() = default;
+
+    /**
+     * arm a timeout for the ability record.
+     *
+     * @param abilityRecord, the ability record.
+     * @param msgId, the timeout message.
+     * @param timeout, the timeout in milliseconds.
+     * @param task, run on timeout instead of the callback if it is not nullptr.
+     * @return Returns the handle of the timeout.
+     */
+    uint64_t Arm(const std::shared_ptr<AbilityRecord> &abilityRecord, uint32_t msgId, uint32_t timeout,
+        const std::function<void()> &task = nullptr);
+
+    /**
+     * cancel the timeout.
+     *
+     * @param handle, the handle returned by Arm.
+     * @return Returns true if the timeout was pending.
+     */
+    bool Cancel(uint64_t handle);
+
+    /**
+     * advance the wheel to now and fire the timeouts due.
+     *
+     * @param now, the steady clock time in milliseconds.
+     */
+    void Advance(int64_t now);
+
+    size_t GetPendingCount();
+
+    void Dump(std::vector<std::string> &info);
+
+    static int64_t GetCurrentTime();
+
+private:
+    struct TimeoutEntry {
+        uint64_t handle = INVALID_HANDLE;
+        uint32_t msgId = 0;
+        int64_t expires = 0;  // tick
+        std::weak_ptr<AbilityRecord> abilityRecord;
+        std::function<void()> task;
+    };
+
+    using Slot = std::list<TimeoutEntry>;
+
+    struct Location {
+        uint32_t level = 0;
+        uint32_t slot = 0;
+        Slot::iterator iter;
+    };
+
+    void PlaceLocked(Slot &from, Slot::iterator iter);
+    void CascadeLocked(uint32_t level);
+    void ScheduleTickLocked();
+    void OnTick();
+
+    std::mutex mutex_;
+    std::weak_ptr<AppExecFwk::EventHandler> handler_;
+    TimeoutCallback callback_;
+    Slot wheel_[LEVEL_COUNT][SLOT_COUNT];
+    std::unordered_map<uint64_t, Location> index_;
+    uint64_t nextHandle_ = INVALID_HANDLE;
+    int64_t currentTick_ = 0;
+    bool tickPosted_ = false;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_TIMEOUT_SCHEDULER_H
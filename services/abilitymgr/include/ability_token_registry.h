@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_ABILITY_TOKEN_REGISTRY_H
+#define OHOS_AAFWK_ABILITY_TOKEN_REGISTRY_H
+
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "iremote_object.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class AbilityTokenRegistry
+ * AbilityTokenRegistry records all live ability tokens of the service and the manager which owns them.
+ * A token is registered when its ability record is initialized, and removed as soon as its manager drops
+ * the record or the record is destroyed. A registered token always belongs to a record held by a manager.
+ */
+class AbilityTokenRegistry {
+    DECLARE_DELAYED_SINGLETON(AbilityTokenRegistry)
+public:
+    enum TokenOwner {
+        OWNER_NONE = 0,
+        OWNER_STACK_MANAGER,
+        OWNER_CONNECT_MANAGER,
+        OWNER_DATA_ABILITY_MANAGER,
+        OWNER_SYSTEM_APP_MANAGER,
+    };
+
+    /**
+     * register token with its owner, update the owner if the token exists.
+     *
+     * @param token, the token of ability.
+     * @param owner, the manager which owns the ability.
+     */
+    void Register(const sptr<IRemoteObject> &token, TokenOwner owner);
+
+    /**
+     * unregister token.
+     *
+     * @param token, the token of ability.
+     */
+    void Unregister(const sptr<IRemoteObject> &token);
+
+    /**
+     * get the owner of token.
+     *
+     * @param token, the token of ability.
+     * @return the owner of token, OWNER_NONE if the token is not alive.
+     */
+    TokenOwner GetOwner(const sptr<IRemoteObject> &token) const;
+
+    /**
+     * check whether the token belongs to a live ability record.
+     *
+     * @param token, the token of ability.
+     * @return Returns true if the token is alive.
+     */
+    bool IsAlive(const sptr<IRemoteObject> &token) const;
+
+private:
+    mutable std::shared_mutex registryLock_;
+    std::unordered_map<IRemoteObject *, TokenOwner> tokens_;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_ABILITY_TOKEN_REGISTRY_H
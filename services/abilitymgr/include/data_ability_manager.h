@@ -52,6 +52,8 @@ private:
 
 private:
     DataAbilityRecordPtr LoadLocked(const std::string &name, const AbilityRequest &req);
+    sptr<IAbilityScheduler> AcquireLoadedLocked(const std::string &name, const DataAbilityRecordPtr &dataAbilityRecord,
+        const std::shared_ptr<AbilityRecord> &client, bool tryBind);
     void DumpLocked(const char *func, int line);
 
 private:
@@ -19,8 +19,7 @@
 #include <list>
 #include <string>
 #include <memory>
-#include <mutex>
-#include <condition_variable>
+#include <future>
 #include <chrono>
 
 #include "ability_record.h"
@@ -34,7 +33,7 @@ public:
 
 public:
     int StartLoading();
-    int WaitForLoaded(std::mutex &mutex, const std::chrono::system_clock::duration &timeout);
+    int WaitForLoaded(const std::chrono::system_clock::duration &timeout);
     sptr<IAbilityScheduler> GetScheduler();
     int Attach(const sptr<IAbilityScheduler> &scheduler);
     int OnTransitionDone(int state);
@@ -58,7 +57,13 @@ private:
     };
 
 private:
-    std::condition_variable_any loadedCond_{};
+    void NotifyLoaded(int result);
+
+private:
+    // One-shot load result, shared by every acquirer waiting for this data ability.
+    std::promise<int> loadedPromise_{};
+    std::shared_future<int> loadedFuture_{};
+    bool loadedNotified_ = false;
     AbilityRequest request_{};
     AbilityRecordPtr ability_{};
     sptr<IAbilityScheduler> scheduler_{};
@@ -17,8 +17,8 @@
 #define OHOS_AAFWK_KERNAL_SYSTEM_APP_MANAGER_H
 
 #include <mutex>
-#include <queue>
 
+#include "ability_start_scheduler.h"
 #include "mission_record.h"
 #include "mission_stack.h"
 #include "want.h"
@@ -78,7 +78,7 @@ public:
 
     void OnAbilityDied(std::shared_ptr<AbilityRecord> abilityRecord);
 
-    void OnTimeOut(uint32_t msgId, int64_t eventId);
+    void OnTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord);
 
     /**
      * get the ability record by token.
@@ -99,8 +99,9 @@ private:
      * push waitting ability to queue.
      *
      * @param abilityRequest, the request of ability.
+     * @return Returns START_ABILITY_WAITING, START_ABILITY_QUEUE_FULL if the queue is full.
      */
-    void EnqueueWaittingAbility(const AbilityRequest &abilityRequest);
+    int EnqueueWaittingAbility(const AbilityRequest &abilityRequest);
     /**
      * pop waitting ability.
      *
@@ -126,12 +127,7 @@ private:
      * @param abilityName, target ability name.
      */
     static std::string GetFlagOfAbility(const std::string &bundleName, const std::string &abilityName);
-    /**
-     * get the ability record by eventId.
-     *
-     * @return abilityRecord, target ability.
-     */
-    std::shared_ptr<AbilityRecord> GetAbilityRecordByEventId(const int64_t eventId) const;
+    void OnTimeOutLocked(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord);
     /**
      * dispatch ability life cycle .
      *
@@ -153,7 +149,7 @@ private:
 private:
     std::recursive_mutex stackLock_;
     std::list<std::shared_ptr<AbilityRecord>> abilities_;
-    std::queue<AbilityRequest> waittingAbilityQueue_;
+    AbilityStartScheduler waittingAbilityQueue_;
     int userId_;
 };
 }  // namespace AAFwk
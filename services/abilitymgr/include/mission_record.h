@@ -19,6 +19,7 @@
 #include <list>
 
 #include "ability_record.h"
+#include "ability_record_index.h"
 #include "mission_stack.h"
 #include "mission_description_info.h"
 
@@ -133,6 +134,13 @@ public:
      */
     bool IsSameMissionRecord(const std::string &bundleName) const;
 
+    /**
+     * check whether an ability of the bundle is in this mission
+     *
+     * @param bundleName
+     */
+    bool IsExistBundle(const std::string &bundleName) const;
+
     /**
      * Get all the ability information in this mission
      *
@@ -190,6 +198,14 @@ public:
     void SetParentStack(const std::shared_ptr<MissionStack> &parent, int stackId);
     std::shared_ptr<MissionStack> GetParentStack() const;
 
+    /**
+     * set the ability record index of the mission stack which holds this mission.
+     * abilities of this mission are moved from the previous index to the new one.
+     *
+     * @param index: the ability record index, nullptr to detach.
+     */
+    void SetAbilityRecordIndex(const std::shared_ptr<AbilityRecordIndex> &index);
+
     std::string GetName() const
     {
         return bundleName_;
@@ -212,6 +228,7 @@ private:
     bool isLauncherCreate_ = false;
     std::weak_ptr<MissionRecord> preMissionRecord_;
     std::weak_ptr<MissionStack> parentMissionStack_;
+    std::weak_ptr<AbilityRecordIndex> abilityRecordIndex_;
 
     std::shared_ptr<MissionDescriptionInfo> missionDescriptionInfo_ = nullptr;
 };  // namespace AAFwk
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_MISSION_SNAPSHOT_CACHE_H
+#define OHOS_AAFWK_MISSION_SNAPSHOT_CACHE_H
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "image_info.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @class MissionSnapshotCache
+ * MissionSnapshotCache keeps the latest snapshot of each mission in read-only shared memory, downscaled so
+ * that its longest edge fits maxEdge. A snapshot is handed out by sharing its memory, the pixels are never
+ * copied again. The least recently used snapshots are dropped when the memory budget is exceeded.
+ */
+class MissionSnapshotCache {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 32 * 1024 * 1024;  // bytes
+    static constexpr uint16_t DEFAULT_MAX_EDGE = 480;                  // pixels
+
+    explicit MissionSnapshotCache(size_t memoryBudget = DEFAULT_MEMORY_BUDGET, uint16_t maxEdge = DEFAULT_MAX_EDGE);
+    ~MissionSnapshotCache() = default;
+
+    /**
+     * store the snapshot of the mission, replacing the previous one.
+     *
+     * @param missionId, the mission id.
+     * @param image, the snapshot, data holds width * height pixels of up to 4 bytes without padding.
+     * @return Returns ERR_OK on success, others on failure.
+     */
+    int Put(int32_t missionId, const ImageInfo &image);
+
+    /**
+     * get the snapshot of the mission, image shares the memory of the cached snapshot.
+     *
+     * @param missionId, the mission id.
+     * @param image, output the snapshot.
+     * @return Returns true if the mission has a snapshot.
+     */
+    bool Get(int32_t missionId, ImageInfo &image);
+
+    void Remove(int32_t missionId);
+
+    /**
+     * remove the snapshots of the missions for which the predicate is true, it is called without the cache locked.
+     */
+    void RemoveIf(const std::function<bool(int32_t)> &predicate);
+    void Clear();
+
+    size_t GetSize();
+    size_t GetMemoryUsage();
+
+    void Dump(std::vector<std::string> &info);
+
+    /**
+     * downscale the pixels by averaging square blocks, so that the longest edge fits maxEdge.
+     *
+     * @param image, the source image, its pixels are not changed.
+     * @param maxEdge, the longest edge allowed.
+     * @param header, output the header of the downscaled image.
+     * @param pixels, output the downscaled pixels.
+     * @return Returns false if the image data does not match its size.
+     */
+    static bool Downscale(
+        const ImageInfo &image, uint16_t maxEdge, ImageHeader &header, std::vector<uint8_t> &pixels);
+
+private:
+    struct SnapshotEntry {
+        int32_t missionId = -1;
+        ImageHeader header;
+        uint32_t dataSize = 0;
+        sptr<Ashmem> pixels;
+    };
+
+    void EvictLocked();
+
+    std::mutex mutex_;
+    size_t memoryBudget_;
+    uint16_t maxEdge_;
+    size_t memoryUsage_ = 0;
+    std::list<SnapshotEntry> entries_;  // most recently used first
+    std::unordered_map<int32_t, std::list<SnapshotEntry>::iterator> index_;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t evictionCount_ = 0;
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_MISSION_SNAPSHOT_CACHE_H
@@ -21,6 +21,7 @@
 
 #include "ability_info.h"
 #include "application_info.h"
+#include "ability_record_index.h"
 #include "mission_record.h"
 #include "mission_record_info.h"
 #include "want.h"
@@ -161,6 +162,8 @@ private:
     int missionStackId_;
     int userId_;
     std::list<std::shared_ptr<MissionRecord>> missions_;
+    // index of all ability records in missions_, kept up to date by MissionRecord.
+    std::shared_ptr<AbilityRecordIndex> abilityRecordIndex_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
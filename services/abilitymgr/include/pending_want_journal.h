@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_AAFWK_PENDING_WANT_JOURNAL_H
+#define OHOS_AAFWK_PENDING_WANT_JOURNAL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "pending_want_key.h"
+
+namespace OHOS {
+namespace AAFwk {
+/**
+ * @struct JournalRecord
+ * JournalRecord is a pending want record restored from the journal.
+ */
+struct JournalRecord {
+    int32_t uid = -1;
+    int32_t callerUid = -1;
+    std::shared_ptr<PendingWantKey> key;  // the code of the record is set
+};
+
+/**
+ * @class PendingWantJournal
+ * PendingWantJournal keeps the pending want records in an append-only file, so that they survive a restart
+ * of the service with the same codes. Every change appends a record, the file is rewritten with the live
+ * records only once most of it is dead.
+ * Load maps the file and indexes the live records by code and key hash without decoding them, a record is
+ * decoded only when it is restored by its key or its code.
+ * Every load starts a new generation. A record is written again when it is restored, a record neither put nor
+ * restored in the last RECORD_EXPIRE_GENERATIONS generations is dropped by the load.
+ */
+class PendingWantJournal {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 2;
+    static constexpr size_t COMPACT_MIN_DEAD_COUNT = 256;
+    static constexpr uint32_t RECORD_EXPIRE_GENERATIONS = 3;
+
+    explicit PendingWantJournal(const std::string &path);
+    ~PendingWantJournal();
+
+    /**
+     * open the journal file and index the records in it, a torn record at the end is dropped.
+     *
+     * @return Returns false if the file can not be opened.
+     */
+    bool Load();
+
+    /**
+     * allocate a code never used by any record in the journal.
+     */
+    int32_t AllocateCode();
+
+    /**
+     * append the record, replacing the previous record with the same code.
+     *
+     * @param uid, the uid of the bundle owning the record.
+     * @param callerUid, the uid of the caller who created or updated the record last.
+     * @param key, the key of the record, its code identifies the record.
+     * @return Returns true on success.
+     */
+    bool Put(int32_t uid, int32_t callerUid, const std::shared_ptr<PendingWantKey> &key);
+
+    /**
+     * append the removal of the record.
+     *
+     * @param code, the code of the record.
+     * @return Returns true on success.
+     */
+    bool Remove(int32_t code);
+
+    /**
+     * restore the loaded record with the same content as key, it is not restorable again afterwards.
+     *
+     * @param key, the key to find.
+     * @param record, output the restored record.
+     * @return Returns true if the record is restored.
+     */
+    bool Restore(const std::shared_ptr<PendingWantKey> &key, JournalRecord &record);
+
+    /**
+     * restore the loaded record with the code, it is not restorable again afterwards.
+     *
+     * @param code, the code of the record.
+     * @param record, output the restored record.
+     * @return Returns true if the record is restored.
+     */
+    bool Restore(int32_t code, JournalRecord &record);
+
+    /**
+     * append the removal of the records of the bundle not restored yet, the restored records are removed along
+     * with their pending want records.
+     *
+     * @param bundleName, the bundle which is removed.
+     * @return Returns true on success.
+     */
+    bool PurgeBundle(const std::string &bundleName);
+
+    size_t GetLiveCount();
+    size_t GetRestorableCount();
+    size_t GetDeadCount();
+
+    /**
+     * rewrite the file with the live records only.
+     *
+     * @return Returns true on success.
+     */
+    bool Compact();
+
+    /**
+     * hash the fields compared by PendingWantKey::IsEqual, the hash is persisted so it does not depend on the
+     * build or the process, unlike PendingWantKey::GetHashCode.
+     *
+     * @param key, the key of the record.
+     * @return Returns the hash of the key.
+     */
+    static uint64_t GetKeyHash(const std::shared_ptr<PendingWantKey> &key);
+
+private:
+    struct Location {
+        uint64_t offset = 0;
+        uint32_t size = 0;  // bytes of the whole record
+        uint64_t keyHash = 0;
+        uint32_t generation = 0;  // the generation in which the record was written
+        bool restorable = false;
+    };
+
+    bool LoadLocked();
+    bool ReadLocked(const uint8_t *data, size_t size);
+    bool AppendLocked(const std::vector<uint8_t> &record, uint64_t keyHash, int32_t code, bool put);
+    bool DecodeLocked(const Location &location, JournalRecord &record);
+    void DropRestorableLocked(int32_t code, const Location &location);
+    void RefreshLocked(int32_t code, Location location);
+    bool CompactLocked();
+    bool MapLocked();
+    void UnmapLocked();
+    void CloseLocked();
+
+    std::mutex mutex_;
+    std::string path_;
+    int fd_ = -1;
+    uint64_t fileSize_ = 0;
+    const uint8_t *mapping_ = nullptr;  // read only, restorable records are always in it
+    size_t mappingSize_ = 0;
+    int32_t nextCode_ = 1;
+    uint32_t generation_ = 0;
+    size_t deadCount_ = 0;
+    size_t restorableCount_ = 0;
+    std::unordered_map<int32_t, Location> records_;
+    std::unordered_multimap<uint64_t, int32_t> restorableIndex_;  // key hash -> code
+};
+}  // namespace AAFwk
+}  // namespace OHOS
+#endif  // OHOS_AAFWK_PENDING_WANT_JOURNAL_H
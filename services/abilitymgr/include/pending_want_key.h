@@ -16,6 +16,7 @@
 #ifndef OHOS_AAFWK_PENDING_WANT_KEY_H
 #define OHOS_AAFWK_PENDING_WANT_KEY_H
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -54,6 +55,22 @@ public:
     int32_t GetCode();
     int32_t GetUserId();
 
+    /**
+     * calculate hash code of the key content which identifies a pending want.
+     * Only fields compared by IsEqual are used, so equal keys have equal hash codes.
+     *
+     * @return hash code.
+     */
+    size_t GetHashCode();
+
+    /**
+     * compare the content which identifies a pending want.
+     *
+     * @param other, the key to compare with.
+     * @return Returns true if the keys identify the same pending want.
+     */
+    bool IsEqual(const std::shared_ptr<PendingWantKey> &other);
+
 private:
     int32_t type_;
     std::string bundleName_;
@@ -67,6 +84,23 @@ private:
     int32_t userId_;
 };
 
+struct PendingWantKeyHash {
+    size_t operator()(const std::shared_ptr<PendingWantKey> &key) const
+    {
+        return (key == nullptr) ? 0 : key->GetHashCode();
+    }
+};
+
+struct PendingWantKeyEqual {
+    bool operator()(const std::shared_ptr<PendingWantKey> &left, const std::shared_ptr<PendingWantKey> &right) const
+    {
+        if (left == nullptr || right == nullptr) {
+            return left == right;
+        }
+        return left->IsEqual(right);
+    }
+};
+
 }  // namespace AAFwk
 }  // namespace OHOS
 #endif  // OHOS_AAFWK_PENDING_WANT_KEY_H
\ No newline at end of file
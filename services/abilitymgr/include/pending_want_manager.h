@@ -18,7 +18,7 @@
 
 #include <mutex>
 #include <memory>
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -27,6 +27,7 @@
 #include "ability_record.h"
 #include "common_event.h"
 #include "nocopyable.h"
+#include "pending_want_journal.h"
 #include "pending_want_key.h"
 #include "pending_want_record.h"
 #include "pending_want_common_event.h"
@@ -152,6 +153,8 @@ public:
     int32_t PendingWantStartAbilitys(
         const std::vector<WantsInfo> wnatsInfo, const sptr<IRemoteObject> &callerToken, int32_t requestCode);
     int32_t PendingWantPublishCommonEvent(const Want &want, const SenderInfo &senderInfo, int32_t callerUid);
+    bool LoadJournal(const std::string &path);
+    void ClearPendingWantRecord(const std::string &bundleName);
 
 private:
     sptr<IWantSender> GetWantSenderLocked(const int32_t callingUid, const int32_t uid, const int32_t userId,
@@ -163,10 +166,17 @@ private:
         const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key);
 
     sptr<PendingWantRecord> GetPendingWantRecordByCode(int32_t code);
+    sptr<PendingWantRecord> RestorePendingWantRecordLocked(const JournalRecord &journalRecord);
     static int32_t PendingRecordIdCreate();
 
 private:
-    std::map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>> wantRecords_;
+    void RemovePendingWantRecordLocked(const std::shared_ptr<PendingWantKey> &key);
+
+private:
+    std::unordered_map<std::shared_ptr<PendingWantKey>, sptr<PendingWantRecord>, PendingWantKeyHash,
+        PendingWantKeyEqual> wantRecords_;
+    std::unordered_map<int32_t, sptr<PendingWantRecord>> codeRecords_;
+    std::shared_ptr<PendingWantJournal> journal_;
     std::recursive_mutex mutex_;
 };
 }  // namespace AAFwk
@@ -51,24 +51,12 @@ int AbilityConnectManager::TerminateAbility(const std::shared_ptr<AbilityRecord>
     HILOG_INFO("%{public}s called, %{public}d", __func__, __LINE__);
     std::lock_guard<std::recursive_mutex> guard(Lock_);
 
-    std::shared_ptr<AbilityRecord> targetAbility = nullptr;
-    std::for_each(serviceMap_.begin(),
-        serviceMap_.end(),
-        [&targetAbility, &caller, requestCode](ServiceMapType::reference service) {
-            auto callerList = service.second->GetCallerRecordList();
-            for (auto &it : callerList) {
-                if (it->GetCaller() == caller && it->GetRequestCode() == requestCode) {
-                    targetAbility = service.second;
-                    break;
-                }
-            }
-        });
-
-    if (!targetAbility) {
+    auto it = serviceCallerIndex_.find(std::make_pair(caller.get(), requestCode));
+    if (it == serviceCallerIndex_.end()) {
         return ERR_INVALID_VALUE;
     }
 
-    return TerminateAbilityLocked(targetAbility->GetToken());
+    return TerminateAbilityLocked(it->second->GetToken());
 }
 
 int AbilityConnectManager::StopServiceAbility(const AbilityRequest &abilityRequest)
@@ -94,6 +82,7 @@ int AbilityConnectManager::StartAbilityLocked(const AbilityRequest &abilityReque
     GetOrCreateServiceRecord(abilityRequest, false, targetService, isLoadedAbility);
     CHECK_POINTER_AND_RETURN(targetService, ERR_INVALID_VALUE);
 
+    AddCallerToIndex(targetService, abilityRequest.callerToken, abilityRequest.requestCode);
     targetService->AddCallerRecord(abilityRequest.callerToken, abilityRequest.requestCode);
 
     if (!isLoadedAbility) {
@@ -197,6 +186,9 @@ void AbilityConnectManager::GetOrCreateServiceRecord(const AbilityRequest &abili
             targetService->SetCreateByConnectMode();
         }
         serviceMap_.emplace(element.GetURI(), targetService);
+        if (targetService != nullptr) {
+            serviceTokenIndex_.emplace(targetService->GetToken().GetRefPtr(), targetService);
+        }
         isLoadedAbility = false;
     } else {
         targetService = serviceMapIter->second;
@@ -251,6 +243,7 @@ int AbilityConnectManager::ConnectAbilityLocked(const AbilityRequest &abilityReq
     }
     AddConnectDeathRecipient(connect);
     connectMap_.emplace(connect->AsObject(), connectRecordList);
+    connectRecordIndex_[connectRecord->GetRecordId()] = connect->AsObject();
 
     // 5. load or connect ability
     if (!isLoadedAbility) {
@@ -317,12 +310,7 @@ int AbilityConnectManager::AttachAbilityThreadLocked(
     std::lock_guard<std::recursive_mutex> guard(Lock_);
     auto abilityRecord = GetServiceRecordByToken(token);
     CHECK_POINTER_AND_RETURN(abilityRecord, ERR_INVALID_VALUE);
-    if (eventHandler_ != nullptr) {
-        int recordId = abilityRecord->GetRecordId();
-        std::string taskName = std::string("LoadTimeout_") + std::to_string(recordId);
-        eventHandler_->RemoveTask(taskName);
-        eventHandler_->RemoveEvent(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityRecord->GetEventId());
-    }
+    abilityRecord->CancelTimeout();
     std::string element = abilityRecord->GetWant().GetElement().GetURI();
     HILOG_INFO("%{public}s, ability: %{public}s", __func__, element.c_str());
     abilityRecord->SetScheduler(scheduler);
@@ -487,12 +475,8 @@ std::shared_ptr<AbilityRecord> AbilityConnectManager::GetServiceRecordByElementN
 std::shared_ptr<AbilityRecord> AbilityConnectManager::GetServiceRecordByToken(const sptr<IRemoteObject> &token)
 {
     std::lock_guard<std::recursive_mutex> guard(Lock_);
-    auto IsMatch = [token](auto service) {
-        sptr<IRemoteObject> srcToken = service.second->GetToken();
-        return srcToken == token;
-    };
-    auto serviceRecord = std::find_if(serviceMap_.begin(), serviceMap_.end(), IsMatch);
-    if (serviceRecord != serviceMap_.end()) {
+    auto serviceRecord = serviceTokenIndex_.find(token.GetRefPtr());
+    if (serviceRecord != serviceTokenIndex_.end()) {
         return serviceRecord->second;
     }
     return nullptr;
@@ -512,8 +496,16 @@ std::list<std::shared_ptr<ConnectionRecord>> AbilityConnectManager::GetConnectRe
 
 void AbilityConnectManager::RemoveAll()
 {
+    for (auto &service : serviceMap_) {
+        if (service.second) {
+            service.second->RevokeToken();
+        }
+    }
     serviceMap_.clear();
     connectMap_.clear();
+    serviceTokenIndex_.clear();
+    serviceCallerIndex_.clear();
+    connectRecordIndex_.clear();
 }
 
 void AbilityConnectManager::LoadAbility(const std::shared_ptr<AbilityRecord> &abilityRecord)
@@ -548,31 +540,25 @@ void AbilityConnectManager::PostTimeOutTask(const std::shared_ptr<AbilityRecord>
         return;
     }
 
-    int recordId;
-    std::string taskName;
-    int resultCode;
-    uint32_t delayTime;
     if (messageId == AbilityManagerService::LOAD_TIMEOUT_MSG) {
-        // first load ability, There is at most one connect record.
-        recordId = abilityRecord->GetRecordId();
-        taskName = std::string("LoadTimeout_") + std::to_string(recordId);
-        resultCode = LOAD_ABILITY_TIMEOUT;
-        delayTime = AbilityManagerService::LOAD_TIMEOUT;
-    } else {
-        auto connectRecord = abilityRecord->GetConnectingRecord();
-        CHECK_POINTER(connectRecord);
-        recordId = connectRecord->GetRecordId();
-        taskName = std::string("ConnectTimeout_") + std::to_string(recordId);
-        resultCode = CONNECTION_TIMEOUT;
-        delayTime = AbilityManagerService::CONNECT_TIMEOUT;
+        // first load ability, the load timeout is the lifecycle timeout of the service.
+        auto timeoutTask = [abilityRecord, connectManager = shared_from_this()]() {
+            HILOG_WARN("load ability timeout.");
+            connectManager->HandleStartTimeoutTask(abilityRecord, LOAD_ABILITY_TIMEOUT);
+        };
+        abilityRecord->ArmTimeout(messageId, AbilityManagerService::LOAD_TIMEOUT, timeoutTask);
+        return;
     }
 
-    auto timeoutTask = [abilityRecord, connectManager = shared_from_this(), resultCode]() {
-        HILOG_WARN("connect or load ability timeout.");
-        connectManager->HandleStartTimeoutTask(abilityRecord, resultCode);
+    // the connect timeout belongs to the connection, it is removed by the connection record.
+    auto connectRecord = abilityRecord->GetConnectingRecord();
+    CHECK_POINTER(connectRecord);
+    std::string taskName = std::string("ConnectTimeout_") + std::to_string(connectRecord->GetRecordId());
+    auto timeoutTask = [abilityRecord, connectManager = shared_from_this()]() {
+        HILOG_WARN("connect ability timeout.");
+        connectManager->HandleStartTimeoutTask(abilityRecord, CONNECTION_TIMEOUT);
     };
-
-    eventHandler_->PostTask(timeoutTask, taskName, delayTime);
+    eventHandler_->PostTask(timeoutTask, taskName, AbilityManagerService::CONNECT_TIMEOUT);
 }
 
 void AbilityConnectManager::HandleStartTimeoutTask(const std::shared_ptr<AbilityRecord> &abilityRecord, int resultCode)
@@ -634,10 +620,11 @@ int AbilityConnectManager::DispatchInactive(const std::shared_ptr<AbilityRecord>
             state);
         return ERR_INVALID_VALUE;
     }
-    eventHandler_->RemoveEvent(AbilityManagerService::INACTIVE_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
 
     // complete inactive
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
+    abilityRecord->CompleteTransition(TRANSITION_INACTIVATE);
     if (abilityRecord->IsCreateByConnect()) {
         ConnectAbility(abilityRecord);
     } else {
@@ -650,9 +637,7 @@ int AbilityConnectManager::DispatchInactive(const std::shared_ptr<AbilityRecord>
 int AbilityConnectManager::DispatchTerminate(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
     // remove terminate timeout task
-    if (eventHandler_ != nullptr) {
-        eventHandler_->RemoveTask(std::to_string(abilityRecord->GetEventId()));
-    }
+    abilityRecord->CancelTimeout();
     // complete terminate
     TerminateDone(abilityRecord);
     return ERR_OK;
@@ -691,6 +676,7 @@ void AbilityConnectManager::TerminateDone(const std::shared_ptr<AbilityRecord> &
             "transition life state error. expect %{public}s, actual %{public}s", expect.c_str(), actual.c_str());
         return;
     }
+    abilityRecord->CompleteTransition(TRANSITION_TERMINATE);
     DelayedSingleton<AppScheduler>::GetInstance()->MoveToBackground(abilityRecord->GetToken());
 }
 
@@ -711,20 +697,27 @@ bool AbilityConnectManager::IsAbilityConnected(const std::shared_ptr<AbilityReco
 
 void AbilityConnectManager::RemoveConnectionRecordFromMap(const std::shared_ptr<ConnectionRecord> &connection)
 {
-    for (auto &connectCallback : connectMap_) {
-        auto &connectList = connectCallback.second;
-        auto connectRecord = std::find(connectList.begin(), connectList.end(), connection);
-        if (connectRecord != connectList.end()) {
-            HILOG_INFO(
-                "%{public}s: remove connrecord(%{public}d) from maplist", __func__, (*connectRecord)->GetRecordId());
-            connectList.remove(connection);
-            if (connectList.empty()) {
-                HILOG_INFO("%{public}s: remove connlist from map ", __func__);
-                sptr<IAbilityConnection> connect = iface_cast<IAbilityConnection>(connectCallback.first);
-                RemoveConnectDeathRecipient(connect);
-                connectMap_.erase(connectCallback.first);
-            }
-            return;
+    CHECK_POINTER(connection);
+    auto indexIter = connectRecordIndex_.find(connection->GetRecordId());
+    if (indexIter == connectRecordIndex_.end()) {
+        return;
+    }
+    auto connectCallback = connectMap_.find(indexIter->second);
+    connectRecordIndex_.erase(indexIter);
+    if (connectCallback == connectMap_.end()) {
+        return;
+    }
+
+    auto &connectList = connectCallback->second;
+    auto connectRecord = std::find(connectList.begin(), connectList.end(), connection);
+    if (connectRecord != connectList.end()) {
+        HILOG_INFO("%{public}s: remove connrecord(%{public}d) from maplist", __func__, (*connectRecord)->GetRecordId());
+        connectList.erase(connectRecord);
+        if (connectList.empty()) {
+            HILOG_INFO("%{public}s: remove connlist from map ", __func__);
+            sptr<IAbilityConnection> connect = iface_cast<IAbilityConnection>(connectCallback->first);
+            RemoveConnectDeathRecipient(connect);
+            connectMap_.erase(connectCallback);
         }
     }
 }
@@ -738,10 +731,44 @@ void AbilityConnectManager::RemoveServiceAbility(const std::shared_ptr<AbilityRe
     auto it = serviceMap_.find(element);
     if (it != serviceMap_.end()) {
         HILOG_INFO("%{public}s: remove service(%{public}s) from map ", __func__, element.c_str());
+        RemoveServiceFromIndex(it->second);
+        it->second->RevokeToken();
         serviceMap_.erase(it);
     }
 }
 
+void AbilityConnectManager::AddCallerToIndex(
+    const std::shared_ptr<AbilityRecord> &service, const sptr<IRemoteObject> &callerToken, int requestCode)
+{
+    CHECK_POINTER(service);
+    auto caller = Token::GetAbilityRecordByToken(callerToken);
+    CHECK_POINTER(caller);
+    // a caller keeps only its last request code in the caller list of a service.
+    for (auto &callerRecord : service->GetCallerRecordList()) {
+        if (callerRecord->GetCaller() != caller) {
+            continue;
+        }
+        auto it = serviceCallerIndex_.find(std::make_pair(caller.get(), callerRecord->GetRequestCode()));
+        if (it != serviceCallerIndex_.end() && it->second == service) {
+            serviceCallerIndex_.erase(it);
+        }
+    }
+    serviceCallerIndex_[std::make_pair(caller.get(), requestCode)] = service;
+}
+
+void AbilityConnectManager::RemoveServiceFromIndex(const std::shared_ptr<AbilityRecord> &service)
+{
+    CHECK_POINTER(service);
+    serviceTokenIndex_.erase(service->GetToken().GetRefPtr());
+    for (auto &callerRecord : service->GetCallerRecordList()) {
+        auto it = serviceCallerIndex_.find(
+            std::make_pair(callerRecord->GetCaller().get(), callerRecord->GetRequestCode()));
+        if (it != serviceCallerIndex_.end() && it->second == service) {
+            serviceCallerIndex_.erase(it);
+        }
+    }
+}
+
 void AbilityConnectManager::AddConnectDeathRecipient(const sptr<IAbilityConnection> &connect)
 {
     CHECK_POINTER(connect);
@@ -32,49 +32,8 @@ void AbilityEventHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &ev
 {
     CHECK_POINTER(event);
     HILOG_DEBUG("AMSEventHandler::ProcessEvent::inner event id obtained: %u.", event->GetInnerEventId());
-    switch (event->GetInnerEventId()) {
-        case AbilityManagerService::LOAD_TIMEOUT_MSG: {
-            ProcessLoadTimeOut(event->GetParam());
-            break;
-        }
-        case AbilityManagerService::ACTIVE_TIMEOUT_MSG: {
-            ProcessActiveTimeOut(event->GetParam());
-            break;
-        }
-        case AbilityManagerService::INACTIVE_TIMEOUT_MSG: {
-            HILOG_INFO("inactive timeout.");
-            // inactivate pre ability immediately in case blocking next ability start
-            ProcessInactiveTimeOut(event->GetParam());
-            break;
-        }
-        default: {
-            HILOG_WARN("unsupported timeout message.");
-            break;
-        }
-    }
-}
-
-void AbilityEventHandler::ProcessLoadTimeOut(int64_t eventId)
-{
-    HILOG_INFO("attach timeout.");
-    auto server = server_.lock();
-    CHECK_POINTER(server);
-    server->HandleLoadTimeOut(eventId);
-}
-
-void AbilityEventHandler::ProcessActiveTimeOut(int64_t eventId)
-{
-    HILOG_INFO("active timeout.");
-    auto server = server_.lock();
-    CHECK_POINTER(server);
-    server->HandleActiveTimeOut(eventId);
-}
-void AbilityEventHandler::ProcessInactiveTimeOut(int64_t eventId)
-{
-    HILOG_INFO("inactive timeout.");
-    auto server = server_.lock();
-    CHECK_POINTER(server);
-    server->HandleInactiveTimeOut(eventId);
+    // lifecycle timeouts are fired by the timeout scheduler with their record, no event is sent for them.
+    HILOG_WARN("unsupported event.");
 }
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_info_store.h"
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const size_t INLINE_STRING_CAPACITY = std::string().capacity();
+
+size_t GetHeapSize(const std::string &str)
+{
+    // short strings are kept inside the string object itself.
+    return str.capacity() > INLINE_STRING_CAPACITY ? str.capacity() + 1 : 0;
+}
+
+size_t GetHeapSize(const std::vector<std::string> &strs)
+{
+    size_t size = strs.capacity() * sizeof(std::string);
+    for (const auto &str : strs) {
+        size += GetHeapSize(str);
+    }
+    return size;
+}
+}  // namespace
+
+AbilityInfoStore::AbilityInfoStore()
+{}
+
+AbilityInfoStore::~AbilityInfoStore()
+{}
+
+std::shared_ptr<const AppExecFwk::AbilityInfo> AbilityInfoStore::Intern(const AppExecFwk::AbilityInfo &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return InternLocked(abilityInfos_, info.bundleName, info);
+}
+
+std::shared_ptr<const AppExecFwk::ApplicationInfo> AbilityInfoStore::Intern(const AppExecFwk::ApplicationInfo &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return InternLocked(applicationInfos_, info.bundleName, info);
+}
+
+template<typename Info>
+std::shared_ptr<const Info> AbilityInfoStore::InternLocked(
+    StoreTable<Info> &table, const std::string &bundleName, const Info &info)
+{
+    if (!enabled_) {
+        missCount_++;
+        return std::make_shared<const Info>(info);
+    }
+    uint64_t version = GetVersionLocked(bundleName);
+    auto &entries = table[bundleName + "/" + info.name];
+    for (auto iter = entries.begin(); iter != entries.end();) {
+        auto shared = iter->info.lock();
+        if (shared == nullptr) {
+            iter = entries.erase(iter);
+            continue;
+        }
+        if (iter->version == version && IsSameInfo(*shared, info)) {
+            hitCount_++;
+            return shared;
+        }
+        ++iter;
+    }
+
+    missCount_++;
+    auto shared = std::make_shared<const Info>(info);
+    StoreEntry<Info> entry;
+    entry.version = version;
+    entry.memorySize = GetMemorySize(info);
+    entry.info = shared;
+    entries.emplace_back(std::move(entry));
+    if (missCount_ % SWEEP_INTERVAL == 0) {
+        Sweep(abilityInfos_);
+        Sweep(applicationInfos_);
+    }
+    return shared;
+}
+
+template<typename Info>
+void AbilityInfoStore::Sweep(StoreTable<Info> &table)
+{
+    for (auto iter = table.begin(); iter != table.end();) {
+        auto &entries = iter->second;
+        for (auto entry = entries.begin(); entry != entries.end();) {
+            entry = entry->info.expired() ? entries.erase(entry) : entry + 1;
+        }
+        iter = entries.empty() ? table.erase(iter) : std::next(iter);
+    }
+}
+
+uint64_t AbilityInfoStore::GetVersionLocked(const std::string &bundleName) const
+{
+    auto iter = bundleVersions_.find(bundleName);
+    return iter == bundleVersions_.end() ? baseVersion_ : iter->second;
+}
+
+void AbilityInfoStore::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (bundleName.empty()) {
+        bundleVersions_.clear();
+        baseVersion_ = nextVersion_++;
+    } else {
+        bundleVersions_[bundleName] = nextVersion_++;
+    }
+    HILOG_INFO("info store version bumped for bundle: %{public}s", bundleName.c_str());
+}
+
+void AbilityInfoStore::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    enabled_ = enabled;
+    HILOG_INFO("info store %{public}s", enabled ? "enabled" : "disabled");
+}
+
+size_t AbilityInfoStore::GetMemorySize(const AppExecFwk::AbilityInfo &info)
+{
+    return sizeof(AppExecFwk::AbilityInfo) + GetHeapSize(info.name) + GetHeapSize(info.bundleName) +
+           GetHeapSize(info.applicationName) + GetHeapSize(info.package) + GetHeapSize(info.label) +
+           GetHeapSize(info.description) + GetHeapSize(info.iconPath) + GetHeapSize(info.kind) +
+           GetHeapSize(info.process) + GetHeapSize(info.deviceId) + GetHeapSize(info.codePath) +
+           GetHeapSize(info.resourcePath) + GetHeapSize(info.libPath) + GetHeapSize(info.permissions) +
+           GetMemorySize(info.applicationInfo) - sizeof(AppExecFwk::ApplicationInfo);
+}
+
+size_t AbilityInfoStore::GetMemorySize(const AppExecFwk::ApplicationInfo &info)
+{
+    return sizeof(AppExecFwk::ApplicationInfo) + GetHeapSize(info.name) + GetHeapSize(info.bundleName) +
+           GetHeapSize(info.label) + GetHeapSize(info.iconPath) + GetHeapSize(info.deviceId) +
+           GetHeapSize(info.signatureKey) + GetHeapSize(info.codePath) + GetHeapSize(info.dataDir) +
+           GetHeapSize(info.dataBaseDir) + GetHeapSize(info.cacheDir);
+}
+
+bool AbilityInfoStore::IsSameInfo(const AppExecFwk::AbilityInfo &left, const AppExecFwk::AbilityInfo &right)
+{
+    return left.name == right.name && left.bundleName == right.bundleName &&
+           left.applicationName == right.applicationName && left.package == right.package &&
+           left.type == right.type && left.launchMode == right.launchMode && left.kind == right.kind &&
+           left.visible == right.visible && left.isLauncherAbility == right.isLauncherAbility &&
+           left.isNativeAbility == right.isNativeAbility && left.process == right.process &&
+           left.deviceId == right.deviceId && left.label == right.label && left.description == right.description &&
+           left.iconPath == right.iconPath && left.permissions == right.permissions &&
+           left.codePath == right.codePath && left.resourcePath == right.resourcePath &&
+           left.libPath == right.libPath && IsSameInfo(left.applicationInfo, right.applicationInfo);
+}
+
+bool AbilityInfoStore::IsSameInfo(const AppExecFwk::ApplicationInfo &left, const AppExecFwk::ApplicationInfo &right)
+{
+    return left.name == right.name && left.bundleName == right.bundleName &&
+           left.isLauncherApp == right.isLauncherApp && left.label == right.label &&
+           left.iconPath == right.iconPath && left.deviceId == right.deviceId &&
+           left.signatureKey == right.signatureKey && left.codePath == right.codePath &&
+           left.dataDir == right.dataDir && left.dataBaseDir == right.dataBaseDir && left.cacheDir == right.cacheDir;
+}
+
+template<typename Info>
+AbilityInfoStore::TableUsage AbilityInfoStore::GetUsage(const StoreTable<Info> &table)
+{
+    TableUsage usage;
+    for (const auto &iter : table) {
+        for (const auto &entry : iter.second) {
+            size_t references = static_cast<size_t>(entry.info.use_count());
+            if (references == 0) {
+                continue;
+            }
+            usage.count++;
+            usage.references += references;
+            usage.sharedBytes += entry.memorySize;
+            usage.copiedBytes += entry.memorySize * references;
+        }
+    }
+    return usage;
+}
+
+void AbilityInfoStore::Dump(std::vector<std::string> &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto abilities = GetUsage(abilityInfos_);
+    auto applications = GetUsage(applicationInfos_);
+    info.emplace_back("AbilityInfoStore:");
+    info.emplace_back("  hit #" + std::to_string(hitCount_) + "  miss #" + std::to_string(missCount_));
+    info.emplace_back("  ability infos #" + std::to_string(abilities.count) + "  references #" +
+                      std::to_string(abilities.references) + "  bytes #" + std::to_string(abilities.sharedBytes) +
+                      "  copied bytes #" + std::to_string(abilities.copiedBytes));
+    info.emplace_back("  application infos #" + std::to_string(applications.count) + "  references #" +
+                      std::to_string(applications.references) + "  bytes #" +
+                      std::to_string(applications.sharedBytes) + "  copied bytes #" +
+                      std::to_string(applications.copiedBytes));
+    // every record holds one ability info and one application info.
+    size_t records = abilities.references;
+    size_t copiedPerRecord = 0;
+    size_t sharedPerRecord = 0;
+    if (records != 0) {
+        copiedPerRecord = (abilities.copiedBytes + applications.copiedBytes) / records;
+        sharedPerRecord = (abilities.sharedBytes + applications.sharedBytes) / records +
+                          sizeof(std::shared_ptr<const AppExecFwk::AbilityInfo>) +
+                          sizeof(std::shared_ptr<const AppExecFwk::ApplicationInfo>);
+    }
+    info.emplace_back("  records #" + std::to_string(records) + "  bytes per record copied #" +
+                      std::to_string(copiedPerRecord) + "  shared #" + std::to_string(sharedPerRecord));
+}
+
+size_t AbilityInfoStore::GetSize()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return GetUsage(abilityInfos_).count + GetUsage(applicationInfos_).count;
+}
+
+uint64_t AbilityInfoStore::GetHitCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return hitCount_;
+}
+
+uint64_t AbilityInfoStore::GetMissCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return missCount_;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
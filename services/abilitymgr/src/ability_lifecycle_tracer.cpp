@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_lifecycle_tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint64_t MAX_LATENCY = (static_cast<uint64_t>(1) << LatencyHistogram::MAX_VALUE_BITS) - 1;
+constexpr double PERCENT = 100.0;
+constexpr double P50 = 50.0;
+constexpr double P90 = 90.0;
+constexpr double P99 = 99.0;
+constexpr uint32_t UINT64_HIGHEST_BIT = 63;
+constexpr uint64_t MICROSECONDS_PER_MILLISECOND = 1000;
+constexpr uint64_t MICROSECONDS_PER_TENTH = 100;
+constexpr uint32_t TRACE_MASK = AbilityLifecycleTracer::TRACE_CAPACITY - 1;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr uint32_t WORD_HALF_BITS = 32;
+constexpr uint32_t UINT16_BITS = 16;
+constexpr uint64_t UINT8_MASK = 0xff;
+constexpr uint64_t UINT16_MASK = 0xffff;
+constexpr uint64_t UINT32_MASK = 0xffffffff;
+const std::string OTHER_BUNDLES = "others";
+const std::string TRANSITION_NAMES[TRANSITION_COUNT] = { "load", "activate", "inactivate", "background", "terminate" };
+
+std::string FormatLatency(uint64_t latency)
+{
+    return std::to_string(latency / MICROSECONDS_PER_MILLISECOND) + "." +
+           std::to_string((latency % MICROSECONDS_PER_MILLISECOND) / MICROSECONDS_PER_TENTH) + "ms";
+}
+
+void AppendHex(std::string &out, uint64_t value, uint32_t bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+    // little endian, the lowest byte first.
+    for (uint32_t i = 0; i < bytes; i++) {
+        uint8_t byte = static_cast<uint8_t>((value >> (i * BITS_PER_BYTE)) & UINT8_MASK);
+        out += digits[byte >> (BITS_PER_BYTE / 2)];
+        out += digits[byte & 0x0f];
+    }
+}
+}  // namespace
+
+uint32_t LatencyHistogram::GetBucketIndex(uint64_t latency)
+{
+    latency = std::min(latency, MAX_LATENCY);
+    if (latency < SUB_BUCKET_COUNT) {
+        return static_cast<uint32_t>(latency);
+    }
+    uint32_t highestBit = static_cast<uint32_t>(UINT64_HIGHEST_BIT - __builtin_clzll(latency));
+    uint32_t shift = highestBit - SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKET_COUNT + static_cast<uint32_t>((latency >> shift) & (SUB_BUCKET_COUNT - 1));
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(uint32_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+    return lower + (static_cast<uint64_t>(1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t latency)
+{
+    buckets_[GetBucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(latency, std::memory_order_relaxed);
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (latency > max && !max_.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    uint64_t count = GetCount();
+    if (count == 0) {
+        return 0;
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(percentile * count / PERCENT));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(GetBucketUpperBound(i), GetMax());
+        }
+    }
+    return GetMax();
+}
+
+uint64_t LatencyHistogram::GetCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetAverage() const
+{
+    uint64_t count = GetCount();
+    return (count == 0) ? 0 : sum_.load(std::memory_order_relaxed) / count;
+}
+
+AbilityLifecycleTracer::AbilityLifecycleTracer() : otherStats_(std::make_shared<LifecycleStats>())
+{
+    otherStats_->bundleName = OTHER_BUNDLES;
+}
+
+int64_t AbilityLifecycleTracer::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string AbilityLifecycleTracer::GetTransitionName(LifecycleTransition transition)
+{
+    if (transition >= TRANSITION_COUNT) {
+        return "unknown";
+    }
+    return TRANSITION_NAMES[transition];
+}
+
+std::shared_ptr<LifecycleStats> AbilityLifecycleTracer::GetBundleStats(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = bundleStats_.find(bundleName);
+    if (iter != bundleStats_.end()) {
+        return iter->second;
+    }
+    if (bundleStats_.size() >= MAX_BUNDLE_COUNT) {
+        return otherStats_;
+    }
+    auto stats = std::make_shared<LifecycleStats>();
+    // bundle id 0 is left for the other bundles.
+    stats->bundleId = static_cast<uint16_t>(bundleStats_.size() + 1);
+    stats->bundleName = bundleName;
+    bundleStats_.emplace(bundleName, stats);
+    return stats;
+}
+
+int64_t AbilityLifecycleTracer::BeginTransition(
+    const std::shared_ptr<LifecycleStats> &stats, int32_t recordId, LifecycleTransition transition)
+{
+    int64_t now = GetCurrentTime();
+    uint16_t bundleId = (stats == nullptr) ? 0 : stats->bundleId;
+    WriteTrace(now, 0, recordId, bundleId, transition, PHASE_BEGIN);
+    return now;
+}
+
+void AbilityLifecycleTracer::CompleteTransition(const std::shared_ptr<LifecycleStats> &stats, int32_t recordId,
+    LifecycleTransition transition, int64_t beginTime)
+{
+    if (transition >= TRANSITION_COUNT) {
+        return;
+    }
+    int64_t now = GetCurrentTime();
+    uint64_t latency = static_cast<uint64_t>(std::max(now - beginTime, static_cast<int64_t>(0)));
+    histograms_[transition].Record(latency);
+    uint16_t bundleId = 0;
+    if (stats != nullptr) {
+        stats->histograms[transition].Record(latency);
+        bundleId = stats->bundleId;
+    }
+    WriteTrace(now, static_cast<uint32_t>(std::min(latency, UINT32_MASK)), recordId, bundleId, transition,
+        PHASE_COMPLETE);
+}
+
+const LatencyHistogram &AbilityLifecycleTracer::GetHistogram(LifecycleTransition transition) const
+{
+    return histograms_[std::min(transition, static_cast<LifecycleTransition>(TRANSITION_COUNT - 1))];
+}
+
+void AbilityLifecycleTracer::WriteTrace(int64_t time, uint32_t latency, int32_t recordId, uint16_t bundleId,
+    LifecycleTransition transition, TracePhase phase)
+{
+    uint64_t index = traceIndex_.fetch_add(1, std::memory_order_relaxed);
+    TraceSlot &slot = trace_[index & TRACE_MASK];
+    // a reader skips the slot while its sequence is odd or belongs to another round.
+    slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.time.store(static_cast<uint64_t>(time), std::memory_order_relaxed);
+    slot.latencyAndRecord.store((static_cast<uint64_t>(latency) << WORD_HALF_BITS) | static_cast<uint32_t>(recordId),
+        std::memory_order_relaxed);
+    slot.bundleAndEvent.store((static_cast<uint64_t>(bundleId) << UINT16_BITS) |
+        (static_cast<uint64_t>(transition) << BITS_PER_BYTE) | phase, std::memory_order_relaxed);
+    slot.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+void AbilityLifecycleTracer::DumpHistograms(
+    const std::string &title, const LatencyHistogram *histograms, std::vector<std::string> &info)
+{
+    info.emplace_back(title);
+    for (uint32_t i = 0; i < TRANSITION_COUNT; i++) {
+        const LatencyHistogram &histogram = histograms[i];
+        if (histogram.GetCount() == 0) {
+            continue;
+        }
+        info.emplace_back("    " + TRANSITION_NAMES[i] + "  count #" + std::to_string(histogram.GetCount()) +
+                          "  avg #" + FormatLatency(histogram.GetAverage()) +
+                          "  p50 #" + FormatLatency(histogram.GetPercentile(P50)) +
+                          "  p90 #" + FormatLatency(histogram.GetPercentile(P90)) +
+                          "  p99 #" + FormatLatency(histogram.GetPercentile(P99)) +
+                          "  max #" + FormatLatency(histogram.GetMax()));
+    }
+}
+
+void AbilityLifecycleTracer::Dump(std::vector<std::string> &info)
+{
+    info.emplace_back("LifecycleLatency:");
+    DumpHistograms("  all bundles:", histograms_, info);
+
+    std::vector<std::shared_ptr<LifecycleStats>> stats;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const auto &item : bundleStats_) {
+            stats.emplace_back(item.second);
+        }
+        stats.emplace_back(otherStats_);
+    }
+    for (const auto &bundleStats : stats) {
+        bool empty = std::all_of(std::begin(bundleStats->histograms), std::end(bundleStats->histograms),
+            [](const LatencyHistogram &histogram) { return histogram.GetCount() == 0; });
+        if (!empty) {
+            DumpHistograms("  bundle: " + bundleStats->bundleName, bundleStats->histograms, info);
+        }
+    }
+}
+
+void AbilityLifecycleTracer::DumpTrace(std::vector<std::string> &info)
+{
+    uint64_t end = traceIndex_.load(std::memory_order_acquire);
+    uint64_t begin = (end > TRACE_CAPACITY) ? end - TRACE_CAPACITY : 0;
+    info.emplace_back("LifecycleTrace:");
+    info.emplace_back("  format #" + std::to_string(TRACE_FORMAT_VERSION) + "  record size #" +
+                      std::to_string(TRACE_RECORD_SIZE) + "  events #" + std::to_string(end) + "  dropped #" +
+                      std::to_string(begin));
+    info.emplace_back("  layout: little endian time_us u64, latency_us u32, record_id i32, bundle u16, "
+                      "transition u8, phase u8 (0 begin, 1 complete)");
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        info.emplace_back("  bundle #0 " + otherStats_->bundleName);
+        for (const auto &item : bundleStats_) {
+            info.emplace_back("  bundle #" + std::to_string(item.second->bundleId) + " " + item.first);
+        }
+    }
+    for (uint32_t i = 0; i < TRANSITION_COUNT; i++) {
+        info.emplace_back("  transition #" + std::to_string(i) + " " + TRANSITION_NAMES[i]);
+    }
+
+    for (uint64_t index = begin; index < end; index++) {
+        const TraceSlot &slot = trace_[index & TRACE_MASK];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != index * 2 + 2) {
+            // being written or already overwritten.
+            continue;
+        }
+        uint64_t time = slot.time.load(std::memory_order_relaxed);
+        uint64_t latencyAndRecord = slot.latencyAndRecord.load(std::memory_order_relaxed);
+        uint64_t bundleAndEvent = slot.bundleAndEvent.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        std::string record;
+        record.reserve(TRACE_RECORD_SIZE * 2);
+        AppendHex(record, time, sizeof(uint64_t));
+        AppendHex(record, latencyAndRecord >> WORD_HALF_BITS, sizeof(uint32_t));
+        AppendHex(record, latencyAndRecord & UINT32_MASK, sizeof(uint32_t));
+        AppendHex(record, (bundleAndEvent >> UINT16_BITS) & UINT16_MASK, sizeof(uint16_t));
+        AppendHex(record, (bundleAndEvent >> BITS_PER_BYTE) & UINT8_MASK, sizeof(uint8_t));
+        AppendHex(record, bundleAndEvent & UINT8_MASK, sizeof(uint8_t));
+        info.emplace_back(record);
+    }
+    HILOG_INFO("lifecycle trace dumped, events: %{public}llu", static_cast<unsigned long long>(end - begin));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
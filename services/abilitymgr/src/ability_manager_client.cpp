@@ -130,6 +130,17 @@ ErrCode AbilityManagerClient::StartAbility(const Want &want, const sptr<IRemoteO
     return abms->StartAbility(want, callerToken, requestCode);
 }
 
+ErrCode AbilityManagerClient::StartAbilities(
+    const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode)
+{
+    if (remoteObject_ == nullptr) {
+        HILOG_ERROR("%{private}s:ability service not connect", __func__);
+        return ABILITY_SERVICE_NOT_CONNECTED;
+    }
+    sptr<IAbilityManager> abms = iface_cast<IAbilityManager>(remoteObject_);
+    return abms->StartAbilities(wants, callerToken, requestCode);
+}
+
 ErrCode AbilityManagerClient::TerminateAbility(const sptr<IRemoteObject> &token, int resultCode, const Want *resultWant)
 {
     if (remoteObject_ == nullptr) {
@@ -276,6 +287,16 @@ ErrCode AbilityManagerClient::GetMissionSnapshot(const int32_t missionId, Missio
     return abms->GetMissionSnapshot(missionId, snapshot);
 }
 
+ErrCode AbilityManagerClient::UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+{
+    if (remoteObject_ == nullptr) {
+        HILOG_ERROR("%{private}s:ability service not connect", __func__);
+        return ABILITY_SERVICE_NOT_CONNECTED;
+    }
+    sptr<IAbilityManager> abms = iface_cast<IAbilityManager>(remoteObject_);
+    return abms->UpdateMissionSnapshot(missionId, snapshot);
+}
+
 ErrCode AbilityManagerClient::MoveMissionToTop(int32_t missionId)
 {
     if (remoteObject_ == nullptr) {
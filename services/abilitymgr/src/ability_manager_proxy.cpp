@@ -94,6 +94,48 @@ int AbilityManagerProxy::StartAbility(const Want &want, const sptr<IRemoteObject
     return reply.ReadInt32();
 }
 
+int AbilityManagerProxy::StartAbilities(
+    const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode)
+{
+    int error;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (wants.empty() || wants.size() > MAX_START_ABILITIES) {
+        HILOG_ERROR("%{public}s fail, invalid size of wants: %{public}zu", __func__, wants.size());
+        return ERR_INVALID_VALUE;
+    }
+    if (!WriteInterfaceToken(data)) {
+        return INNER_ERR;
+    }
+    if (!data.WriteInt32(static_cast<int32_t>(wants.size()))) {
+        HILOG_ERROR("%{public}s fail, size of wants write int32 error", __func__);
+        return INNER_ERR;
+    }
+    for (const auto &want : wants) {
+        if (!data.WriteParcelable(&want)) {
+            HILOG_ERROR("%{public}s fail, want write parcelable error", __func__);
+            return INNER_ERR;
+        }
+    }
+    if (!data.WriteParcelable(callerToken)) {
+        HILOG_ERROR("%{public}s fail, callerToken write parcelable error", __func__);
+        return INNER_ERR;
+    }
+    if (!data.WriteInt32(requestCode)) {
+        HILOG_ERROR("%{public}s fail, requestCode write int32 error", __func__);
+        return INNER_ERR;
+    }
+
+    error = Remote()->SendRequest(IAbilityManager::START_ABILITIES, data, reply, option);
+    if (error != NO_ERROR) {
+        HILOG_ERROR("start abilities fail, error: %d", error);
+        return error;
+    }
+    return reply.ReadInt32();
+}
+
 int AbilityManagerProxy::TerminateAbility(const sptr<IRemoteObject> &token, int resultCode, const Want *resultWant)
 {
     int error;
@@ -567,6 +609,52 @@ int AbilityManagerProxy::GetMissionSnapshot(const int32_t missionId, MissionSnap
         return ERR_UNKNOWN_OBJECT;
     }
     snapshot = *info;
+    int32_t result = reply.ReadInt32();
+    if (!snapshot.snapshot.ReadPixels(reply)) {
+        HILOG_ERROR("read mission snapshot pixels failed");
+        return ERR_UNKNOWN_OBJECT;
+    }
+    return result;
+}
+
+int AbilityManagerProxy::UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+{
+    int error;
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (snapshot.data == nullptr && snapshot.pixels == nullptr) {
+        HILOG_ERROR("update mission snapshot fail, the snapshot has no pixels.");
+        return ERR_INVALID_VALUE;
+    }
+    ImageInfo image = snapshot;
+    if (image.pixels == nullptr) {
+        // the pixels are copied once into shared memory, they are not sent in the parcel.
+        image.pixels = Ashmem::CreateAshmem("mission_snapshot_update", static_cast<int32_t>(image.dataSize));
+        if (image.pixels == nullptr || !image.pixels->MapReadAndWriteAshmem() ||
+            !image.pixels->WriteToAshmem(image.data, static_cast<int32_t>(image.dataSize), 0)) {
+            HILOG_ERROR("update mission snapshot fail, write pixels to shared memory fail.");
+            return ERR_NO_MEMORY;
+        }
+        image.pixels->UnmapAshmem();
+    }
+    if (!WriteInterfaceToken(data)) {
+        return INNER_ERR;
+    }
+    if (!data.WriteInt32(missionId)) {
+        HILOG_ERROR("update mission snapshot, WriteInt32 fail.");
+        return ERR_INVALID_VALUE;
+    }
+    if (!data.WriteParcelable(&image) || !image.WritePixels(data)) {
+        HILOG_ERROR("update mission snapshot, write snapshot fail.");
+        return ERR_INVALID_VALUE;
+    }
+    error = Remote()->SendRequest(IAbilityManager::UPDATE_MISSION_SNAPSHOT, data, reply, option);
+    if (error != NO_ERROR) {
+        HILOG_ERROR("update mission snapshot fail, error: %{public}d", error);
+        return error;
+    }
     return reply.ReadInt32();
 }
 
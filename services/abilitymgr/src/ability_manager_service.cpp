@@ -18,12 +18,17 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <unistd.h>
 #include "string_ex.h"
 
 #include "ability_util.h"
 #include "ability_info.h"
+#include "ability_info_store.h"
 #include "ability_manager_errors.h"
+#include "ability_token_registry.h"
+#include "common_event_manager.h"
+#include "common_event_support.h"
 #include "hilog_wrapper.h"
 #include "if_system_ability_manager.h"
 #include "ipc_skeleton.h"
@@ -55,6 +60,16 @@ const std::map<std::string, AbilityManagerService::DumpKey> AbilityManagerServic
     std::map<std::string, AbilityManagerService::DumpKey>::value_type("-d", KEY_DUMP_DATA),
     std::map<std::string, AbilityManagerService::DumpKey>::value_type("--ui", KEY_DUMP_SYSTEM_UI),
     std::map<std::string, AbilityManagerService::DumpKey>::value_type("-u", KEY_DUMP_SYSTEM_UI),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("--resolve-cache", KEY_DUMP_RESOLVE_CACHE),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("-r", KEY_DUMP_RESOLVE_CACHE),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("--timeout", KEY_DUMP_TIMEOUT),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("-o", KEY_DUMP_TIMEOUT),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("--lifecycle", KEY_DUMP_LIFECYCLE),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("-c", KEY_DUMP_LIFECYCLE),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("--snapshot", KEY_DUMP_SNAPSHOT),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("-p", KEY_DUMP_SNAPSHOT),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("--info-store", KEY_DUMP_INFO_STORE),
+    std::map<std::string, AbilityManagerService::DumpKey>::value_type("-i", KEY_DUMP_INFO_STORE),
 };
 const bool REGISTER_RESULT =
     SystemAbility::MakeAndRegisterAbility(DelayedSingleton<AbilityManagerService>::GetInstance().get());
@@ -63,9 +78,13 @@ AbilityManagerService::AbilityManagerService()
     : SystemAbility(ABILITY_MGR_SERVICE_ID, true),
       eventLoop_(nullptr),
       handler_(nullptr),
+      timeoutScheduler_(nullptr),
       state_(ServiceRunningState::STATE_NOT_START),
       connectManager_(std::make_shared<AbilityConnectManager>()),
-      iBundleManager_(nullptr)
+      iBundleManager_(nullptr),
+      resolveCache_(std::make_shared<AbilityResolveCache>()),
+      lifecycleTracer_(std::make_shared<AbilityLifecycleTracer>()),
+      snapshotCache_(std::make_shared<MissionSnapshotCache>())
 {
     std::shared_ptr<AppScheduler> appScheduler(
         DelayedSingleton<AppScheduler>::GetInstance().get(), [](AppScheduler *x) { x->DecStrongRef(x); });
@@ -102,11 +121,20 @@ void AbilityManagerService::OnStart()
 
 bool AbilityManagerService::Init()
 {
+    // subscribe before any task is posted, no bundle change may be missed by the caches once they are used.
+    SubscribeBundleEvent();
     eventLoop_ = AppExecFwk::EventRunner::Create(AbilityConfig::NAME_ABILITY_MGR_SERVICE);
     CHECK_POINTER_RETURN_BOOL(eventLoop_);
 
     handler_ = std::make_shared<AbilityEventHandler>(eventLoop_, weak_from_this());
     CHECK_POINTER_RETURN_BOOL(handler_);
+    std::weak_ptr<AbilityManagerService> weak = weak_from_this();
+    auto timeoutCallback = [weak](uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord) {
+        auto server = weak.lock();
+        CHECK_POINTER(server);
+        server->HandleTimeOut(msgId, abilityRecord);
+    };
+    timeoutScheduler_ = std::make_shared<AbilityTimeoutScheduler>(handler_, timeoutCallback);
     CHECK_POINTER_RETURN_BOOL(connectManager_);
     connectManager_->SetEventHandler(handler_);
 
@@ -118,6 +146,7 @@ bool AbilityManagerService::Init()
         HILOG_ERROR("Failed to init pending want ability manager.");
         return false;
     }
+    pendingWantManager->LoadJournal(AbilityConfig::PENDING_WANT_JOURNAL_PATH);
 
     int userId = GetUserId();
     SetStackManager(userId);
@@ -141,9 +170,36 @@ void AbilityManagerService::OnStop()
     HILOG_INFO("stop service");
     eventLoop_.reset();
     handler_.reset();
+    timeoutScheduler_.reset();
+    if (bundleEventSubscriber_ != nullptr) {
+        EventFwk::CommonEventManager::UnSubscribeCommonEvent(bundleEventSubscriber_);
+        bundleEventSubscriber_.reset();
+    }
+    resolveCache_->Clear();
     state_ = ServiceRunningState::STATE_NOT_START;
 }
 
+void AbilityManagerService::SubscribeBundleEvent()
+{
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    bundleEventSubscriber_ = std::make_shared<BundleEventSubscriber>(subscribeInfo, resolveCache_);
+    if (!EventFwk::CommonEventManager::SubscribeCommonEvent(bundleEventSubscriber_)) {
+        // neither the resolve cache nor the info store can know the changes of bundles, do not use them.
+        HILOG_ERROR("failed to subscribe bundle event, disable resolve cache and info store.");
+        bundleEventSubscriber_.reset();
+        resolveCache_->SetEnabled(false);
+        DelayedSingleton<AbilityInfoStore>::GetInstance()->SetEnabled(false);
+        return;
+    }
+    // the results of an earlier run were dropped when the service stopped, both may be used again.
+    resolveCache_->SetEnabled(true);
+    DelayedSingleton<AbilityInfoStore>::GetInstance()->SetEnabled(true);
+}
+
 ServiceRunningState AbilityManagerService::QueryServiceState() const
 {
     return state_;
@@ -197,6 +253,79 @@ int AbilityManagerService::StartAbility(const Want &want, const sptr<IRemoteObje
     return currentStackManager_->StartAbility(abilityRequest);
 }
 
+int AbilityManagerService::StartAbilities(
+    const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode)
+{
+    HILOG_INFO("%{public}s, size: %{public}zu", __func__, wants.size());
+
+    if (wants.empty() || wants.size() > MAX_START_ABILITIES) {
+        HILOG_ERROR("%{public}s, invalid size of wants.", __func__);
+        return ERR_INVALID_VALUE;
+    }
+    if (callerToken != nullptr && !VerificationToken(callerToken)) {
+        return ERR_INVALID_VALUE;
+    }
+
+    std::vector<AbilityRequest> abilityRequests(wants.size());
+    std::vector<AbilityRequest> pageRequests;
+    std::unordered_set<std::string> bundleNames;
+    for (size_t i = 0; i < wants.size(); i++) {
+        int result = GenerateAbilityRequest(wants[i], requestCode, abilityRequests[i], callerToken);
+        if (result != ERR_OK) {
+            HILOG_ERROR("%{public}s generate ability request error.", __func__);
+            return result;
+        }
+        const auto &abilityInfo = abilityRequests[i].abilityInfo;
+        if (abilityInfo.type == AppExecFwk::AbilityType::DATA) {
+            HILOG_ERROR("Cannot start data ability, use 'AcquireDataAbility()' instead.");
+            return ERR_INVALID_VALUE;
+        }
+        if (!AbilitUtil::IsSystemDialogAbility(abilityInfo.bundleName, abilityInfo.name)) {
+            bundleNames.insert(abilityInfo.bundleName);
+        }
+        if (abilityInfo.type != AppExecFwk::AbilityType::SERVICE && !IsSystemUiApp(abilityInfo)) {
+            pageRequests.emplace_back(abilityRequests[i]);
+        }
+    }
+    // the pages are checked before anything is started, a page refused by the stacks starts nothing.
+    if (!pageRequests.empty()) {
+        CHECK_POINTER_AND_RETURN(currentStackManager_, ERR_INVALID_VALUE);
+        int result = currentStackManager_->CheckStartAbilities(pageRequests);
+        if (result != ERR_OK) {
+            HILOG_ERROR("%{public}s, the abilities can not be started now: %{public}d", __func__, result);
+            return result;
+        }
+    }
+    for (const auto &bundleName : bundleNames) {
+        int result = PreLoadAppDataAbilities(bundleName);
+        if (result != ERR_OK) {
+            HILOG_ERROR("StartAbilities: App data ability preloading failed, '%{public}s', %{public}d",
+                bundleName.c_str(),
+                result);
+            return result;
+        }
+    }
+
+    // the service and system ui abilities are started in the order of wants, then the pages are put into the
+    // stacks together. a start failing from here on leaves the abilities started before it running.
+    for (const auto &abilityRequest : abilityRequests) {
+        int result = ERR_OK;
+        if (abilityRequest.abilityInfo.type == AppExecFwk::AbilityType::SERVICE) {
+            result = connectManager_->StartAbility(abilityRequest);
+        } else if (IsSystemUiApp(abilityRequest.abilityInfo)) {
+            result = systemAppManager_->StartAbility(abilityRequest);
+        }
+        if (result != ERR_OK && result != START_ABILITY_WAITING) {
+            HILOG_ERROR("%{public}s, start ability error: %{public}d", __func__, result);
+            return result;
+        }
+    }
+    if (pageRequests.empty()) {
+        return ERR_OK;
+    }
+    return currentStackManager_->StartAbilities(pageRequests);
+}
+
 int AbilityManagerService::TerminateAbility(const sptr<IRemoteObject> &token, int resultCode, const Want *resultWant)
 {
     HILOG_INFO("%{public}s. for result: %{public}d", __func__, (resultWant != nullptr));
@@ -231,7 +360,11 @@ int AbilityManagerService::TerminateAbility(const sptr<IRemoteObject> &token, in
         RequestPermission(resultWant);
     }
 
-    return currentStackManager_->TerminateAbility(token, resultCode, resultWant);
+    int result = currentStackManager_->TerminateAbility(token, resultCode, resultWant);
+    if (result == ERR_OK) {
+        RemoveStaleSnapshots();
+    }
+    return result;
 }
 
 void AbilityManagerService::RequestPermission(const Want *resultWant)
@@ -293,7 +426,51 @@ int AbilityManagerService::GetRecentMissions(
 
 int AbilityManagerService::GetMissionSnapshot(const int32_t missionId, MissionSnapshotInfo &snapshot)
 {
-    return 0;
+    HILOG_DEBUG("%{public}s, missionId: %{public}d", __func__, missionId);
+    CHECK_POINTER_AND_RETURN(snapshotCache_, ERR_INVALID_VALUE);
+    if (!snapshotCache_->Get(missionId, snapshot.snapshot)) {
+        // a mission without a snapshot is not an error, its snapshot is left empty.
+        HILOG_DEBUG("mission %{public}d has no snapshot", missionId);
+    }
+    return ERR_OK;
+}
+
+int AbilityManagerService::UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+{
+    HILOG_DEBUG("%{public}s, missionId: %{public}d", __func__, missionId);
+    CHECK_POINTER_AND_RETURN(snapshotCache_, ERR_INVALID_VALUE);
+    CHECK_POINTER_AND_RETURN(currentStackManager_, ERR_INVALID_VALUE);
+    if (!currentStackManager_->IsExistMission(missionId)) {
+        HILOG_ERROR("mission %{public}d does not exist", missionId);
+        return ERR_INVALID_VALUE;
+    }
+    // only a system app or an app with an ability in the mission may replace its snapshot.
+    auto bms = GetBundleManager();
+    CHECK_POINTER_AND_RETURN(bms, ERR_NO_INIT);
+    int callerUid = IPCSkeleton::GetCallingUid();
+    if (!bms->CheckIsSystemAppByUid(callerUid)) {
+        std::string bundleName;
+        if (!bms->GetBundleNameForUid(callerUid, bundleName) ||
+            !currentStackManager_->IsExistBundleInMission(missionId, bundleName)) {
+            HILOG_ERROR("uid %{public}d does not own mission %{public}d", callerUid, missionId);
+            return CHECK_PERMISSION_FAILED;
+        }
+    }
+    return snapshotCache_->Put(missionId, snapshot);
+}
+
+void AbilityManagerService::RemoveStaleSnapshots()
+{
+    CHECK_POINTER(handler_);
+    // run after the stack changes already posted, such as the removal of the missions of an uninstalled app.
+    auto task = [snapshotCache = snapshotCache_, stackManager = currentStackManager_]() {
+        CHECK_POINTER(snapshotCache);
+        CHECK_POINTER(stackManager);
+        snapshotCache->RemoveIf([&stackManager](int32_t missionId) {
+            return !stackManager->IsExistMission(missionId);
+        });
+    };
+    handler_->PostTask(task, "RemoveStaleSnapshots");
 }
 
 int AbilityManagerService::SetMissionDescriptionInfo(
@@ -344,7 +521,11 @@ int AbilityManagerService::RemoveMission(int id)
         HILOG_ERROR("remove mission, id is invalid");
         return ERR_INVALID_VALUE;
     }
-    return currentStackManager_->RemoveMissionById(id);
+    int result = currentStackManager_->RemoveMissionById(id);
+    if (result == ERR_OK) {
+        snapshotCache_->Remove(id);
+    }
+    return result;
 }
 
 int AbilityManagerService::RemoveStack(int id)
@@ -354,7 +535,11 @@ int AbilityManagerService::RemoveStack(int id)
         HILOG_ERROR("remove stack, id is invalid");
         return ERR_INVALID_VALUE;
     }
-    return currentStackManager_->RemoveStack(id);
+    int result = currentStackManager_->RemoveStack(id);
+    if (result == ERR_OK) {
+        RemoveStaleSnapshots();
+    }
+    return result;
 }
 
 int AbilityManagerService::ConnectAbility(
@@ -414,8 +599,7 @@ sptr<IWantSender> AbilityManagerService::GetWantSender(
     }
     int32_t callerUid = IPCSkeleton::GetCallingUid();
     AppExecFwk::BundleInfo bundleInfo;
-    bool bundleMgrResult =
-        bms->GetBundleInfo(wantSenderInfo.bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_DEFAULT, bundleInfo);
+    bool bundleMgrResult = resolveCache_->GetBundleInfo(bms, wantSenderInfo.bundleName, bundleInfo);
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleInfo is fail");
         return nullptr;
@@ -462,8 +646,7 @@ void AbilityManagerService::CancelWantSender(const sptr<IWantSender> &sender)
     sptr<PendingWantRecord> record = iface_cast<PendingWantRecord>(sender->AsObject());
 
     AppExecFwk::BundleInfo bundleInfo;
-    bool bundleMgrResult =
-        bms->GetBundleInfo(record->GetKey()->GetBundleName(), AppExecFwk::BundleFlag::GET_BUNDLE_DEFAULT, bundleInfo);
+    bool bundleMgrResult = resolveCache_->GetBundleInfo(bms, record->GetKey()->GetBundleName(), bundleInfo);
     if (!bundleMgrResult) {
         HILOG_ERROR("GetBundleInfo is fail");
         return;
@@ -641,7 +824,7 @@ sptr<IAbilityScheduler> AbilityManagerService::AcquireDataAbility(
 
     AbilityRequest abilityRequest;
     std::string dataAbilityUri = AbilityConfig::SCHEME_DATA_ABILITY + "://" + pathSegments[0];
-    bool queryResult = iBundleManager_->QueryAbilityInfoByUri(dataAbilityUri, abilityRequest.abilityInfo);
+    bool queryResult = resolveCache_->QueryAbilityInfoByUri(bms, dataAbilityUri, abilityRequest.abilityInfo);
     if (!queryResult || abilityRequest.abilityInfo.name.empty() || abilityRequest.abilityInfo.bundleName.empty()) {
         HILOG_ERROR("Invalid ability info for data ability acquiring.");
         return nullptr;
@@ -712,6 +895,11 @@ void AbilityManagerService::DumpFuncInit()
     dumpFuncMap_[KEY_DUMP_SERVICE] = &AbilityManagerService::DumpStateInner;
     dumpFuncMap_[KEY_DUMP_DATA] = &AbilityManagerService::DataDumpStateInner;
     dumpFuncMap_[KEY_DUMP_SYSTEM_UI] = &AbilityManagerService::SystemDumpStateInner;
+    dumpFuncMap_[KEY_DUMP_RESOLVE_CACHE] = &AbilityManagerService::DumpResolveCacheInner;
+    dumpFuncMap_[KEY_DUMP_TIMEOUT] = &AbilityManagerService::DumpTimeoutInner;
+    dumpFuncMap_[KEY_DUMP_LIFECYCLE] = &AbilityManagerService::DumpLifecycleInner;
+    dumpFuncMap_[KEY_DUMP_SNAPSHOT] = &AbilityManagerService::DumpSnapshotInner;
+    dumpFuncMap_[KEY_DUMP_INFO_STORE] = &AbilityManagerService::DumpInfoStoreInner;
 }
 
 void AbilityManagerService::DumpInner(const std::string &args, std::vector<std::string> &info)
@@ -805,6 +993,42 @@ void AbilityManagerService::SystemDumpStateInner(const std::string &args, std::v
     systemAppManager_->DumpState(info);
 }
 
+void AbilityManagerService::DumpResolveCacheInner(const std::string &args, std::vector<std::string> &info)
+{
+    resolveCache_->Dump(info);
+}
+
+void AbilityManagerService::DumpTimeoutInner(const std::string &args, std::vector<std::string> &info)
+{
+    CHECK_POINTER(timeoutScheduler_);
+    timeoutScheduler_->Dump(info);
+}
+
+void AbilityManagerService::DumpLifecycleInner(const std::string &args, std::vector<std::string> &info)
+{
+    CHECK_POINTER(lifecycleTracer_);
+    std::vector<std::string> argList;
+    SplitStr(args, " ", argList);
+    if (argList.size() < MIN_DUMP_ARGUMENT_NUM) {
+        lifecycleTracer_->Dump(info);
+    } else if (argList.size() == MIN_DUMP_ARGUMENT_NUM && argList[1] == "trace") {
+        lifecycleTracer_->DumpTrace(info);
+    } else {
+        info.emplace_back("error: invalid argument, please see 'ability dump -h'.");
+    }
+}
+
+void AbilityManagerService::DumpSnapshotInner(const std::string &args, std::vector<std::string> &info)
+{
+    CHECK_POINTER(snapshotCache_);
+    snapshotCache_->Dump(info);
+}
+
+void AbilityManagerService::DumpInfoStoreInner(const std::string &args, std::vector<std::string> &info)
+{
+    DelayedSingleton<AbilityInfoStore>::GetInstance()->Dump(info);
+}
+
 void AbilityManagerService::DumpState(const std::string &args, std::vector<std::string> &info)
 {
     std::vector<std::string> argList;
@@ -957,6 +1181,16 @@ std::shared_ptr<AbilityEventHandler> AbilityManagerService::GetEventHandler()
     return handler_;
 }
 
+std::shared_ptr<AbilityTimeoutScheduler> AbilityManagerService::GetTimeoutScheduler()
+{
+    return timeoutScheduler_;
+}
+
+std::shared_ptr<AbilityLifecycleTracer> AbilityManagerService::GetLifecycleTracer()
+{
+    return lifecycleTracer_;
+}
+
 void AbilityManagerService::SetStackManager(int userId)
 {
     auto iterator = stackManagers_.find(userId);
@@ -1062,7 +1296,7 @@ int AbilityManagerService::GenerateAbilityRequest(
     auto bms = GetBundleManager();
     CHECK_POINTER_AND_RETURN(bms, GET_ABILITY_SERVICE_FAILED);
 
-    bms->QueryAbilityInfo(want, request.abilityInfo);
+    resolveCache_->QueryAbilityInfo(bms, want, request.abilityInfo);
     if (request.abilityInfo.name.empty() || request.abilityInfo.bundleName.empty()) {
         HILOG_ERROR("failed to get ability info");
         return RESOLVE_ABILITY_ERR;
@@ -1134,6 +1368,7 @@ void AbilityManagerService::OnAbilityDied(std::shared_ptr<AbilityRecord> ability
 
     if (currentStackManager_) {
         currentStackManager_->OnAbilityDied(abilityRecord);
+        RemoveStaleSnapshots();
     }
 
     if (connectManager_) {
@@ -1159,7 +1394,12 @@ int AbilityManagerService::UninstallApp(const std::string &bundleName)
 {
     HILOG_DEBUG("%{public}s, bundleName: %{public}s %{public}d", __func__, bundleName.c_str(), __LINE__);
     CHECK_POINTER_AND_RETURN(currentStackManager_, ERR_NO_INIT);
+    resolveCache_->Invalidate(bundleName);
     currentStackManager_->UninstallApp(bundleName);
+    if (pendingWantManager_ != nullptr) {
+        pendingWantManager_->ClearPendingWantRecord(bundleName);
+    }
+    RemoveStaleSnapshots();
     int ret = DelayedSingleton<AppScheduler>::GetInstance()->KillApplication(bundleName);
     if (ret != ERR_OK) {
         return UNINSTALL_APP_FAILED;
@@ -1241,60 +1481,26 @@ bool AbilityManagerService::IsSystemUiApp(const AppExecFwk::AbilityInfo &info) c
     return (info.name == AbilityConfig::SYSTEM_UI_NAVIGATION_BAR || info.name == AbilityConfig::SYSTEM_UI_STATUS_BAR);
 }
 
-void AbilityManagerService::HandleLoadTimeOut(int64_t eventId)
+void AbilityManagerService::HandleTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    HILOG_DEBUG("%{public}s", __func__);
-    if (systemAppManager_) {
-        systemAppManager_->OnTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, eventId);
-    }
-    if (currentStackManager_) {
-        currentStackManager_->OnTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, eventId);
-    }
-}
-
-void AbilityManagerService::HandleActiveTimeOut(int64_t eventId)
-{
-    HILOG_DEBUG("%{public}s", __func__);
-    if (systemAppManager_) {
-        systemAppManager_->OnTimeOut(AbilityManagerService::ACTIVE_TIMEOUT_MSG, eventId);
-    }
-    if (currentStackManager_) {
-        currentStackManager_->OnTimeOut(AbilityManagerService::ACTIVE_TIMEOUT_MSG, eventId);
+    HILOG_DEBUG("%{public}s, msg: %{public}u", __func__, msgId);
+    CHECK_POINTER(abilityRecord);
+    if (abilityRecord->IsKernalSystemAbility()) {
+        if (systemAppManager_) {
+            systemAppManager_->OnTimeOut(msgId, abilityRecord);
+        }
+        return;
     }
-}
-
-void AbilityManagerService::HandleInactiveTimeOut(int64_t eventId)
-{
-    HILOG_DEBUG("%{public}s", __func__);
     if (currentStackManager_) {
-        currentStackManager_->OnTimeOut(AbilityManagerService::INACTIVE_TIMEOUT_MSG, eventId);
+        currentStackManager_->OnTimeOut(msgId, abilityRecord);
     }
 }
 
 bool AbilityManagerService::VerificationToken(const sptr<IRemoteObject> &token)
 {
     HILOG_INFO("%{public}s, called.", __func__);
-    CHECK_POINTER_RETURN_BOOL(currentStackManager_);
-    CHECK_POINTER_RETURN_BOOL(dataAbilityManager_);
-    CHECK_POINTER_RETURN_BOOL(connectManager_);
-
-    if (currentStackManager_->GetAbilityRecordByToken(token)) {
-        return true;
-    }
-
-    if (currentStackManager_->GetAbilityFromTerminateList(token)) {
-        return true;
-    }
-
-    if (dataAbilityManager_->GetAbilityRecordByToken(token)) {
-        return true;
-    }
-
-    if (connectManager_->GetServiceRecordByToken(token)) {
-        return true;
-    }
-
-    if (systemAppManager_->GetAbilityRecordByToken(token)) {
+    // the managers revoke the tokens of the records they drop, so the registry answers without their locks.
+    if (DelayedSingleton<AbilityTokenRegistry>::GetInstance()->IsAlive(token)) {
         return true;
     }
 
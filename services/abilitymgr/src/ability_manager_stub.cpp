@@ -74,6 +74,8 @@ AbilityManagerStub::AbilityManagerStub()
     requestFuncMap_[GET_PENDING_REQUEST_WANT] = &AbilityManagerStub::GetPendingRequestWantInner;
     requestFuncMap_[SET_MISSION_INFO] = &AbilityManagerStub::SetMissionDescriptionInfoInner;
     requestFuncMap_[GET_MISSION_LOCK_MODE_STATE] = &AbilityManagerStub::GetMissionLockModeStateInner;
+    requestFuncMap_[START_ABILITIES] = &AbilityManagerStub::StartAbilitiesInner;
+    requestFuncMap_[UPDATE_MISSION_SNAPSHOT] = &AbilityManagerStub::UpdateMissionSnapshotInner;
 }
 
 AbilityManagerStub::~AbilityManagerStub()
@@ -253,6 +255,30 @@ int AbilityManagerStub::GetMissionSnapshotInner(MessageParcel &data, MessageParc
         HILOG_ERROR("AbilityManagerStub: GetMissionSnapshot result error");
         return ERR_INVALID_VALUE;
     }
+    if (!snapshot.snapshot.WritePixels(reply)) {
+        HILOG_ERROR("AbilityManagerStub: GetMissionSnapshot pixels error");
+        return ERR_INVALID_VALUE;
+    }
+    return NO_ERROR;
+}
+
+int AbilityManagerStub::UpdateMissionSnapshotInner(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t missionId = data.ReadInt32();
+    std::unique_ptr<ImageInfo> snapshot(data.ReadParcelable<ImageInfo>());
+    if (snapshot == nullptr) {
+        HILOG_ERROR("AbilityManagerStub: snapshot is nullptr");
+        return ERR_INVALID_VALUE;
+    }
+    if (!snapshot->ReadPixels(data) || snapshot->data == nullptr) {
+        HILOG_ERROR("AbilityManagerStub: UpdateMissionSnapshot pixels error");
+        return ERR_INVALID_VALUE;
+    }
+    int32_t result = UpdateMissionSnapshot(missionId, *snapshot);
+    if (!reply.WriteInt32(result)) {
+        HILOG_ERROR("AbilityManagerStub: UpdateMissionSnapshot result error");
+        return ERR_INVALID_VALUE;
+    }
     return NO_ERROR;
 }
 
@@ -355,6 +381,30 @@ int AbilityManagerStub::StartAbilityAddCallerInner(MessageParcel &data, MessageP
     return NO_ERROR;
 }
 
+int AbilityManagerStub::StartAbilitiesInner(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t size = data.ReadInt32();
+    if (size <= 0 || static_cast<size_t>(size) > MAX_START_ABILITIES) {
+        HILOG_ERROR("AbilityManagerStub: invalid size of wants: %{public}d", size);
+        return ERR_INVALID_VALUE;
+    }
+    std::vector<Want> wants;
+    wants.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        std::unique_ptr<Want> want(data.ReadParcelable<Want>());
+        if (want == nullptr) {
+            HILOG_ERROR("AbilityManagerStub: want is nullptr");
+            return ERR_INVALID_VALUE;
+        }
+        wants.emplace_back(std::move(*want));
+    }
+    auto callerToken = data.ReadParcelable<IRemoteObject>();
+    int requestCode = data.ReadInt32();
+    int32_t result = StartAbilities(wants, callerToken, requestCode);
+    reply.WriteInt32(result);
+    return NO_ERROR;
+}
+
 int AbilityManagerStub::ConnectAbilityInner(MessageParcel &data, MessageParcel &reply)
 {
     Want *want = data.ReadParcelable<Want>();
@@ -22,13 +22,14 @@
 #include "hilog_wrapper.h"
 #include "ability_util.h"
 #include "ability_event_handler.h"
+#include "ability_info_store.h"
 #include "ability_manager_service.h"
 #include "ability_scheduler_stub.h"
+#include "ability_token_registry.h"
 
 namespace OHOS {
 namespace AAFwk {
 int64_t AbilityRecord::abilityRecordId = 0;
-int64_t AbilityRecord::g_abilityRecordEventId_ = 0;
 const std::map<AbilityState, std::string> AbilityRecord::stateToStrMap = {
     std::map<AbilityState, std::string>::value_type(INITIAL, "INITIAL"),
     std::map<AbilityState, std::string>::value_type(INACTIVE, "INACTIVE"),
@@ -67,14 +68,20 @@ std::shared_ptr<AbilityRecord> Token::GetAbilityRecord() const
 
 AbilityRecord::AbilityRecord(const Want &want, const AppExecFwk::AbilityInfo &abilityInfo,
     const AppExecFwk::ApplicationInfo &applicationInfo, int requestCode)
-    : want_(want), abilityInfo_(abilityInfo), applicationInfo_(applicationInfo), requestCode_(requestCode)
+    : want_(want), requestCode_(requestCode)
 {
+    auto store = DelayedSingleton<AbilityInfoStore>::GetInstance();
+    abilityInfo_ = store->Intern(abilityInfo);
+    applicationInfo_ = store->Intern(applicationInfo);
     recordId_ = abilityRecordId++;
     currentState_ = AbilityState::INITIAL;
 }
 
 AbilityRecord::~AbilityRecord()
 {
+    if (token_ != nullptr) {
+        DelayedSingleton<AbilityTokenRegistry>::GetInstance()->Unregister(token_->AsObject());
+    }
     if (scheduler_ != nullptr && schedulerDeathRecipient_ != nullptr) {
         auto object = scheduler_->AsObject();
         if (object != nullptr) {
@@ -103,7 +110,15 @@ bool AbilityRecord::Init()
     token_ = new (std::nothrow) Token(weak_from_this());
     CHECK_POINTER_RETURN_BOOL(token_);
 
-    if (applicationInfo_.isLauncherApp) {
+    auto owner = AbilityTokenRegistry::OWNER_STACK_MANAGER;
+    if (abilityInfo_->type == AppExecFwk::AbilityType::SERVICE) {
+        owner = AbilityTokenRegistry::OWNER_CONNECT_MANAGER;
+    } else if (abilityInfo_->type == AppExecFwk::AbilityType::DATA) {
+        owner = AbilityTokenRegistry::OWNER_DATA_ABILITY_MANAGER;
+    }
+    DelayedSingleton<AbilityTokenRegistry>::GetInstance()->Register(token_->AsObject(), owner);
+
+    if (applicationInfo_->isLauncherApp) {
         isLauncherAbility_ = true;
     }
     return true;
@@ -113,18 +128,19 @@ int AbilityRecord::LoadAbility()
 {
     HILOG_INFO("%s", __func__);
     startTime_ = SystemTimeMillis();
+    BeginTransition(TRANSITION_LOAD);
     CHECK_POINTER_AND_RETURN(token_, ERR_INVALID_VALUE);
-    std::string appName = applicationInfo_.name;
+    std::string appName = applicationInfo_->name;
     if (appName.empty()) {
         HILOG_ERROR("app name is empty");
         return ERR_INVALID_VALUE;
     }
 
-    if (abilityInfo_.type != AppExecFwk::AbilityType::DATA) {
+    if (abilityInfo_->type != AppExecFwk::AbilityType::DATA) {
         if (isKernalSystemAbility) {
-            SendEvent(AbilityManagerService::LOAD_TIMEOUT_MSG, AbilityManagerService::SYSTEM_UI_TIMEOUT);
+            ArmTimeout(AbilityManagerService::LOAD_TIMEOUT_MSG, AbilityManagerService::SYSTEM_UI_TIMEOUT);
         } else {
-            SendEvent(AbilityManagerService::LOAD_TIMEOUT_MSG, AbilityManagerService::LOAD_TIMEOUT);
+            ArmTimeout(AbilityManagerService::LOAD_TIMEOUT_MSG, AbilityManagerService::LOAD_TIMEOUT);
         }
     }
     sptr<Token> callerToken_ = nullptr;
@@ -132,7 +148,7 @@ int AbilityRecord::LoadAbility()
         callerToken_ = callerList_.back()->GetCaller()->GetToken();
     }
     return DelayedSingleton<AppScheduler>::GetInstance()->LoadAbility(
-        token_, callerToken_, abilityInfo_, applicationInfo_);
+        token_, callerToken_, *abilityInfo_, *applicationInfo_);
 }
 
 int AbilityRecord::TerminateAbility()
@@ -161,12 +177,12 @@ std::shared_ptr<MissionRecord> AbilityRecord::GetMissionRecord() const
 
 const AppExecFwk::AbilityInfo &AbilityRecord::GetAbilityInfo() const
 {
-    return abilityInfo_;
+    return *abilityInfo_;
 }
 
 const AppExecFwk::ApplicationInfo &AbilityRecord::GetApplicationInfo() const
 {
-    return applicationInfo_;
+    return *applicationInfo_;
 }
 
 AbilityState AbilityRecord::GetAbilityState() const
@@ -242,16 +258,6 @@ std::shared_ptr<AbilityRecord> AbilityRecord::GetBackAbilityRecord() const
     return backAbilityRecord_.lock();
 }
 
-void AbilityRecord::SetEventId(int64_t eventId)
-{
-    eventId_ = eventId;
-}
-
-int64_t AbilityRecord::GetEventId() const
-{
-    return eventId_;
-}
-
 bool AbilityRecord::IsReady() const
 {
     return isReady_;
@@ -311,7 +317,8 @@ void AbilityRecord::Activate()
     HILOG_INFO("%{public}s", __func__);
     CHECK_POINTER(lifecycleDeal_);
 
-    SendEvent(AbilityManagerService::ACTIVE_TIMEOUT_MSG, AbilityManagerService::ACTIVE_TIMEOUT);
+    BeginTransition(TRANSITION_ACTIVATE);
+    ArmTimeout(AbilityManagerService::ACTIVE_TIMEOUT_MSG, AbilityManagerService::ACTIVE_TIMEOUT);
 
     // schedule active after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
@@ -369,7 +376,8 @@ void AbilityRecord::Inactivate()
     HILOG_INFO("%{public}s", __func__);
     CHECK_POINTER(lifecycleDeal_);
 
-    SendEvent(AbilityManagerService::INACTIVE_TIMEOUT_MSG, AbilityManagerService::INACTIVE_TIMEOUT);
+    BeginTransition(TRANSITION_INACTIVATE);
+    ArmTimeout(AbilityManagerService::INACTIVE_TIMEOUT_MSG, AbilityManagerService::INACTIVE_TIMEOUT);
 
     // schedule inactive after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
@@ -381,19 +389,16 @@ void AbilityRecord::MoveToBackground(const Closure &task)
 {
     HILOG_INFO("%{public}s", __func__);
     CHECK_POINTER(lifecycleDeal_);
-    auto handler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
-    if (handler == nullptr || task == nullptr) {
-        // handler is nullptr means couldn't send timeout message. But still need to notify ability to inactive.
+    if (task == nullptr) {
+        // task is nullptr means couldn't arm the timeout. But still need to notify ability to inactive.
         // so don't return here.
-        HILOG_ERROR("handler is nullptr or task is nullptr.");
+        HILOG_ERROR("task is nullptr.");
     } else {
-        g_abilityRecordEventId_++;
-        eventId_ = g_abilityRecordEventId_;
-        // eventId_ is a unique id of the task.
-        handler->PostTask(task, std::to_string(eventId_), AbilityManagerService::BACKGROUND_TIMEOUT);
+        ArmTimeout(AbilityManagerService::BACKGROUND_TIMEOUT_MSG, AbilityManagerService::BACKGROUND_TIMEOUT, task);
     }
     // schedule background after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
+    BeginTransition(TRANSITION_BACKGROUND);
     currentState_ = AbilityState::MOVING_BACKGROUND;
     lifecycleDeal_->MoveToBackground(want_, lifeCycleStateInfo_);
 }
@@ -402,19 +407,16 @@ void AbilityRecord::Terminate(const Closure &task)
 {
     HILOG_INFO("terminate ability : %{public}s", __func__);
     CHECK_POINTER(lifecycleDeal_);
-    auto handler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
-    if (handler == nullptr || task == nullptr) {
-        // handler is nullptr means couldn't send timeout message. But still need to notify ability to inactive.
+    if (task == nullptr) {
+        // task is nullptr means couldn't arm the timeout. But still need to notify ability to inactive.
         // so don't return here.
-        HILOG_ERROR("handler is nullptr or task is nullptr.");
+        HILOG_ERROR("task is nullptr.");
     } else {
-        g_abilityRecordEventId_++;
-        eventId_ = g_abilityRecordEventId_;
-        // eventId_ is a unique id of the task.
-        handler->PostTask(task, std::to_string(eventId_), AbilityManagerService::TERMINATE_TIMEOUT);
+        ArmTimeout(AbilityManagerService::TERMINATE_TIMEOUT_MSG, AbilityManagerService::TERMINATE_TIMEOUT, task);
     }
     // schedule background after updating AbilityState and sending timeout message to avoid ability async callback
     // earlier than above actions.
+    BeginTransition(TRANSITION_TERMINATE);
     currentState_ = AbilityState::TERMINATING;
     lifecycleDeal_->Terminate(want_, lifeCycleStateInfo_);
 }
@@ -742,9 +744,9 @@ void AbilityRecord::GetAbilityRecordInfo(AbilityRecordInfo &recordInfo)
 {
     recordInfo.elementName = want_.GetElement().GetURI();
     recordInfo.id = recordId_;
-    recordInfo.appName = abilityInfo_.applicationName;
-    recordInfo.mainName = abilityInfo_.name;
-    recordInfo.abilityType = static_cast<int32_t>(abilityInfo_.type);
+    recordInfo.appName = abilityInfo_->applicationName;
+    recordInfo.mainName = abilityInfo_->name;
+    recordInfo.abilityType = static_cast<int32_t>(abilityInfo_->type);
 
     std::shared_ptr<AbilityRecord> preAbility = GetPreAbilityRecord();
     if (preAbility) {
@@ -795,7 +797,7 @@ void AbilityRecord::OnSchedulerDied(const wptr<IRemoteObject> &remote)
     auto handler = abilityManagerService->GetEventHandler();
     CHECK_POINTER(handler);
 
-    HILOG_INFO("Ability on scheduler died: '%{public}s'", abilityInfo_.name.c_str());
+    HILOG_INFO("Ability on scheduler died: '%{public}s'", abilityInfo_->name.c_str());
     auto task = [abilityManagerService, ability = shared_from_this()]() {
         abilityManagerService->OnAbilityDied(ability);
     };
@@ -834,6 +836,17 @@ bool AbilityRecord::IsUninstallAbility() const
 void AbilityRecord::SetKernalSystemAbility()
 {
     isKernalSystemAbility = true;
+    if (token_ != nullptr) {
+        DelayedSingleton<AbilityTokenRegistry>::GetInstance()->Register(
+            token_->AsObject(), AbilityTokenRegistry::OWNER_SYSTEM_APP_MANAGER);
+    }
+}
+
+void AbilityRecord::RevokeToken()
+{
+    if (token_ != nullptr) {
+        DelayedSingleton<AbilityTokenRegistry>::GetInstance()->Unregister(token_->AsObject());
+    }
 }
 
 bool AbilityRecord::IsKernalSystemAbility() const
@@ -855,14 +868,50 @@ bool AbilityRecord::IsAbilityState(const AbilityState &state) const
     return (currentState_ == state);
 }
 
-void AbilityRecord::SendEvent(uint32_t msg, uint32_t timeOut)
+void AbilityRecord::ArmTimeout(uint32_t msg, uint32_t timeOut, const Closure &task)
 {
-    auto handler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
-    CHECK_POINTER(handler);
+    auto timeoutScheduler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetTimeoutScheduler();
+    CHECK_POINTER(timeoutScheduler);
 
-    g_abilityRecordEventId_++;
-    eventId_ = g_abilityRecordEventId_;
-    handler->SendEvent(msg, eventId_, timeOut);
+    // only the latest lifecycle timeout of the ability is alive, the handle is swapped in one step since the
+    // timeout and transition paths run on different threads.
+    uint64_t handle = timeoutScheduler->Arm(shared_from_this(), msg, timeOut, task);
+    timeoutScheduler->Cancel(timeoutHandle_.exchange(handle));
+}
+
+void AbilityRecord::CancelTimeout()
+{
+    auto timeoutScheduler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetTimeoutScheduler();
+    CHECK_POINTER(timeoutScheduler);
+
+    timeoutScheduler->Cancel(timeoutHandle_.exchange(AbilityTimeoutScheduler::INVALID_HANDLE));
+}
+
+void AbilityRecord::BeginTransition(LifecycleTransition transition)
+{
+    auto tracer = DelayedSingleton<AbilityManagerService>::GetInstance()->GetLifecycleTracer();
+    CHECK_POINTER(tracer);
+    if (lifecycleStats_ == nullptr) {
+        lifecycleStats_ = tracer->GetBundleStats(abilityInfo_->bundleName);
+    }
+    transitionTime_[transition] = tracer->BeginTransition(lifecycleStats_, recordId_, transition);
+}
+
+void AbilityRecord::CompleteTransition(LifecycleTransition transition)
+{
+    auto tracer = DelayedSingleton<AbilityManagerService>::GetInstance()->GetLifecycleTracer();
+    CHECK_POINTER(tracer);
+    auto complete = [this, &tracer](LifecycleTransition pending) {
+        // nothing is pending if the transition was completed already, e.g. by its timeout.
+        if (transitionTime_[pending] != 0) {
+            tracer->CompleteTransition(lifecycleStats_, recordId_, pending, transitionTime_[pending]);
+            transitionTime_[pending] = 0;
+        }
+    };
+    complete(transition);
+    if (transition == TRANSITION_ACTIVATE) {
+        complete(TRANSITION_LOAD);
+    }
 }
 
 void AbilityRecord::SetPowerState(const bool isPower)
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_record_index.h"
+
+#include "hilog_wrapper.h"
+#include "ability_util.h"
+
+namespace OHOS {
+namespace AAFwk {
+void AbilityRecordIndex::Add(const std::shared_ptr<AbilityRecord> &ability, int missionId)
+{
+    CHECK_POINTER(ability);
+    auto token = ability->GetToken();
+    CHECK_POINTER(token);
+    IndexEntry entry = {ability, missionId};
+    tokenIndex_[token->AsObject().GetRefPtr()] = entry;
+    recordIdIndex_[ability->GetRecordId()] = entry;
+}
+
+void AbilityRecordIndex::Remove(const std::shared_ptr<AbilityRecord> &ability, int missionId)
+{
+    CHECK_POINTER(ability);
+    // the ability may have been moved to another mission, keep the entry of the new owner.
+    auto idIter = recordIdIndex_.find(ability->GetRecordId());
+    if (idIter == recordIdIndex_.end() || idIter->second.missionId != missionId) {
+        return;
+    }
+    recordIdIndex_.erase(idIter);
+
+    auto token = ability->GetToken();
+    CHECK_POINTER(token);
+    tokenIndex_.erase(token->AsObject().GetRefPtr());
+}
+
+std::shared_ptr<AbilityRecord> AbilityRecordIndex::GetAbilityRecordByToken(const sptr<IRemoteObject> &token) const
+{
+    CHECK_POINTER_AND_RETURN(token, nullptr);
+    auto iter = tokenIndex_.find(token.GetRefPtr());
+    if (iter == tokenIndex_.end()) {
+        return nullptr;
+    }
+    return iter->second.ability.lock();
+}
+
+std::shared_ptr<AbilityRecord> AbilityRecordIndex::GetAbilityRecordById(const int64_t recordId) const
+{
+    auto iter = recordIdIndex_.find(recordId);
+    if (iter == recordIdIndex_.end()) {
+        return nullptr;
+    }
+    return iter->second.ability.lock();
+}
+
+int AbilityRecordIndex::GetSize() const
+{
+    return recordIdIndex_.size();
+}
+
+void AbilityRecordIndex::Clear()
+{
+    tokenIndex_.clear();
+    recordIdIndex_.clear();
+}
+}  // namespace AAFwk
+}  // namespace OHOS
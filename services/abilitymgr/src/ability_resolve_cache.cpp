@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_resolve_cache.h"
+
+#include "ability_info_store.h"
+#include "ability_util.h"
+#include "common_event_data.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+// separates the fields of a cache key, it does not appear in names, actions, entities or uris.
+constexpr char KEY_SEPARATOR = '\x1f';
+}  // namespace
+
+AbilityResolveCache::AbilityResolveCache(size_t capacity) : capacity_(capacity)
+{}
+
+std::string AbilityResolveCache::MakeWantKey(const Want &want)
+{
+    std::string key = want.GetElement().GetDeviceID();
+    key += KEY_SEPARATOR;
+    key += want.GetBundle();
+    key += KEY_SEPARATOR;
+    key += want.GetElement().GetAbilityName();
+    key += KEY_SEPARATOR;
+    key += want.GetAction();
+    for (const auto &entity : want.GetEntities()) {
+        key += KEY_SEPARATOR;
+        key += entity;
+    }
+    key += KEY_SEPARATOR;
+    key += want.GetUriString();
+    key += KEY_SEPARATOR;
+    key += want.GetType();
+    return key;
+}
+
+template<typename Info>
+bool AbilityResolveCache::Lookup(CacheTable<Info> &table, const std::string &key, Info &info)
+{
+    auto iter = table.index.find(key);
+    if (!enabled_ || iter == table.index.end()) {
+        missCount_++;
+        return false;
+    }
+    hitCount_++;
+    table.entries.splice(table.entries.begin(), table.entries, iter->second);
+    info = iter->second->info;
+    return true;
+}
+
+template<typename Info>
+void AbilityResolveCache::Insert(CacheTable<Info> &table, CacheEntry<Info> &&entry)
+{
+    if (!enabled_) {
+        return;
+    }
+    auto iter = table.index.find(entry.key);
+    if (iter != table.index.end()) {
+        table.entries.erase(iter->second);
+        table.index.erase(iter);
+    }
+    table.entries.emplace_front(std::move(entry));
+    table.index[table.entries.front().key] = table.entries.begin();
+    while (table.entries.size() > capacity_) {
+        table.index.erase(table.entries.back().key);
+        table.entries.pop_back();
+        evictionCount_++;
+    }
+}
+
+template<typename Info>
+size_t AbilityResolveCache::Erase(CacheTable<Info> &table, const std::string &bundleName)
+{
+    size_t count = 0;
+    for (auto iter = table.entries.begin(); iter != table.entries.end();) {
+        if (bundleName.empty() || iter->implicit || iter->bundleName == bundleName) {
+            table.index.erase(iter->key);
+            iter = table.entries.erase(iter);
+            count++;
+        } else {
+            ++iter;
+        }
+    }
+    return count;
+}
+
+bool AbilityResolveCache::IsStaleLocked(const std::string &bundleName, bool implicit, uint64_t generation) const
+{
+    // every invalidation drops the implicit results.
+    if (implicit) {
+        return generation_ != generation;
+    }
+    if (allBundlesGeneration_ > generation) {
+        return true;
+    }
+    auto iter = bundleGenerations_.find(bundleName);
+    return iter != bundleGenerations_.end() && iter->second > generation;
+}
+
+bool AbilityResolveCache::QueryAbilityInfo(
+    const sptr<AppExecFwk::IBundleMgr> &bms, const Want &want, AppExecFwk::AbilityInfo &abilityInfo)
+{
+    CHECK_POINTER_AND_RETURN(bms, false);
+    std::string key = MakeWantKey(want);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (Lookup(abilities_, key, abilityInfo)) {
+            return true;
+        }
+        generation = generation_;
+    }
+
+    // query without holding the lock, bms may take a while.
+    bool result = bms->QueryAbilityInfo(want, abilityInfo);
+    if (!result || abilityInfo.name.empty() || abilityInfo.bundleName.empty()) {
+        return result;
+    }
+    CacheEntry<AppExecFwk::AbilityInfo> entry;
+    entry.key = std::move(key);
+    entry.bundleName = abilityInfo.bundleName;
+    entry.implicit = want.GetBundle().empty() || want.GetElement().GetAbilityName().empty();
+    entry.info = abilityInfo;
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!IsStaleLocked(entry.bundleName, entry.implicit, generation)) {
+        Insert(abilities_, std::move(entry));
+    }
+    return true;
+}
+
+bool AbilityResolveCache::QueryAbilityInfoByUri(
+    const sptr<AppExecFwk::IBundleMgr> &bms, const std::string &uri, AppExecFwk::AbilityInfo &abilityInfo)
+{
+    CHECK_POINTER_AND_RETURN(bms, false);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (Lookup(uriAbilities_, uri, abilityInfo)) {
+            return true;
+        }
+        generation = generation_;
+    }
+
+    bool result = bms->QueryAbilityInfoByUri(uri, abilityInfo);
+    if (!result || abilityInfo.name.empty() || abilityInfo.bundleName.empty()) {
+        return result;
+    }
+    CacheEntry<AppExecFwk::AbilityInfo> entry;
+    entry.key = uri;
+    entry.bundleName = abilityInfo.bundleName;
+    entry.info = abilityInfo;
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!IsStaleLocked(entry.bundleName, entry.implicit, generation)) {
+        Insert(uriAbilities_, std::move(entry));
+    }
+    return true;
+}
+
+bool AbilityResolveCache::GetBundleInfo(
+    const sptr<AppExecFwk::IBundleMgr> &bms, const std::string &bundleName, AppExecFwk::BundleInfo &bundleInfo)
+{
+    CHECK_POINTER_AND_RETURN(bms, false);
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (Lookup(bundles_, bundleName, bundleInfo)) {
+            return true;
+        }
+        generation = generation_;
+    }
+
+    if (!bms->GetBundleInfo(bundleName, AppExecFwk::BundleFlag::GET_BUNDLE_DEFAULT, bundleInfo)) {
+        return false;
+    }
+    CacheEntry<AppExecFwk::BundleInfo> entry;
+    entry.key = bundleName;
+    entry.bundleName = bundleName;
+    entry.info = bundleInfo;
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!IsStaleLocked(entry.bundleName, entry.implicit, generation)) {
+        Insert(bundles_, std::move(entry));
+    }
+    return true;
+}
+
+void AbilityResolveCache::Invalidate(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    invalidationCount_++;
+    // the queries running now must not cache what they got from the old bundle.
+    generation_++;
+    if (bundleName.empty()) {
+        allBundlesGeneration_ = generation_;
+        bundleGenerations_.clear();
+    } else {
+        bundleGenerations_[bundleName] = generation_;
+    }
+    size_t count = Erase(abilities_, bundleName) + Erase(uriAbilities_, bundleName) + Erase(bundles_, bundleName);
+    HILOG_INFO("resolve cache invalidated for bundle: %{public}s, %{public}zu entries dropped",
+        bundleName.c_str(), count);
+    // the records started from now on must not share the infos of the old bundle.
+    DelayedSingleton<AbilityInfoStore>::GetInstance()->Invalidate(bundleName);
+}
+
+void AbilityResolveCache::Clear()
+{
+    Invalidate("");
+}
+
+void AbilityResolveCache::SetEnabled(bool enabled)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        enabled_ = enabled;
+    }
+    HILOG_INFO("resolve cache %{public}s", enabled ? "enabled" : "disabled");
+    if (!enabled) {
+        Clear();
+    }
+}
+
+size_t AbilityResolveCache::SizeLocked() const
+{
+    return abilities_.entries.size() + uriAbilities_.entries.size() + bundles_.entries.size();
+}
+
+void AbilityResolveCache::Dump(std::vector<std::string> &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    info.emplace_back("ResolveCache:");
+    info.emplace_back("  size #" + std::to_string(SizeLocked()) + "  capacity #" + std::to_string(capacity_) +
+                      "  enabled #" + std::to_string(enabled_));
+    info.emplace_back("  hit #" + std::to_string(hitCount_) + "  miss #" + std::to_string(missCount_));
+    info.emplace_back("  invalidation #" + std::to_string(invalidationCount_) + "  eviction #" +
+                      std::to_string(evictionCount_));
+}
+
+uint64_t AbilityResolveCache::GetHitCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return hitCount_;
+}
+
+uint64_t AbilityResolveCache::GetMissCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return missCount_;
+}
+
+uint64_t AbilityResolveCache::GetInvalidationCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return invalidationCount_;
+}
+
+size_t AbilityResolveCache::GetSize()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return SizeLocked();
+}
+
+BundleEventSubscriber::BundleEventSubscriber(
+    const EventFwk::CommonEventSubscribeInfo &subscribeInfo, const std::shared_ptr<AbilityResolveCache> &cache)
+    : EventFwk::CommonEventSubscriber(subscribeInfo), cache_(cache)
+{}
+
+void BundleEventSubscriber::OnReceiveEvent(const EventFwk::CommonEventData &data)
+{
+    auto cache = cache_.lock();
+    CHECK_POINTER(cache);
+    Want want = data.GetWant();
+    HILOG_INFO("bundle event: %{public}s", want.GetAction().c_str());
+    cache->Invalidate(want.GetElement().GetBundleName());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
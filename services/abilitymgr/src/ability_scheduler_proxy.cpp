@@ -17,6 +17,7 @@
 #include "hilog_wrapper.h"
 #include "ipc_types.h"
 #include "pac_map.h"
+#include "shared_result_set.h"
 #include "want.h"
 
 namespace OHOS {
@@ -35,7 +36,7 @@ void AbilitySchedulerProxy::ScheduleAbilityTransaction(const Want &want, const L
 {
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
     if (!WriteInterfaceToken(data)) {
         return;
     }
@@ -51,7 +52,7 @@ void AbilitySchedulerProxy::SendResult(int requestCode, int resultCode, const Wa
 {
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
     if (!WriteInterfaceToken(data)) {
         return;
     }
@@ -71,7 +72,7 @@ void AbilitySchedulerProxy::ScheduleConnectAbility(const Want &want)
 {
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
     if (!WriteInterfaceToken(data)) {
         return;
     }
@@ -89,7 +90,7 @@ void AbilitySchedulerProxy::ScheduleDisconnectAbility(const Want &want)
 {
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
     if (!WriteInterfaceToken(data)) {
         return;
     }
@@ -108,7 +109,7 @@ void AbilitySchedulerProxy::ScheduleCommandAbility(const Want &want, bool restar
 {
     MessageParcel data;
     MessageParcel reply;
-    MessageOption option;
+    MessageOption option(MessageOption::TF_ASYNC);
     if (!WriteInterfaceToken(data)) {
         return;
     }
@@ -466,14 +467,13 @@ std::shared_ptr<ResultSet> AbilitySchedulerProxy::Query(
         return nullptr;
     }
 
-    ResultSet *value = reply.ReadParcelable<ResultSet>();
-    if (value == nullptr) {
-        HILOG_ERROR("ReadParcelable value is nullptr");
+    // a large result set is a cursor, its rows are paged through shared memory when they are read.
+    std::shared_ptr<ResultSet> resultSet = SharedResultSet::ReadResultSet(reply);
+    if (resultSet == nullptr) {
+        HILOG_ERROR("ReadResultSet value is nullptr");
         return nullptr;
     }
 
-    std::shared_ptr<ResultSet> resultSet(value);
-
     return resultSet;
 }
 
@@ -612,5 +612,57 @@ int AbilitySchedulerProxy::BatchInsert(const Uri &uri, const std::vector<ValuesB
 
     return ret;
 }
+
+std::vector<std::shared_ptr<DataAbilityResult>> AbilitySchedulerProxy::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    std::vector<std::shared_ptr<DataAbilityResult>> results;
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return results;
+    }
+
+    // The whole batch goes in one parcel, the provider resolves the back references between operations.
+    int count = operations.size();
+    if (!data.WriteInt32(count)) {
+        HILOG_ERROR("fail to WriteInt32 count");
+        return results;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (operations[i] == nullptr || !data.WriteParcelable(operations[i].get())) {
+            HILOG_ERROR("fail to WriteParcelable operation, index = %{public}d", i);
+            return results;
+        }
+    }
+
+    int32_t err = Remote()->SendRequest(IAbilityScheduler::SCHEDULE_EXECUTEBATCH, data, reply, option);
+    if (err != NO_ERROR) {
+        HILOG_ERROR("ExecuteBatch fail to SendRequest. err: %d", err);
+        return results;
+    }
+
+    int resultCount = 0;
+    if (!reply.ReadInt32(resultCount) || resultCount < 0 ||
+        static_cast<size_t>(resultCount) > reply.GetReadableBytes() / sizeof(int32_t)) {
+        HILOG_ERROR("fail to ReadInt32 resultCount");
+        return results;
+    }
+
+    results.reserve(resultCount);
+    for (int i = 0; i < resultCount; i++) {
+        std::shared_ptr<DataAbilityResult> result(reply.ReadParcelable<DataAbilityResult>());
+        if (result == nullptr) {
+            HILOG_ERROR("fail to ReadParcelable result, index = %{public}d", i);
+            break;
+        }
+        results.emplace_back(result);
+    }
+    return results;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "hilog_wrapper.h"
 #include "ipc_types.h"
 #include "pac_map.h"
+#include "shared_result_set.h"
 #include "want.h"
 
 namespace OHOS {
@@ -41,6 +42,7 @@ AbilitySchedulerStub::AbilitySchedulerStub()
     requestFuncMap_[SCHEDULE_GETTYPE] = &AbilitySchedulerStub::GetTypeInner;
     requestFuncMap_[SCHEDULE_RELOAD] = &AbilitySchedulerStub::ReloadInner;
     requestFuncMap_[SCHEDULE_BATCHINSERT] = &AbilitySchedulerStub::BatchInsertInner;
+    requestFuncMap_[SCHEDULE_EXECUTEBATCH] = &AbilitySchedulerStub::ExecuteBatchInner;
 }
 
 AbilitySchedulerStub::~AbilitySchedulerStub()
@@ -303,9 +305,8 @@ int AbilitySchedulerStub::QueryInner(MessageParcel &data, MessageParcel &reply)
         return ERR_INVALID_VALUE;
     }
     std::shared_ptr<ResultSet> resultSet = Query(*uri, columns, *predicates);
-    ResultSet *resultSetPtr = resultSet.get();
-    if (resultSetPtr == nullptr || !reply.WriteParcelable(resultSetPtr)) {
-        HILOG_ERROR("fail to WriteParcelable resultSet");
+    if (!SharedResultSet::WriteResultSet(reply, resultSet)) {
+        HILOG_ERROR("fail to WriteResultSet resultSet");
         return ERR_INVALID_VALUE;
     }
     delete uri;
@@ -385,6 +386,45 @@ int AbilitySchedulerStub::BatchInsertInner(MessageParcel &data, MessageParcel &r
     return NO_ERROR;
 }
 
+int AbilitySchedulerStub::ExecuteBatchInner(MessageParcel &data, MessageParcel &reply)
+{
+    int count = 0;
+    if (!data.ReadInt32(count) || count < 0) {
+        HILOG_ERROR("fail to ReadInt32 count");
+        return ERR_INVALID_VALUE;
+    }
+    // every operation takes at least the int32 header of a parcelable, a larger count is malformed.
+    if (static_cast<size_t>(count) > data.GetReadableBytes() / sizeof(int32_t)) {
+        HILOG_ERROR("AbilitySchedulerStub count %{public}d exceeds the parcel", count);
+        return ERR_INVALID_VALUE;
+    }
+
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+    operations.reserve(count);
+    for (int i = 0; i < count; i++) {
+        std::shared_ptr<DataAbilityOperation> operation(data.ReadParcelable<DataAbilityOperation>());
+        if (operation == nullptr) {
+            HILOG_ERROR("AbilitySchedulerStub operation is nullptr, index = %{public}d", i);
+            return ERR_INVALID_VALUE;
+        }
+        operations.emplace_back(operation);
+    }
+
+    std::vector<std::shared_ptr<DataAbilityResult>> results = ExecuteBatch(operations);
+    int resultCount = results.size();
+    if (!reply.WriteInt32(resultCount)) {
+        HILOG_ERROR("fail to WriteInt32 resultCount");
+        return ERR_INVALID_VALUE;
+    }
+    for (int i = 0; i < resultCount; i++) {
+        if (results[i] == nullptr || !reply.WriteParcelable(results[i].get())) {
+            HILOG_ERROR("fail to WriteParcelable result, index = %{public}d", i);
+            return ERR_INVALID_VALUE;
+        }
+    }
+    return NO_ERROR;
+}
+
 void AbilitySchedulerRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
 {
     HILOG_ERROR("recv AbilitySchedulerRecipient death notice");
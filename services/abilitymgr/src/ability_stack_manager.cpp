@@ -31,6 +31,7 @@ AbilityStackManager::AbilityStackManager(int userId) : userId_(userId)
 
 void AbilityStackManager::Init()
 {
+    StackChangeGuard guard(*this);
     launcherMissionStack_ = std::make_shared<MissionStack>(LAUNCHER_MISSION_STACK_ID, userId_);
     missionStackList_.push_back(launcherMissionStack_);
     defaultMissionStack_ = std::make_shared<MissionStack>(DEFAULT_MISSION_STACK_ID, userId_);
@@ -43,7 +44,7 @@ AbilityStackManager::~AbilityStackManager()
 
 int AbilityStackManager::StartAbility(const AbilityRequest &abilityRequest)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
 
     auto currentTopAbilityRecord = GetCurrentTopAbility();
     if (!CanStartInLockMissionState(abilityRequest, currentTopAbilityRecord)) {
@@ -59,10 +60,9 @@ int AbilityStackManager::StartAbility(const AbilityRequest &abilityRequest)
         return ERR_INVALID_VALUE;
     }
 
-    if (!waittingAbilityQueue_.empty()) {
+    if (!waittingAbilityQueue_.IsEmpty()) {
         HILOG_INFO("waiting queue is not empty, so enqueue ability for waiting.");
-        EnqueueWaittingAbility(abilityRequest);
-        return START_ABILITY_WAITING;
+        return EnqueueWaittingAbility(abilityRequest);
     }
 
     if (currentTopAbilityRecord != nullptr) {
@@ -70,16 +70,116 @@ int AbilityStackManager::StartAbility(const AbilityRequest &abilityRequest)
         HILOG_DEBUG("%s, current top %s", __func__, element.c_str());
         if (currentTopAbilityRecord->GetAbilityState() != ACTIVE) {
             HILOG_INFO("Top ability is not active, so enqueue ability for waiting.");
-            EnqueueWaittingAbility(abilityRequest);
-            return START_ABILITY_WAITING;
+            return EnqueueWaittingAbility(abilityRequest);
         }
     }
 
     return StartAbilityLocked(currentTopAbilityRecord, abilityRequest);
 }
 
+int AbilityStackManager::StartAbilities(const std::vector<AbilityRequest> &abilityRequests)
+{
+    StackChangeGuard guard(*this);
+    if (abilityRequests.empty()) {
+        HILOG_ERROR("no ability to start");
+        return ERR_INVALID_VALUE;
+    }
+
+    int result = CheckStartAbilities(abilityRequests);
+    if (result != ERR_OK) {
+        return result;
+    }
+
+    auto currentTopAbilityRecord = GetCurrentTopAbility();
+    if (!waittingAbilityQueue_.IsEmpty() ||
+        (currentTopAbilityRecord != nullptr && currentTopAbilityRecord->GetAbilityState() != ACTIVE)) {
+        HILOG_INFO("Top ability is not ready, so enqueue abilities for waiting.");
+        for (const auto &abilityRequest : abilityRequests) {
+            result = EnqueueWaittingAbility(abilityRequest);
+            if (result != START_ABILITY_WAITING) {
+                return result;
+            }
+        }
+        return result;
+    }
+
+    // the abilities are pushed in order, only the last one is loaded or activated.
+    // the others stay initial until they are returned to, and then they are loaded by ProcessActivate.
+    std::shared_ptr<AbilityRecord> targetAbilityRecord;
+    for (const auto &abilityRequest : abilityRequests) {
+        std::shared_ptr<AbilityRecord> belowAbilityRecord =
+            targetAbilityRecord ? targetAbilityRecord : currentTopAbilityRecord;
+        std::shared_ptr<AbilityRecord> abilityRecord;
+        result = PushAbilityLocked(belowAbilityRecord, abilityRequest, abilityRecord);
+        if (result != ERR_OK) {
+            HILOG_ERROR("failed to push ability, start the abilities pushed already");
+            break;
+        }
+        if (belowAbilityRecord == nullptr) {
+            abilityRecord->SetLauncherRoot();
+        }
+        targetAbilityRecord = abilityRecord;
+    }
+    if (targetAbilityRecord == nullptr) {
+        return result;
+    }
+
+    if (currentTopAbilityRecord == nullptr) {
+        int loadResult = targetAbilityRecord->LoadAbility();
+        return (result != ERR_OK) ? result : loadResult;
+    }
+    if (targetAbilityRecord != currentTopAbilityRecord) {
+        // the current top ability hands over to the last ability directly, see CompleteInactive and CompleteActive.
+        targetAbilityRecord->SetPreAbilityRecord(currentTopAbilityRecord);
+        currentTopAbilityRecord->SetNextAbilityRecord(targetAbilityRecord);
+    }
+    currentTopAbilityRecord->Inactivate();
+    return result;
+}
+
+int AbilityStackManager::CheckStartAbilities(const std::vector<AbilityRequest> &abilityRequests)
+{
+    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    auto currentTopAbilityRecord = GetCurrentTopAbility();
+    for (const auto &abilityRequest : abilityRequests) {
+        if (!CanStartInLockMissionState(abilityRequest, currentTopAbilityRecord)) {
+            SendUnlockMissionMessage();
+            return LOCK_MISSION_STATE_DENY_REQUEST;
+        }
+        if (abilityRequest.abilityInfo.applicationInfo.isLauncherApp &&
+            abilityRequest.abilityInfo.type == AppExecFwk::AbilityType::PAGE && currentTopAbilityRecord &&
+            AbilitUtil::IsSystemDialogAbility(currentTopAbilityRecord->GetAbilityInfo().bundleName,
+                currentTopAbilityRecord->GetAbilityInfo().name)) {
+            HILOG_ERROR("page ability is dialog type, cannot return to luncher");
+            return ERR_INVALID_VALUE;
+        }
+    }
+    return ERR_OK;
+}
+
 int AbilityStackManager::StartAbilityLocked(
     const std::shared_ptr<AbilityRecord> &currentTopAbility, const AbilityRequest &abilityRequest)
+{
+    std::shared_ptr<AbilityRecord> targetAbilityRecord;
+    int result = PushAbilityLocked(currentTopAbility, abilityRequest, targetAbilityRecord);
+    if (result != ERR_OK) {
+        return result;
+    }
+
+    // load ability or inactive top ability
+    // If top ability is null, then launch the first Ability.
+    // If top ability is not null,. then inactive current top ability
+    if (currentTopAbility == nullptr) {
+        targetAbilityRecord->SetLauncherRoot();
+        result = targetAbilityRecord->LoadAbility();
+    } else {
+        currentTopAbility->Inactivate();
+    }
+    return result;
+}
+
+int AbilityStackManager::PushAbilityLocked(const std::shared_ptr<AbilityRecord> &currentTopAbility,
+    const AbilityRequest &abilityRequest, std::shared_ptr<AbilityRecord> &targetAbilityRecord)
 {
     if (!currentMissionStack_) {
         HILOG_ERROR("currentMissionStack_ is nullptr");
@@ -95,7 +195,6 @@ int AbilityStackManager::StartAbilityLocked(
     // 2. move target mission stack to top, currentMissionStack will be changed.
     MoveMissionStackToTop(stack);
     // 3. get mission record and ability recode
-    std::shared_ptr<AbilityRecord> targetAbilityRecord;
     std::shared_ptr<MissionRecord> targetMissionRecord;
     GetMissionRecordAndAbilityRecord(abilityRequest, currentTopAbility, targetAbilityRecord, targetMissionRecord);
     if (targetAbilityRecord == nullptr || targetMissionRecord == nullptr) {
@@ -106,18 +205,7 @@ int AbilityStackManager::StartAbilityLocked(
     // // add caller record
     targetAbilityRecord->AddCallerRecord(abilityRequest.callerToken, abilityRequest.requestCode);
     MoveMissionAndAbility(currentTopAbility, targetAbilityRecord, targetMissionRecord, true);
-
-    // load ability or inactive top ability
-    // If top ability is null, then launch the first Ability.
-    // If top ability is not null,. then inactive current top ability
-    int result = ERR_OK;
-    if (currentTopAbility == nullptr) {
-        targetAbilityRecord->SetLauncherRoot();
-        result = targetAbilityRecord->LoadAbility();
-    } else {
-        currentTopAbility->Inactivate();
-    }
-    return result;
+    return ERR_OK;
 }
 
 void AbilityStackManager::MoveMissionAndAbility(const std::shared_ptr<AbilityRecord> &currentTopAbility,
@@ -164,7 +252,7 @@ void AbilityStackManager::MoveMissionAndAbility(const std::shared_ptr<AbilityRec
 
 int AbilityStackManager::TerminateAbility(const sptr<IRemoteObject> &token, int resultCode, const Want *resultWant)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     std::shared_ptr<AbilityRecord> abilityRecord = Token::GetAbilityRecordByToken(token);
     if (abilityRecord == nullptr) {
         HILOG_ERROR("token is invalid");
@@ -202,7 +290,7 @@ int AbilityStackManager::TerminateAbility(const sptr<IRemoteObject> &token, int
 int AbilityStackManager::TerminateAbility(const std::shared_ptr<AbilityRecord> &caller, int requestCode)
 {
     HILOG_INFO("%{public}s, called", __func__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
 
     std::shared_ptr<AbilityRecord> targetAbility = nullptr;
     for (auto &stack : missionStackList_) {
@@ -278,7 +366,7 @@ int AbilityStackManager::TerminateAbilityLocked(
 
 int AbilityStackManager::RemoveMissionById(int missionId)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (missionId < 0) {
         HILOG_ERROR("missionId is invalid");
         return ERR_INVALID_VALUE;
@@ -335,6 +423,7 @@ int AbilityStackManager::RemoveMissionByIdLocked(int missionId)
         if (abilityRecord->IsAbilityState(AbilityState::INITIAL)) {
             HILOG_INFO("ability record state is INITIAL, remove ability, continue");
             missionRecord->RemoveAbilityRecord(abilityRecord);
+            abilityRecord->RevokeToken();
             if (missionRecord->GetAbilityRecordCount() == 0) {
                 auto stack = missionRecord->GetParentStack();
                 if (stack) {
@@ -357,7 +446,7 @@ int AbilityStackManager::RemoveMissionByIdLocked(int missionId)
 int AbilityStackManager::RemoveStack(int stackId)
 {
     HILOG_DEBUG("AbilityStackManager::RemoveStack, stackId : %{public}d", stackId);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (stackId < 0) {
         HILOG_ERROR("stackId is invalid");
         return ERR_INVALID_VALUE;
@@ -525,6 +614,19 @@ std::shared_ptr<MissionRecord> AbilityStackManager::GetMissionRecordFromAllStack
     return nullptr;
 }
 
+bool AbilityStackManager::IsExistMission(int id)
+{
+    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    return GetMissionRecordFromAllStacks(id) != nullptr;
+}
+
+bool AbilityStackManager::IsExistBundleInMission(int id, const std::string &bundleName)
+{
+    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    auto missionRecord = GetMissionRecordFromAllStacks(id);
+    return missionRecord != nullptr && missionRecord->IsExistBundle(bundleName);
+}
+
 std::shared_ptr<AbilityRecord> AbilityStackManager::GetAbilityRecordByToken(const sptr<IRemoteObject> &token)
 {
     std::lock_guard<std::recursive_mutex> guard(stackLock_);
@@ -585,7 +687,7 @@ std::shared_ptr<MissionStack> AbilityStackManager::GetTargetMissionStack(const A
 
 int AbilityStackManager::AttachAbilityThread(const sptr<IAbilityScheduler> &scheduler, const sptr<IRemoteObject> &token)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     std::shared_ptr<AbilityRecord> abilityRecord = GetAbilityRecordByToken(token);
     if (abilityRecord == nullptr) {
         HILOG_ERROR("abilityRecord is null");
@@ -601,7 +703,7 @@ int AbilityStackManager::AttachAbilityThread(const sptr<IAbilityScheduler> &sche
         HILOG_ERROR("fail to get AbilityEventHandler");
         return ERR_INVALID_VALUE;
     }
-    handler->RemoveEvent(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
 
     abilityRecord->SetScheduler(scheduler);
     DelayedSingleton<AppScheduler>::GetInstance()->MoveToForground(token);
@@ -611,7 +713,7 @@ int AbilityStackManager::AttachAbilityThread(const sptr<IAbilityScheduler> &sche
 
 int AbilityStackManager::AbilityTransitionDone(const sptr<IRemoteObject> &token, int state)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     std::shared_ptr<AbilityRecord> abilityRecord = GetAbilityRecordByToken(token);
     if (abilityRecord == nullptr) {
         HILOG_INFO("abilityRecord may in terminate list");
@@ -671,7 +773,7 @@ int AbilityStackManager::DispatchActive(const std::shared_ptr<AbilityRecord> &ab
             state);
         return ERR_INVALID_VALUE;
     }
-    handler->RemoveEvent(AbilityManagerService::ACTIVE_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
     auto task = [stackManager = shared_from_this(), abilityRecord]() { stackManager->CompleteActive(abilityRecord); };
     handler->PostTask(task);
     return ERR_OK;
@@ -695,7 +797,7 @@ int AbilityStackManager::DispatchInactive(const std::shared_ptr<AbilityRecord> &
             state);
         return ERR_INVALID_VALUE;
     }
-    handler->RemoveEvent(AbilityManagerService::INACTIVE_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
     auto task = [stackManager = shared_from_this(), abilityRecord]() { stackManager->CompleteInactive(abilityRecord); };
     handler->PostTask(task);
     return ERR_OK;
@@ -717,7 +819,7 @@ int AbilityStackManager::DispatchBackground(const std::shared_ptr<AbilityRecord>
         return ERR_INVALID_VALUE;
     }
     // remove background timeout task.
-    handler->RemoveTask(std::to_string(abilityRecord->GetEventId()));
+    abilityRecord->CancelTimeout();
     auto task = [stackManager = shared_from_this(), abilityRecord]() {
         stackManager->CompleteBackground(abilityRecord);
     };
@@ -741,7 +843,7 @@ int AbilityStackManager::DispatchTerminate(const std::shared_ptr<AbilityRecord>
         return INNER_ERR;
     }
     // remove terminate timeout task.
-    handler->RemoveTask(std::to_string(abilityRecord->GetEventId()));
+    abilityRecord->CancelTimeout();
     auto task = [stackManager = shared_from_this(), abilityRecord]() {
         stackManager->CompleteTerminate(abilityRecord);
     };
@@ -752,7 +854,7 @@ int AbilityStackManager::DispatchTerminate(const std::shared_ptr<AbilityRecord>
 void AbilityStackManager::AddWindowInfo(const sptr<IRemoteObject> &token, int32_t windowToken)
 {
     HILOG_DEBUG("add window id.");
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     // create WindowInfo and add to its AbilityRecord
     std::shared_ptr<AbilityRecord> abilityRecord = GetAbilityRecordByToken(token);
     if (abilityRecord == nullptr) {
@@ -782,7 +884,7 @@ void AbilityStackManager::AddWindowInfo(const sptr<IRemoteObject> &token, int32_
 void AbilityStackManager::OnAbilityRequestDone(const sptr<IRemoteObject> &token, const int32_t state)
 {
     HILOG_DEBUG("ability request app state %{public}d done", state);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     AppAbilityState abilitState = DelayedSingleton<AppScheduler>::GetInstance()->ConvertToAppAbilityState(state);
     if (abilitState == AppAbilityState::ABILITY_STATE_FOREGROUND) {
         std::shared_ptr<AbilityRecord> abilityRecord = GetAbilityRecordByToken(token);
@@ -798,7 +900,7 @@ void AbilityStackManager::OnAbilityRequestDone(const sptr<IRemoteObject> &token,
 
 void AbilityStackManager::CompleteActive(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (!abilityRecord) {
         HILOG_ERROR("%{public}s, abilityRecord is nullptr", __func__);
         return;
@@ -807,6 +909,7 @@ void AbilityStackManager::CompleteActive(const std::shared_ptr<AbilityRecord> &a
     HILOG_INFO("%{public}s, ability: %{public}s", __func__, element.c_str());
 
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
+    abilityRecord->CompleteTransition(TRANSITION_ACTIVATE);
 
     std::shared_ptr<AbilityEventHandler> handler =
         DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
@@ -866,7 +969,7 @@ void AbilityStackManager::CompleteActive(const std::shared_ptr<AbilityRecord> &a
         HILOG_INFO("%{public}s, back ability record: %{public}s", __func__, backElement.c_str());
         MoveToBackgroundTask(backAbilityRecord);
     }
-    if (powerOffing_ && waittingAbilityQueue_.empty()) {
+    if (powerOffing_ && waittingAbilityQueue_.IsEmpty()) {
         HILOG_INFO("Wait for the ability life cycle to complete and execute poweroff");
         PowerOffLocked();
     }
@@ -890,10 +993,11 @@ void AbilityStackManager::MoveToBackgroundTask(const std::shared_ptr<AbilityReco
 
 void AbilityStackManager::CompleteInactive(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     std::string element = abilityRecord->GetWant().GetElement().GetURI();
     HILOG_INFO("%{public}s, ability: %{public}s", __func__, element.c_str());
     abilityRecord->SetAbilityState(AbilityState::INACTIVE);
+    abilityRecord->CompleteTransition(TRANSITION_INACTIVATE);
     // ability state is inactive
     if (abilityRecord->GetPowerState()) {
         if (abilityRecord == GetCurrentTopAbility()) {
@@ -961,7 +1065,7 @@ void AbilityStackManager::CompleteInactive(const std::shared_ptr<AbilityRecord>
 
 void AbilityStackManager::CompleteBackground(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     std::string element = abilityRecord->GetWant().GetElement().GetURI();
     sptr<Token> token = abilityRecord->GetToken();
     HILOG_INFO("%{public}s, ability: %{public}s", __func__, element.c_str());
@@ -972,6 +1076,7 @@ void AbilityStackManager::CompleteBackground(const std::shared_ptr<AbilityRecord
     }
 
     abilityRecord->SetAbilityState(AbilityState::BACKGROUND);
+    abilityRecord->CompleteTransition(TRANSITION_BACKGROUND);
     // send application state to AppMS.
     // notify AppMS to update application state.
     DelayedSingleton<AppScheduler>::GetInstance()->MoveToBackground(token);
@@ -989,13 +1094,14 @@ void AbilityStackManager::CompleteBackground(const std::shared_ptr<AbilityRecord
 
 void AbilityStackManager::CompleteTerminate(const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (!abilityRecord) {
         HILOG_ERROR("%{public}s, abilityRecord is nullptr", __func__);
         return;
     }
     std::string element = abilityRecord->GetWant().GetElement().GetURI();
     HILOG_INFO("%{public}s, ability: %{public}s", __func__, element.c_str());
+    abilityRecord->CompleteTransition(TRANSITION_TERMINATE);
 
     // notify AppMS terminate
     if (abilityRecord->TerminateAbility() != ERR_OK) {
@@ -1010,6 +1116,7 @@ void AbilityStackManager::CompleteTerminate(const std::shared_ptr<AbilityRecord>
     for (auto it : terminateAbilityRecordList_) {
         if (it == abilityRecord) {
             terminateAbilityRecordList_.remove(it);
+            abilityRecord->RevokeToken();
             HILOG_DEBUG("destroy ability record count %ld", abilityRecord.use_count());
             break;
         }
@@ -1054,13 +1161,10 @@ void AbilityStackManager::DumpStackList(std::vector<std::string> &info)
 
 void AbilityStackManager::GetAllStackInfo(StackInfo &stackInfo)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
-    for (auto missionStack : missionStackList_) {
-        MissionStackInfo missionStackInfo;
-        missionStackInfo.id = missionStack->GetMissionStackId();
-        missionStack->GetAllMissionInfo(missionStackInfo.missionRecords);
-        stackInfo.missionStackInfos.emplace_back(missionStackInfo);
-    }
+    auto stackModel = GetStackModel();
+    stackInfo.missionStackInfos.insert(stackInfo.missionStackInfos.end(),
+        stackModel->stackInfo.missionStackInfos.begin(),
+        stackModel->stackInfo.missionStackInfos.end());
 }
 
 void AbilityStackManager::DumpMission(int missionId, std::vector<std::string> &info)
@@ -1092,41 +1196,33 @@ void AbilityStackManager::DumpTopAbility(std::vector<std::string> &info)
 
 void AbilityStackManager::DumpWaittingAbilityQueue(std::string &result)
 {
-    std::queue<AbilityRequest> copyQueue;
+    std::vector<std::string> state;
     {
         std::lock_guard<std::recursive_mutex> guard(stackLock_);
-        if (waittingAbilityQueue_.empty()) {
+        if (waittingAbilityQueue_.IsEmpty()) {
             result = "The waitting ability queue is empty.";
             return;
         }
-        copyQueue = waittingAbilityQueue_;
+        waittingAbilityQueue_.Dump(state);
     }
 
     result = "User ID #" + std::to_string(userId_) + LINE_SEPARATOR;
-    while (!copyQueue.empty()) {
-        auto ability = copyQueue.front();
-        std::vector<std::string> state;
-        ability.Dump(state);
-
-        for (auto it : state) {
-            result += it;
-            result += LINE_SEPARATOR;
-        }
-        copyQueue.pop();
+    for (const auto &it : state) {
+        result += it;
+        result += LINE_SEPARATOR;
     }
     return;
 }
 
-void AbilityStackManager::EnqueueWaittingAbility(const AbilityRequest &abilityRequest)
+int AbilityStackManager::EnqueueWaittingAbility(const AbilityRequest &abilityRequest)
 {
-    waittingAbilityQueue_.push(abilityRequest);
-    return;
+    return waittingAbilityQueue_.Enqueue(abilityRequest);
 }
 
 void AbilityStackManager::StartWaittingAbility()
 {
     std::shared_ptr<AbilityRecord> topAbility;
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     topAbility = GetCurrentTopAbility();
     if (!topAbility) {
         HILOG_INFO("%{public}s, topAbility is nullptr", __func__);
@@ -1137,9 +1233,8 @@ void AbilityStackManager::StartWaittingAbility()
         return;
     }
 
-    if (!waittingAbilityQueue_.empty()) {
-        AbilityRequest abilityRequest = waittingAbilityQueue_.front();
-        waittingAbilityQueue_.pop();
+    AbilityRequest abilityRequest;
+    if (waittingAbilityQueue_.Dequeue(abilityRequest)) {
         StartAbilityLocked(topAbility, abilityRequest);
     }
 }
@@ -1262,7 +1357,6 @@ int AbilityStackManager::GetRecentMissions(
     const int32_t numMax, const int32_t flags, std::vector<AbilityMissionInfo> &recentList)
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
     if (numMax < 0) {
         HILOG_ERROR("get recent missions, numMax is invalid");
         return ERR_INVALID_VALUE;
@@ -1272,47 +1366,21 @@ int AbilityStackManager::GetRecentMissions(
         return ERR_INVALID_VALUE;
     }
 
-    return GetRecentMissionsLocked(numMax, flags, recentList);
-}
-
-int AbilityStackManager::GetRecentMissionsLocked(
-    const int32_t numMax, const int32_t flags, std::vector<AbilityMissionInfo> &recentList)
-{
-    HILOG_INFO("%{public}s,%{public}d", __func__, __LINE__);
-    if (defaultMissionStack_ == nullptr) {
+    auto stackModel = GetStackModel();
+    if (!stackModel->initialized) {
         HILOG_ERROR("defaultMissionStack_ is invalid");
         return ERR_NO_INIT;
     }
 
+    // flags is RECENT_IGNORE_UNAVAILABLE, the missions whose top ability is not started yet are skipped.
     bool withExcluded = (static_cast<uint32_t>(flags) & RECENT_WITH_EXCLUDED) != 0;
-    std::vector<MissionRecordInfo> missionInfos;
-    defaultMissionStack_->GetAllMissionInfo(missionInfos);
-    for (auto &mission : missionInfos) {
+    for (size_t i = 0; i < stackModel->recentMissions.size(); i++) {
         if (static_cast<int>(recentList.size()) >= numMax) {
             break;
         }
-        // flags is RECENT_IGNORE_UNAVAILABLE,
-        // You need to determine the mission optimized by the process
-        // Then continue
-        if (!withExcluded) {
-            auto missionRecord = defaultMissionStack_->GetMissionRecordById(mission.id);
-            if (!missionRecord) {
-                HILOG_ERROR("mission is nullptr, continue");
-                continue;
-            }
-            auto ability = missionRecord->GetTopAbilityRecord();
-            if (!ability) {
-                HILOG_ERROR("ability is nullptr, continue");
-                continue;
-            }
-            if (ability->IsAbilityState(AbilityState::INITIAL)) {
-                HILOG_INFO("flag is RECENT_IGNORE_UNAVAILABLE, ability state: INITIAL, continue");
-                continue;
-            }
+        if (withExcluded || stackModel->available[i]) {
+            recentList.emplace_back(stackModel->recentMissions[i]);
         }
-        AbilityMissionInfo recentMissionInfo;
-        CreateRecentMissionInfo(mission, recentMissionInfo);
-        recentList.emplace_back(recentMissionInfo);
     }
 
     return ERR_OK;
@@ -1370,6 +1438,7 @@ int AbilityStackManager::SetMissionDescriptionInfo(
     auto mission = abilityRecord->GetMissionRecord();
     CHECK_POINTER_AND_RETURN(mission, SET_MISSION_INFO_FAILED);
     auto ptr = std::make_shared<MissionDescriptionInfo>(missionDescriptionInfo);
+    StackChangeGuard guard(*this);
     mission->SetMissionDescriptionInfo(ptr);
 
     return ERR_OK;
@@ -1378,17 +1447,13 @@ int AbilityStackManager::SetMissionDescriptionInfo(
 int AbilityStackManager::GetMissionLockModeState()
 {
     HILOG_DEBUG("%{public}s called", __FUNCTION__);
-    if (!lockMissionContainer_) {
-        return LockMissionContainer::LockMissionState::LOCK_MISSION_STATE_NONE;
-    }
-
-    return lockMissionContainer_->GetLockedMissionState();
+    return GetStackModel()->lockModeState;
 }
 
 int AbilityStackManager::MoveMissionToTop(int32_t missionId)
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (missionId < 0) {
         HILOG_ERROR("%{public}s, mission id is invalid", __func__);
         return ERR_INVALID_VALUE;
@@ -1443,7 +1508,7 @@ int AbilityStackManager::MoveMissionToTopLocked(int32_t missionId)
 
 int AbilityStackManager::MoveMissionToEnd(const sptr<IRemoteObject> &token, const bool nonFirst)
 {
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (lockMissionContainer_ && lockMissionContainer_->IsLockedMissionState()) {
         HILOG_ERROR("current is lock mission state, refusing to operate other mission.");
         return ERR_INVALID_VALUE;
@@ -1520,7 +1585,7 @@ int AbilityStackManager::MoveMissionToEndLocked(const sptr<IRemoteObject> &token
 void AbilityStackManager::OnAbilityDied(std::shared_ptr<AbilityRecord> abilityRecord)
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (!abilityRecord) {
         HILOG_ERROR("OnAbilityDied record is nullptr");
         return;
@@ -1593,6 +1658,7 @@ void AbilityStackManager::OnAbilityDiedByLauncher(std::shared_ptr<AbilityRecord>
         abilityRecord->SetAbilityState(AbilityState::INITIAL);
     } else {
         mission->RemoveAbilityRecord(abilityRecord);
+        abilityRecord->RevokeToken();
         if (mission->GetAbilityRecordCount() == 0) {
             launcherMissionStack_->RemoveMissionRecord(mission->GetMissionRecordId());
         }
@@ -1650,6 +1716,7 @@ void AbilityStackManager::OnAbilityDiedByDefault(std::shared_ptr<AbilityRecord>
             if (abilityRecord->IsUninstallAbility()) {
                 HILOG_INFO("ability uninstall,%{public}d", __LINE__);
                 mission->RemoveAbilityRecord(abilityRecord);
+                abilityRecord->RevokeToken();
                 if (mission->GetAbilityRecordCount() == 0) {
                     defaultMissionStack_->RemoveMissionRecord(mission->GetMissionRecordId());
                 }
@@ -1664,6 +1731,7 @@ void AbilityStackManager::OnAbilityDiedByDefault(std::shared_ptr<AbilityRecord>
             } else {
                 HILOG_INFO("ability died, remove record, %{public}d", __LINE__);
                 mission->RemoveAbilityRecord(abilityRecord);
+                abilityRecord->RevokeToken();
             }
             break;
         }
@@ -1681,7 +1749,7 @@ void AbilityStackManager::OnAbilityDiedByDefault(std::shared_ptr<AbilityRecord>
 void AbilityStackManager::BackToLauncher()
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     if (!defaultMissionStack_ || !launcherMissionStack_) {
         HILOG_ERROR("mission stack is invalid");
         return;
@@ -1762,7 +1830,7 @@ void AbilityStackManager::UninstallApp(const std::string &bundleName)
 void AbilityStackManager::AddUninstallTags(const std::string &bundleName)
 {
     HILOG_INFO("%{public}s, bundleName: %{public}s %{public}d", __func__, bundleName.c_str(), __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     for (auto &stack : missionStackList_) {
         std::vector<MissionRecordInfo> missions;
         stack->GetAllMissionInfo(missions);
@@ -1784,6 +1852,7 @@ void AbilityStackManager::AddUninstallTags(const std::string &bundleName)
                 if (ability->GetAbilityInfo().bundleName == bundleName) {
                     if (ability->IsAbilityState(AbilityState::INITIAL)) {
                         mission->RemoveAbilityRecord(ability);
+                        ability->RevokeToken();
                         stack->RemoveMissionRecord(mission->GetMissionRecordId());
                         if (lockMissionContainer_ && lockMissionContainer_->IsLockedMissionState()) {
                             if (lockMissionContainer_->IsSameLockedMission(mission->GetName())) {
@@ -1799,39 +1868,28 @@ void AbilityStackManager::AddUninstallTags(const std::string &bundleName)
     }
 }
 
-std::shared_ptr<AbilityRecord> AbilityStackManager::GetAbilityRecordByEventId(int64_t eventId) const
+void AbilityStackManager::OnTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
     HILOG_DEBUG("%{public}s", __func__);
-    for (auto &stack : missionStackList_) {
-        std::vector<MissionRecordInfo> missionInfos;
-        stack->GetAllMissionInfo(missionInfos);
-        for (auto &mission : missionInfos) {
-            auto missionRecord = stack->GetMissionRecordById(mission.id);
-            if (!missionRecord) {
-                continue;
-            }
-            for (auto &it : mission.abilityRecordInfos) {
-                auto abilityRecord = missionRecord->GetAbilityRecordById(it.id);
-                if (abilityRecord && abilityRecord->GetEventId() == eventId) {
-                    HILOG_DEBUG("%{public}s get ability record", __func__);
-                    return abilityRecord;
-                }
-            }
-        }
+    CHECK_POINTER(abilityRecord);
+    StackChangeGuard guard(*this);
+    // the timeout fires with its record, only check that the record is still in the stacks of this manager.
+    auto mission = abilityRecord->GetMissionRecord();
+    if (mission == nullptr || mission->GetAbilityRecordById(abilityRecord->GetRecordId()) != abilityRecord) {
+        HILOG_ERROR("stack manager on time out event: ability record is not in mission.");
+        return;
     }
-    return nullptr;
-}
-
-void AbilityStackManager::OnTimeOut(uint32_t msgId, int64_t eventId)
-{
-    HILOG_DEBUG("%{public}s", __func__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
-    auto abilityRecord = GetAbilityRecordByEventId(eventId);
-    if (abilityRecord == nullptr) {
-        HILOG_ERROR("stack manager on time out event: ability record is nullptr.");
+    auto stack = mission->GetParentStack();
+    if (stack == nullptr || std::find(missionStackList_.begin(), missionStackList_.end(), stack) ==
+        missionStackList_.end()) {
+        HILOG_ERROR("stack manager on time out event: ability record is not in stacks.");
         return;
     }
+    OnTimeOutLocked(msgId, abilityRecord);
+}
 
+void AbilityStackManager::OnTimeOutLocked(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord)
+{
     // release mission when locked.
     auto mission = abilityRecord->GetMissionRecord();
     if (mission && lockMissionContainer_ && lockMissionContainer_->IsLockedMissionState()) {
@@ -1875,6 +1933,7 @@ void AbilityStackManager::ActiveTopAbility(const std::shared_ptr<AbilityRecord>
     }
     DelayedSingleton<AppScheduler>::GetInstance()->AttachTimeOut(abilityRecord->GetToken());
     missionRecord->RemoveAbilityRecord(abilityRecord);
+    abilityRecord->RevokeToken();
     if (missionRecord->GetAbilityRecordCount() == 0) {
         RemoveMissionRecordById(missionRecord->GetMissionRecordId());
     }
@@ -1908,31 +1967,82 @@ void AbilityStackManager::ActiveTopAbility(const bool isAll, int32_t stackId)
 bool AbilityStackManager::IsFirstInMission(const sptr<IRemoteObject> &token)
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
     if (token == nullptr) {
         HILOG_ERROR("token is nullptr");
         return false;
     }
 
-    auto abilityRecord = GetAbilityRecordByToken(token);
-    if (!abilityRecord) {
-        HILOG_ERROR("abilityRecord is nullptr");
-        return false;
+    auto stackModel = GetStackModel();
+    return stackModel->bottomAbilityTokens.count(token.GetRefPtr()) != 0;
+}
+
+std::shared_ptr<const AbilityStackManager::StackModel> AbilityStackManager::GetStackModel()
+{
+    auto stackModel = std::atomic_load(&stackModel_);
+    uint64_t version = modelVersion_.load(std::memory_order_acquire);
+    if (stackModel && stackModel->version == version) {
+        return stackModel;
     }
 
-    auto missionRecord = abilityRecord->GetMissionRecord();
-    if (!missionRecord) {
-        HILOG_ERROR("missionRecord is nullptr");
-        return false;
+    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    // the version does not change while the stacks are locked, unless they are being changed by this thread.
+    version = modelVersion_.load(std::memory_order_acquire);
+    stackModel = std::atomic_load(&stackModel_);
+    if (stackModel && stackModel->version == version) {
+        return stackModel;
     }
+    stackModel = BuildStackModelLocked(version);
+    std::atomic_store(&stackModel_, stackModel);
+    return stackModel;
+}
 
-    return (missionRecord->GetBottomAbilityRecord() == abilityRecord);
+std::shared_ptr<const AbilityStackManager::StackModel> AbilityStackManager::BuildStackModelLocked(uint64_t version)
+{
+    auto stackModel = std::make_shared<StackModel>();
+    stackModel->version = version;
+    for (auto missionStack : missionStackList_) {
+        MissionStackInfo missionStackInfo;
+        missionStackInfo.id = missionStack->GetMissionStackId();
+        missionStack->GetAllMissionInfo(missionStackInfo.missionRecords);
+        for (const auto &mission : missionStackInfo.missionRecords) {
+            auto missionRecord = missionStack->GetMissionRecordById(mission.id);
+            auto bottomAbility = missionRecord ? missionRecord->GetBottomAbilityRecord() : nullptr;
+            if (bottomAbility && bottomAbility->GetToken()) {
+                sptr<IRemoteObject> token = bottomAbility->GetToken()->AsObject();
+                stackModel->bottomAbilityTokens.emplace(token.GetRefPtr(), token);
+            }
+        }
+        stackModel->stackInfo.missionStackInfos.emplace_back(missionStackInfo);
+    }
+
+    if (lockMissionContainer_) {
+        stackModel->lockModeState = lockMissionContainer_->GetLockedMissionState();
+    }
+
+    if (defaultMissionStack_ == nullptr) {
+        return stackModel;
+    }
+    stackModel->initialized = true;
+    for (const auto &missionStackInfo : stackModel->stackInfo.missionStackInfos) {
+        if (missionStackInfo.id != defaultMissionStack_->GetMissionStackId()) {
+            continue;
+        }
+        for (const auto &mission : missionStackInfo.missionRecords) {
+            auto missionRecord = defaultMissionStack_->GetMissionRecordById(mission.id);
+            auto ability = missionRecord ? missionRecord->GetTopAbilityRecord() : nullptr;
+            AbilityMissionInfo recentMissionInfo;
+            CreateRecentMissionInfo(mission, recentMissionInfo);
+            stackModel->recentMissions.emplace_back(recentMissionInfo);
+            stackModel->available.push_back(ability && !ability->IsAbilityState(AbilityState::INITIAL));
+        }
+    }
+    return stackModel;
 }
 
 int AbilityStackManager::PowerOff()
 {
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     return PowerOffLocked();
 }
 
@@ -1941,7 +2051,7 @@ int AbilityStackManager::PowerOffLocked()
     HILOG_INFO("%{public}s,%{public}d", __PRETTY_FUNCTION__, __LINE__);
     auto currentTopAbility = GetCurrentTopAbility();
     if ((currentTopAbility && !currentTopAbility->IsAbilityState(AbilityState::ACTIVE)) ||
-        !waittingAbilityQueue_.empty()) {
+        !waittingAbilityQueue_.IsEmpty()) {
         HILOG_WARN("current top ability is not active, waiting ability lifecycle complete");
         // In CompleteActive,waiting ability lifecycle complete,execute PowerOffLocked again
         powerOffing_ = true;
@@ -1975,7 +2085,7 @@ int AbilityStackManager::PowerOffLocked()
 int AbilityStackManager::PowerOn()
 {
     HILOG_INFO("%{public}s,%{public}d", __func__, __LINE__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
     return PowerOnLocked();
 }
 
@@ -2011,7 +2121,7 @@ int AbilityStackManager::PowerOnLocked()
 int AbilityStackManager::StartLockMission(int uid, int missionId, bool isSystemApp, int isLock)
 {
     HILOG_INFO("%{public}s", __func__);
-    std::lock_guard<std::recursive_mutex> guard(stackLock_);
+    StackChangeGuard guard(*this);
 
     if (lockMissionContainer_ == nullptr) {
         lockMissionContainer_ = std::make_shared<LockMissionContainer>();
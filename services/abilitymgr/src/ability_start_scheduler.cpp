@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_start_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "ability_config.h"
+#include "ability_manager_errors.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+AbilityStartScheduler::AbilityStartScheduler(size_t capacity) : capacity_(capacity)
+{}
+
+int64_t AbilityStartScheduler::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AbilityStartScheduler::Priority AbilityStartScheduler::GetPriority(const AbilityRequest &abilityRequest)
+{
+    if (abilityRequest.abilityInfo.bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME ||
+        abilityRequest.abilityInfo.applicationInfo.isLauncherApp) {
+        return PRIORITY_HIGH;
+    }
+    return PRIORITY_NORMAL;
+}
+
+std::string AbilityStartScheduler::MakeKey(const AbilityRequest &abilityRequest)
+{
+    return abilityRequest.abilityInfo.bundleName + "/" + abilityRequest.abilityInfo.name;
+}
+
+bool AbilityStartScheduler::IsCoalescible(const AbilityRequest &abilityRequest)
+{
+    // a for-result start must deliver the result to its own caller, and every start of a standard ability
+    // creates its own instance.
+    auto launchMode = abilityRequest.abilityInfo.launchMode;
+    return abilityRequest.requestCode < 0 &&
+           (launchMode == AppExecFwk::LaunchMode::SINGLETON || launchMode == AppExecFwk::LaunchMode::SINGLETOP);
+}
+
+bool AbilityStartScheduler::IsSameStart(WaittingStart &waittingStart, const AbilityRequest &abilityRequest)
+{
+    // the reused instance would get the same want again, the waiting start already delivers it.
+    WantParams params = abilityRequest.want.GetParams();
+    return waittingStart.request.want.OperationEquals(abilityRequest.want) &&
+           params == waittingStart.request.want.GetParams();
+}
+
+int AbilityStartScheduler::Enqueue(const AbilityRequest &abilityRequest)
+{
+    std::string key = MakeKey(abilityRequest);
+    bool coalescible = IsCoalescible(abilityRequest);
+    if (coalescible) {
+        auto iter = coalesceIndex_.find(key);
+        if (iter != coalesceIndex_.end() && IsSameStart(*iter->second, abilityRequest)) {
+            // the latest request wins, the request keeps its place and its enqueue time.
+            iter->second->request = abilityRequest;
+            iter->second->coalescedCount++;
+            coalesceCount_++;
+            HILOG_INFO("coalesce waiting start: %{public}s", key.c_str());
+            return START_ABILITY_WAITING;
+        }
+    }
+
+    // the waiting starts were already answered with START_ABILITY_WAITING, none of them is dropped to make room.
+    if (GetSize() >= capacity_) {
+        rejectCount_++;
+        HILOG_ERROR("waiting queue is full, reject start: %{public}s", key.c_str());
+        return START_ABILITY_QUEUE_FULL;
+    }
+
+    Priority priority = GetPriority(abilityRequest);
+    WaittingList &queue = queues_[priority];
+    WaittingStart waittingStart;
+    waittingStart.request = abilityRequest;
+    waittingStart.key = std::move(key);
+    waittingStart.priority = priority;
+    waittingStart.enqueueTime = GetCurrentTime();
+    queue.emplace_back(std::move(waittingStart));
+    if (coalescible) {
+        coalesceIndex_[queue.back().key] = std::prev(queue.end());
+    }
+    return START_ABILITY_WAITING;
+}
+
+bool AbilityStartScheduler::Dequeue(AbilityRequest &abilityRequest)
+{
+    for (int priority = PRIORITY_COUNT - 1; priority >= PRIORITY_NORMAL; priority--) {
+        WaittingList &queue = queues_[priority];
+        if (queue.empty()) {
+            continue;
+        }
+        WaittingStart &waittingStart = queue.front();
+        auto iter = coalesceIndex_.find(waittingStart.key);
+        if (iter != coalesceIndex_.end() && iter->second == queue.begin()) {
+            coalesceIndex_.erase(iter);
+        }
+        int64_t waitTime = GetCurrentTime() - waittingStart.enqueueTime;
+        startCount_++;
+        totalWaitTime_ += waitTime;
+        maxWaitTime_ = std::max(maxWaitTime_, waitTime);
+        HILOG_INFO("start waiting ability: %{public}s, waited %{public}lldms, coalesced %{public}u",
+            waittingStart.key.c_str(), static_cast<long long>(waitTime), waittingStart.coalescedCount);
+        abilityRequest = std::move(waittingStart.request);
+        queue.pop_front();
+        return true;
+    }
+    return false;
+}
+
+bool AbilityStartScheduler::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+size_t AbilityStartScheduler::GetSize() const
+{
+    size_t size = 0;
+    for (const auto &queue : queues_) {
+        size += queue.size();
+    }
+    return size;
+}
+
+void AbilityStartScheduler::Clear()
+{
+    for (auto &queue : queues_) {
+        queue.clear();
+    }
+    coalesceIndex_.clear();
+}
+
+void AbilityStartScheduler::Dump(std::vector<std::string> &info) const
+{
+    int64_t averageWaitTime = (startCount_ == 0) ? 0 : totalWaitTime_ / static_cast<int64_t>(startCount_);
+    info.emplace_back("  waiting #" + std::to_string(GetSize()) + "  started #" + std::to_string(startCount_) +
+                      "  coalesced #" + std::to_string(coalesceCount_) + "  rejected #" +
+                      std::to_string(rejectCount_));
+    info.emplace_back("  average wait #" + std::to_string(averageWaitTime) + "ms  max wait #" +
+                      std::to_string(maxWaitTime_) + "ms");
+
+    int64_t now = GetCurrentTime();
+    for (int priority = PRIORITY_COUNT - 1; priority >= PRIORITY_NORMAL; priority--) {
+        for (const auto &waittingStart : queues_[priority]) {
+            info.emplace_back("    priority [" + std::string(priority == PRIORITY_HIGH ? "high" : "normal") +
+                              "] waiting [" + std::to_string(now - waittingStart.enqueueTime) + "ms] coalesced [" +
+                              std::to_string(waittingStart.coalescedCount) + "]");
+            waittingStart.request.Dump(info);
+        }
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_timeout_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "ability_record.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr int64_t SLOT_MASK = AbilityTimeoutScheduler::SLOT_COUNT - 1;
+// the ticks covered by the whole wheel, later timeouts are placed at the end and placed again on cascading.
+constexpr int64_t WHEEL_SPAN = static_cast<int64_t>(1)
+                               << (AbilityTimeoutScheduler::SLOT_BITS * AbilityTimeoutScheduler::LEVEL_COUNT);
+}  // namespace
+
+AbilityTimeoutScheduler::AbilityTimeoutScheduler(
+    const std::shared_ptr<AppExecFwk::EventHandler> &handler, const TimeoutCallback &callback)
+    : handler_(handler), callback_(callback)
+{}
+
+int64_t AbilityTimeoutScheduler::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t AbilityTimeoutScheduler::Arm(const std::shared_ptr<AbilityRecord> &abilityRecord, uint32_t msgId,
+    uint32_t timeout, const std::function<void()> &task)
+{
+    int64_t now = GetCurrentTime();
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (index_.empty()) {
+        // nothing is pending, the wheel skips the idle ticks at once.
+        currentTick_ = std::max(currentTick_, now / TICK);
+    }
+
+    Slot slot;
+    TimeoutEntry entry;
+    entry.handle = ++nextHandle_;
+    entry.msgId = msgId;
+    entry.expires = std::max((now + timeout + TICK - 1) / TICK, currentTick_ + 1);
+    entry.abilityRecord = abilityRecord;
+    entry.task = task;
+    slot.emplace_back(std::move(entry));
+    uint64_t handle = nextHandle_;
+    PlaceLocked(slot, slot.begin());
+    ScheduleTickLocked();
+    return handle;
+}
+
+bool AbilityTimeoutScheduler::Cancel(uint64_t handle)
+{
+    if (handle == INVALID_HANDLE) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = index_.find(handle);
+    if (iter == index_.end()) {
+        return false;
+    }
+    wheel_[iter->second.level][iter->second.slot].erase(iter->second.iter);
+    index_.erase(iter);
+    return true;
+}
+
+void AbilityTimeoutScheduler::PlaceLocked(Slot &from, Slot::iterator iter)
+{
+    int64_t expires = std::min(iter->expires, currentTick_ + WHEEL_SPAN - 1);
+    int64_t delta = expires - currentTick_;
+    uint32_t level = 0;
+    uint32_t slot = static_cast<uint32_t>(currentTick_ & SLOT_MASK);
+    if (delta > 0) {
+        while (level + 1 < LEVEL_COUNT && delta >= (static_cast<int64_t>(1) << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+        slot = static_cast<uint32_t>((expires >> (SLOT_BITS * level)) & SLOT_MASK);
+    }
+    Slot &target = wheel_[level][slot];
+    target.splice(target.end(), from, iter);
+    Location &location = index_[iter->handle];
+    location.level = level;
+    location.slot = slot;
+    location.iter = iter;
+}
+
+void AbilityTimeoutScheduler::CascadeLocked(uint32_t level)
+{
+    uint32_t slot = static_cast<uint32_t>((currentTick_ >> (SLOT_BITS * level)) & SLOT_MASK);
+    Slot &current = wheel_[level][slot];
+    while (!current.empty()) {
+        PlaceLocked(current, current.begin());
+    }
+    if (slot == 0 && level + 1 < LEVEL_COUNT) {
+        CascadeLocked(level + 1);
+    }
+}
+
+void AbilityTimeoutScheduler::Advance(int64_t now)
+{
+    Slot expired;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        int64_t target = now / TICK;
+        while (currentTick_ < target && !index_.empty()) {
+            currentTick_++;
+            uint32_t slot = static_cast<uint32_t>(currentTick_ & SLOT_MASK);
+            if (slot == 0) {
+                CascadeLocked(1);
+            }
+            Slot &current = wheel_[0][slot];
+            for (auto &entry : current) {
+                index_.erase(entry.handle);
+            }
+            expired.splice(expired.end(), current);
+        }
+        if (index_.empty()) {
+            currentTick_ = std::max(currentTick_, target);
+        }
+    }
+
+    // fire without holding the lock, the timeouts may arm or cancel others.
+    for (auto &entry : expired) {
+        if (entry.task) {
+            entry.task();
+            continue;
+        }
+        auto abilityRecord = entry.abilityRecord.lock();
+        if (abilityRecord != nullptr && callback_) {
+            callback_(entry.msgId, abilityRecord);
+        }
+    }
+}
+
+void AbilityTimeoutScheduler::ScheduleTickLocked()
+{
+    if (tickPosted_ || index_.empty()) {
+        return;
+    }
+    auto handler = handler_.lock();
+    if (handler == nullptr) {
+        return;
+    }
+    std::weak_ptr<AbilityTimeoutScheduler> weak = weak_from_this();
+    auto task = [weak]() {
+        auto scheduler = weak.lock();
+        if (scheduler != nullptr) {
+            scheduler->OnTick();
+        }
+    };
+    tickPosted_ = handler->PostTask(task, TICK);
+    if (!tickPosted_) {
+        HILOG_ERROR("failed to post timeout tick.");
+    }
+}
+
+void AbilityTimeoutScheduler::OnTick()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        tickPosted_ = false;
+    }
+    Advance(GetCurrentTime());
+    std::lock_guard<std::mutex> guard(mutex_);
+    ScheduleTickLocked();
+}
+
+size_t AbilityTimeoutScheduler::GetPendingCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return index_.size();
+}
+
+void AbilityTimeoutScheduler::Dump(std::vector<std::string> &info)
+{
+    int64_t now = GetCurrentTime();
+    std::lock_guard<std::mutex> guard(mutex_);
+    info.emplace_back("PendingTimeouts:");
+    info.emplace_back("  pending #" + std::to_string(index_.size()));
+
+    std::vector<const TimeoutEntry *> entries;
+    entries.reserve(index_.size());
+    for (const auto &item : index_) {
+        entries.emplace_back(&(*item.second.iter));
+    }
+    std::sort(entries.begin(), entries.end(), [](const TimeoutEntry *left, const TimeoutEntry *right) {
+        return left->expires < right->expires;
+    });
+    for (const auto entry : entries) {
+        std::string dumpInfo = "    timeout #" + std::to_string(entry->handle) + "  msg #" +
+                               std::to_string(entry->msgId) + "  remaining #" +
+                               std::to_string(std::max(entry->expires * TICK - now, static_cast<int64_t>(0))) + "ms";
+        auto abilityRecord = entry->abilityRecord.lock();
+        if (abilityRecord != nullptr) {
+            dumpInfo += "  ability: " + abilityRecord->GetAbilityInfo().bundleName + "/" +
+                        abilityRecord->GetAbilityInfo().name;
+        }
+        info.emplace_back(dumpInfo);
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
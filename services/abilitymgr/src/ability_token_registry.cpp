@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability_token_registry.h"
+
+#include <mutex>
+
+#include "hilog_wrapper.h"
+#include "ability_util.h"
+
+namespace OHOS {
+namespace AAFwk {
+AbilityTokenRegistry::AbilityTokenRegistry()
+{}
+
+AbilityTokenRegistry::~AbilityTokenRegistry()
+{}
+
+void AbilityTokenRegistry::Register(const sptr<IRemoteObject> &token, TokenOwner owner)
+{
+    CHECK_POINTER(token);
+    std::unique_lock<std::shared_mutex> lock(registryLock_);
+    tokens_[token.GetRefPtr()] = owner;
+}
+
+void AbilityTokenRegistry::Unregister(const sptr<IRemoteObject> &token)
+{
+    CHECK_POINTER(token);
+    std::unique_lock<std::shared_mutex> lock(registryLock_);
+    tokens_.erase(token.GetRefPtr());
+}
+
+AbilityTokenRegistry::TokenOwner AbilityTokenRegistry::GetOwner(const sptr<IRemoteObject> &token) const
+{
+    CHECK_POINTER_AND_RETURN(token, OWNER_NONE);
+    std::shared_lock<std::shared_mutex> lock(registryLock_);
+    auto iter = tokens_.find(token.GetRefPtr());
+    if (iter == tokens_.end()) {
+        return OWNER_NONE;
+    }
+    return iter->second;
+}
+
+bool AbilityTokenRegistry::IsAlive(const sptr<IRemoteObject> &token) const
+{
+    return GetOwner(token) != OWNER_NONE;
+}
+}  // namespace AAFwk
+}  // namespace OHOS
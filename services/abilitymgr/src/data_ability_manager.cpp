@@ -29,6 +29,14 @@ using namespace std::placeholders;
 namespace {
 constexpr bool DEBUG_ENABLED = false;
 constexpr system_clock::duration DATA_ABILITY_LOAD_TIMEOUT = 11000ms;
+
+void RevokeToken(const std::shared_ptr<DataAbilityRecord> &dataAbilityRecord)
+{
+    auto abilityRecord = dataAbilityRecord->GetAbilityRecord();
+    if (abilityRecord) {
+        abilityRecord->RevokeToken();
+    }
+}
 }  // namespace
 
 DataAbilityManager::DataAbilityManager()
@@ -77,41 +85,73 @@ sptr<IAbilityScheduler> DataAbilityManager::Acquire(
         HILOG_INFO("Loading data ability '%{public}s'...", dataAbilityName.c_str());
     }
 
-    std::lock_guard<std::mutex> locker(mutex_);
+    DataAbilityRecordPtr dataAbilityRecord;
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
 
-    if (DEBUG_ENABLED) {
-        DumpLocked(__func__, __LINE__);
-    }
+        if (DEBUG_ENABLED) {
+            DumpLocked(__func__, __LINE__);
+        }
 
-    DataAbilityRecordPtr dataAbilityRecord;
+        auto it = dataAbilityRecordsLoaded_.find(dataAbilityName);
+        if (it != dataAbilityRecordsLoaded_.end()) {
+            HILOG_DEBUG("Acquiring data ability is existed .");
+            return AcquireLoadedLocked(dataAbilityName, it->second, clientAbilityRecord, tryBind);
+        }
 
-    auto it = dataAbilityRecordsLoaded_.find(dataAbilityName);
-    if (it == dataAbilityRecordsLoaded_.end()) {
         HILOG_DEBUG("Acquiring data ability is not existed, loading...");
         dataAbilityRecord = LoadLocked(dataAbilityName, abilityRequest);
         if (!dataAbilityRecord) {
             HILOG_ERROR("Failed to load data ability '%{public}s'.", dataAbilityName.c_str());
             return nullptr;
         }
-    } else {
-        HILOG_DEBUG("Acquiring data ability is existed .");
-        dataAbilityRecord = it->second;
     }
 
+    // Waiting for data ability loaded without holding the manager lock, acquirers of the same data ability
+    // share the load of one record while others are served concurrently.
+    HILOG_INFO("Waiting for data ability loaded...");
+    int ret = dataAbilityRecord->WaitForLoaded(DATA_ABILITY_LOAD_TIMEOUT);
+
+    std::lock_guard<std::mutex> locker(mutex_);
+
+    if (ret != ERR_OK) {
+        HILOG_ERROR("Wait for data ability failed %{public}d.", ret);
+        auto it = dataAbilityRecordsLoading_.find(dataAbilityName);
+        if (it != dataAbilityRecordsLoading_.end() && it->second == dataAbilityRecord) {
+            dataAbilityRecordsLoading_.erase(it);
+            RevokeToken(dataAbilityRecord);
+        }
+        return nullptr;
+    }
+
+    return AcquireLoadedLocked(dataAbilityName, dataAbilityRecord, clientAbilityRecord, tryBind);
+}
+
+sptr<IAbilityScheduler> DataAbilityManager::AcquireLoadedLocked(const std::string &name,
+    const DataAbilityRecordPtr &dataAbilityRecord, const std::shared_ptr<AbilityRecord> &client, bool tryBind)
+{
     auto scheduler = dataAbilityRecord->GetScheduler();
     if (!scheduler) {
         if (DEBUG_ENABLED) {
-            HILOG_ERROR("BUG: data ability '%{public}s' is not loaded, removing it...", dataAbilityName.c_str());
+            HILOG_ERROR("BUG: data ability '%{public}s' is not loaded, removing it...", name.c_str());
         }
-        auto it = dataAbilityRecordsLoaded_.find(dataAbilityName);
-        if (it != dataAbilityRecordsLoaded_.end()) {
+        auto it = dataAbilityRecordsLoaded_.find(name);
+        if (it != dataAbilityRecordsLoaded_.end() && it->second == dataAbilityRecord) {
             dataAbilityRecordsLoaded_.erase(it);
+            RevokeToken(dataAbilityRecord);
         }
         return nullptr;
     }
 
-    if (clientAbilityRecord) {
-        dataAbilityRecord->AddClient(clientAbilityRecord, tryBind);
+    // The data ability may die while the acquirer is waiting for it.
+    auto it = dataAbilityRecordsLoaded_.find(name);
+    if (it == dataAbilityRecordsLoaded_.end() || it->second != dataAbilityRecord) {
+        HILOG_ERROR("Data ability '%{public}s' is not available.", name.c_str());
+        return nullptr;
+    }
+
+    if (client) {
+        dataAbilityRecord->AddClient(client, tryBind);
     }
 
     if (DEBUG_ENABLED) {
@@ -280,6 +320,7 @@ void DataAbilityManager::OnAbilityDied(const std::shared_ptr<AbilityRecord> &abi
             if (it->second->GetAbilityRecord() == abilityRecord) {
                 it->second->KillBoundClientProcesses();
                 HILOG_DEBUG("Removing died data ability record...");
+                RevokeToken(it->second);
                 dataAbilityRecordsLoaded_.erase(it);
                 break;
             }
@@ -398,19 +439,6 @@ DataAbilityManager::DataAbilityRecordPtr DataAbilityManager::LoadLocked(
         dataAbilityRecord = it->second;
     }
 
-    HILOG_INFO("Waiting for data ability loaded...");
-
-    // Waiting for data ability loaded.
-    int ret = dataAbilityRecord->WaitForLoaded(mutex_, DATA_ABILITY_LOAD_TIMEOUT);
-    if (ret != ERR_OK) {
-        HILOG_ERROR("Wait for data ability failed %{public}d.", ret);
-        it = dataAbilityRecordsLoading_.find(name);
-        if (it != dataAbilityRecordsLoading_.end()) {
-            dataAbilityRecordsLoading_.erase(it);
-        }
-        return nullptr;
-    }
-
     return dataAbilityRecord;
 }
 
@@ -26,6 +26,8 @@ DataAbilityRecord::DataAbilityRecord(const AbilityRequest &req) : request_(req)
 {
     HILOG_DEBUG("%{public}s(%{public}d)", __PRETTY_FUNCTION__, __LINE__);
 
+    loadedFuture_ = loadedPromise_.get_future().share();
+
     if (request_.abilityInfo.type != AppExecFwk::AbilityType::DATA) {
         HILOG_ERROR("BUG: Construct a data ability with wrong ability type.");
     }
@@ -69,26 +71,16 @@ int DataAbilityRecord::StartLoading()
     return ERR_OK;
 }
 
-int DataAbilityRecord::WaitForLoaded(std::mutex &mutex, const std::chrono::system_clock::duration &timeout)
+int DataAbilityRecord::WaitForLoaded(const std::chrono::system_clock::duration &timeout)
 {
     CHECK_POINTER_AND_RETURN(ability_, ERR_INVALID_STATE);
 
-    // Data ability uses 'ACTIVATE' as loaded state.
-    if (ability_->GetAbilityState() == ACTIVE) {
-        return ERR_OK;
-    }
-
-    auto ret = loadedCond_.wait_for(mutex, timeout, [this] { return ability_->GetAbilityState() == ACTIVE; });
-
-    if (!ret) {
+    // The caller must not hold the data ability manager lock, the load result is published by 'OnTransitionDone'.
+    if (loadedFuture_.wait_for(timeout) != std::future_status::ready) {
         return ERR_TIMED_OUT;
     }
 
-    if (!scheduler_ || ability_->GetAbilityState() != ACTIVE) {
-        return ERR_INVALID_STATE;
-    }
-
-    return ERR_OK;
+    return loadedFuture_.get();
 }
 
 sptr<IAbilityScheduler> DataAbilityRecord::GetScheduler()
@@ -162,7 +154,7 @@ int DataAbilityRecord::OnTransitionDone(int state)
     if (state != AbilityLifeCycleState::ABILITY_STATE_ACTIVE) {
         HILOG_ERROR("Data ability on transition done: not ACTIVE.");
         ability_->SetAbilityState(INITIAL);
-        loadedCond_.notify_all();
+        NotifyLoaded(ERR_INVALID_STATE);
         return ERR_INVALID_STATE;
     }
 
@@ -170,7 +162,7 @@ int DataAbilityRecord::OnTransitionDone(int state)
     // Set loaded state, data ability uses 'ACTIVE' as loaded state.
 
     ability_->SetAbilityState(ACTIVE);
-    loadedCond_.notify_all();
+    NotifyLoaded(ERR_OK);
 
     HILOG_INFO("Data ability '%{public}s|%{public}s' is loaded.",
         ability_->GetApplicationInfo().bundleName.c_str(),
@@ -179,6 +171,15 @@ int DataAbilityRecord::OnTransitionDone(int state)
     return ERR_OK;
 }
 
+void DataAbilityRecord::NotifyLoaded(int result)
+{
+    if (loadedNotified_) {
+        return;
+    }
+    loadedNotified_ = true;
+    loadedPromise_.set_value(result);
+}
+
 int DataAbilityRecord::AddClient(const std::shared_ptr<AbilityRecord> &client, bool tryBind)
 {
     HILOG_INFO("Adding data ability client...");
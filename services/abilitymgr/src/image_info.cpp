@@ -55,7 +55,15 @@ bool ImageHeader::Marshalling(Parcel &parcel) const
 
 bool ImageInfo::ReadFromParcel(Parcel &parcel)
 {
-    return false;
+    if (!header.ReadFromParcel(parcel)) {
+        return false;
+    }
+    dataSize = parcel.ReadUint32();
+    data = nullptr;
+    userDataSize = 0;
+    userData = nullptr;
+    pixels = nullptr;
+    return true;
 }
 
 ImageInfo *ImageInfo::Unmarshalling(Parcel &parcel)
@@ -74,7 +82,42 @@ ImageInfo *ImageInfo::Unmarshalling(Parcel &parcel)
 
 bool ImageInfo::Marshalling(Parcel &parcel) const
 {
-    return false;
+    // the image data goes through shared memory, see WritePixels.
+    return header.Marshalling(parcel) && parcel.WriteUint32(dataSize);
+}
+
+bool ImageInfo::WritePixels(MessageParcel &parcel) const
+{
+    if (!parcel.WriteBool(pixels != nullptr)) {
+        return false;
+    }
+    return pixels == nullptr || parcel.WriteAshmem(pixels);
+}
+
+bool ImageInfo::ReadPixels(MessageParcel &parcel)
+{
+    data = nullptr;
+    pixels = nullptr;
+    if (!parcel.ReadBool()) {
+        return true;
+    }
+    sptr<Ashmem> ashmem = parcel.ReadAshmem();
+    if (ashmem == nullptr || ashmem->GetAshmemSize() < static_cast<int32_t>(dataSize)) {
+        HILOG_ERROR("invalid image memory, data size: %{public}u", dataSize);
+        return false;
+    }
+    if (!ashmem->MapReadOnlyAshmem()) {
+        HILOG_ERROR("failed to map image memory");
+        return false;
+    }
+    const void *mapped = ashmem->ReadFromAshmem(static_cast<int32_t>(dataSize), 0);
+    if (mapped == nullptr) {
+        HILOG_ERROR("failed to read image memory");
+        return false;
+    }
+    data = static_cast<uint8_t *>(const_cast<void *>(mapped));
+    pixels = ashmem;
+    return true;
 }
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
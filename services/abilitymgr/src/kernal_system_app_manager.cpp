@@ -33,10 +33,9 @@ int KernalSystemAppManager::StartAbility(const AbilityRequest &abilityRequest)
 {
     HILOG_INFO("start kernal systerm ability.");
     std::lock_guard<std::recursive_mutex> guard(stackLock_);
-    if (!waittingAbilityQueue_.empty()) {
+    if (!waittingAbilityQueue_.IsEmpty()) {
         HILOG_INFO("waiting queue is not empty, so enqueue systerm ui ability for waiting.");
-        EnqueueWaittingAbility(abilityRequest);
-        return START_ABILITY_WAITING;
+        return EnqueueWaittingAbility(abilityRequest);
     }
 
     std::shared_ptr<AbilityRecord> topAbilityRecord = GetCurrentTopAbility();
@@ -49,8 +48,7 @@ int KernalSystemAppManager::StartAbility(const AbilityRequest &abilityRequest)
         }
         if (topAbilityRecord->GetAbilityState() == ACTIVATING) {
             HILOG_INFO("top systerm ui ability is not active, so enqueue ability for waiting.");
-            EnqueueWaittingAbility(abilityRequest);
-            return START_ABILITY_WAITING;
+            return EnqueueWaittingAbility(abilityRequest);
         }
     }
 
@@ -93,7 +91,7 @@ int KernalSystemAppManager::AttachAbilityThread(
     auto handler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
     CHECK_POINTER_AND_RETURN(handler, ERR_INVALID_VALUE);
 
-    handler->RemoveEvent(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
 
     abilityRecord->SetScheduler(scheduler);
     DelayedSingleton<AppScheduler>::GetInstance()->MoveToForground(token);
@@ -147,7 +145,7 @@ int KernalSystemAppManager::DispatchActive(const std::shared_ptr<AbilityRecord>
         HILOG_ERROR("kernal ability transition life state error. start:%{public}d", state);
         return ERR_INVALID_VALUE;
     }
-    handler->RemoveEvent(AbilityManagerService::ACTIVE_TIMEOUT_MSG, abilityRecord->GetEventId());
+    abilityRecord->CancelTimeout();
 
     auto task = [kernalManager = shared_from_this(), abilityRecord]() { kernalManager->CompleteActive(abilityRecord); };
     handler->PostTask(task);
@@ -159,6 +157,7 @@ void KernalSystemAppManager::CompleteActive(const std::shared_ptr<AbilityRecord>
     HILOG_INFO("%{public}s", __func__);
     std::lock_guard<std::recursive_mutex> guard(stackLock_);
     abilityRecord->SetAbilityState(AbilityState::ACTIVE);
+    abilityRecord->CompleteTransition(TRANSITION_ACTIVATE);
 
     auto handler = DelayedSingleton<AbilityManagerService>::GetInstance()->GetEventHandler();
     CHECK_POINTER(handler);
@@ -228,27 +227,13 @@ std::shared_ptr<AbilityRecord> KernalSystemAppManager::GetAbilityRecordByToken(c
     return nullptr;
 }
 
-std::shared_ptr<AbilityRecord> KernalSystemAppManager::GetAbilityRecordByEventId(const int64_t eventId) const
-{
-    auto isExist = [targetEventId = eventId](const std::shared_ptr<AbilityRecord> &ability) {
-        if (ability == nullptr) {
-            return false;
-        }
-        return (ability->GetEventId() == targetEventId);
-    };
-    auto iter = std::find_if(abilities_.begin(), abilities_.end(), isExist);
-    if (iter != abilities_.end()) {
-        return *iter;
-    }
-    return nullptr;
-}
-
 bool KernalSystemAppManager::RemoveAbilityRecord(std::shared_ptr<AbilityRecord> ability)
 {
     CHECK_POINTER_RETURN_BOOL(ability);
     for (auto iter = abilities_.begin(); iter != abilities_.end(); iter++) {
         if ((*iter) == ability) {
             abilities_.erase(iter);
+            ability->RevokeToken();
             return true;
         }
     }
@@ -256,10 +241,9 @@ bool KernalSystemAppManager::RemoveAbilityRecord(std::shared_ptr<AbilityRecord>
     return false;
 }
 
-void KernalSystemAppManager::EnqueueWaittingAbility(const AbilityRequest &abilityRequest)
+int KernalSystemAppManager::EnqueueWaittingAbility(const AbilityRequest &abilityRequest)
 {
-    waittingAbilityQueue_.push(abilityRequest);
-    return;
+    return waittingAbilityQueue_.Enqueue(abilityRequest);
 }
 
 void KernalSystemAppManager::DequeueWaittingAbility()
@@ -270,9 +254,8 @@ void KernalSystemAppManager::DequeueWaittingAbility()
         HILOG_INFO("top ability is not active, must return for waiting again");
         return;
     }
-    if (!waittingAbilityQueue_.empty()) {
-        AbilityRequest abilityRequest = waittingAbilityQueue_.front();
-        waittingAbilityQueue_.pop();
+    AbilityRequest abilityRequest;
+    if (waittingAbilityQueue_.Dequeue(abilityRequest)) {
         HILOG_INFO("%{public}s ,bundleName:%{public}s , abilityName:%{public}s",
             __func__,
             abilityRequest.abilityInfo.bundleName.c_str(),
@@ -318,17 +301,20 @@ void KernalSystemAppManager::OnAbilityDied(std::shared_ptr<AbilityRecord> abilit
     };
     handler->PostTask(timeoutTask, "SystemUi_Die_" + name, AbilityManagerService::RESTART_TIMEOUT);
 }
-void KernalSystemAppManager::OnTimeOut(uint32_t msgId, int64_t eventId)
+void KernalSystemAppManager::OnTimeOut(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord)
 {
+    CHECK_POINTER(abilityRecord);
     std::lock_guard<std::recursive_mutex> guard(stackLock_);
-    if (abilities_.empty()) {
-        HILOG_ERROR("System UI on time out event: ability stack is empty.");
+    // the record may have been removed since the timeout was armed.
+    if (std::find(abilities_.begin(), abilities_.end(), abilityRecord) == abilities_.end()) {
+        HILOG_ERROR("System UI on time out event: ability record is not found.");
         return;
     }
+    OnTimeOutLocked(msgId, abilityRecord);
+}
 
-    auto abilityRecord = GetAbilityRecordByEventId(eventId);
-    CHECK_POINTER(abilityRecord);
-
+void KernalSystemAppManager::OnTimeOutLocked(uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord)
+{
     auto ams = DelayedSingleton<AbilityManagerService>::GetInstance();
     CHECK_POINTER(ams);
 
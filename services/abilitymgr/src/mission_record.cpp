@@ -119,6 +119,9 @@ void MissionRecord::AddAbilityRecordToTop(std::shared_ptr<AbilityRecord> ability
     auto iter = std::find_if(abilities_.begin(), abilities_.end(), isExist);
     if (iter == abilities_.end()) {
         abilities_.push_front(ability);
+        if (auto index = abilityRecordIndex_.lock()) {
+            index->Add(ability, missionId_);
+        }
     }
 }
 
@@ -128,6 +131,9 @@ bool MissionRecord::RemoveAbilityRecord(std::shared_ptr<AbilityRecord> ability)
     for (auto iter = abilities_.begin(); iter != abilities_.end(); iter++) {
         if ((*iter) == ability) {
             abilities_.erase(iter);
+            if (auto index = abilityRecordIndex_.lock()) {
+                index->Remove(ability, missionId_);
+            }
             return true;
         }
     }
@@ -141,12 +147,20 @@ bool MissionRecord::RemoveTopAbilityRecord()
         HILOG_ERROR("abilities is empty");
         return false;
     }
+    if (auto index = abilityRecordIndex_.lock()) {
+        index->Remove(abilities_.front(), missionId_);
+    }
     abilities_.pop_front();
     return true;
 }
 
 void MissionRecord::RemoveAll()
 {
+    if (auto index = abilityRecordIndex_.lock()) {
+        for (auto &ability : abilities_) {
+            index->Remove(ability, missionId_);
+        }
+    }
     abilities_.clear();
 }
 
@@ -171,6 +185,19 @@ bool MissionRecord::IsSameMissionRecord(const std::string &bundleName) const
     return (bundleName == bundleName_);
 }
 
+bool MissionRecord::IsExistBundle(const std::string &bundleName) const
+{
+    if (bundleName.empty()) {
+        return false;
+    }
+    for (const auto &ability : abilities_) {
+        if (ability != nullptr && ability->GetAbilityInfo().bundleName == bundleName) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MissionRecord::GetAllAbilityInfo(std::vector<AbilityRecordInfo> &abilityInfos)
 {
     for (auto ability : abilities_) {
@@ -233,5 +260,22 @@ std::shared_ptr<MissionStack> MissionRecord::GetParentStack() const
 {
     return parentMissionStack_.lock();
 }
+
+void MissionRecord::SetAbilityRecordIndex(const std::shared_ptr<AbilityRecordIndex> &index)
+{
+    auto oldIndex = abilityRecordIndex_.lock();
+    if (oldIndex == index) {
+        return;
+    }
+    for (auto &ability : abilities_) {
+        if (oldIndex) {
+            oldIndex->Remove(ability, missionId_);
+        }
+        if (index) {
+            index->Add(ability, missionId_);
+        }
+    }
+    abilityRecordIndex_ = index;
+}
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mission_snapshot_cache.h"
+
+#include <algorithm>
+#include <sys/mman.h>
+
+#include "ability_manager_errors.h"
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t MAX_BYTES_PER_PIXEL = 4;
+const std::string SNAPSHOT_ASHMEM_NAME = "mission_snapshot_";
+}  // namespace
+
+MissionSnapshotCache::MissionSnapshotCache(size_t memoryBudget, uint16_t maxEdge)
+    : memoryBudget_(memoryBudget), maxEdge_(maxEdge)
+{}
+
+bool MissionSnapshotCache::Downscale(
+    const ImageInfo &image, uint16_t maxEdge, ImageHeader &header, std::vector<uint8_t> &pixels)
+{
+    uint32_t width = image.header.width;
+    uint32_t height = image.header.height;
+    uint32_t pixelCount = width * height;
+    if (image.data == nullptr || pixelCount == 0 || maxEdge == 0 || image.dataSize % pixelCount != 0) {
+        HILOG_ERROR("snapshot data does not match its size %{public}u x %{public}u", width, height);
+        return false;
+    }
+    uint32_t bytesPerPixel = image.dataSize / pixelCount;
+    if (bytesPerPixel == 0 || bytesPerPixel > MAX_BYTES_PER_PIXEL) {
+        HILOG_ERROR("unsupported snapshot pixel size: %{public}u", bytesPerPixel);
+        return false;
+    }
+
+    header = image.header;
+    uint32_t longestEdge = std::max(width, height);
+    uint32_t factor = (longestEdge + maxEdge - 1) / maxEdge;
+    if (factor <= 1) {
+        pixels.assign(image.data, image.data + image.dataSize);
+        return true;
+    }
+
+    // the pixels beyond the last whole block are dropped.
+    uint32_t scaledWidth = std::max(width / factor, static_cast<uint32_t>(1));
+    uint32_t scaledHeight = std::max(height / factor, static_cast<uint32_t>(1));
+    uint32_t blockWidth = std::min(factor, width);
+    uint32_t blockHeight = std::min(factor, height);
+    uint32_t blockSize = blockWidth * blockHeight;
+    uint32_t stride = width * bytesPerPixel;
+    pixels.resize(scaledWidth * scaledHeight * bytesPerPixel);
+    uint32_t sums[MAX_BYTES_PER_PIXEL];
+    for (uint32_t y = 0; y < scaledHeight; y++) {
+        for (uint32_t x = 0; x < scaledWidth; x++) {
+            std::fill(std::begin(sums), std::end(sums), 0);
+            for (uint32_t row = 0; row < blockHeight; row++) {
+                const uint8_t *source = image.data + (y * factor + row) * stride + x * factor * bytesPerPixel;
+                for (uint32_t column = 0; column < blockWidth * bytesPerPixel; column++) {
+                    sums[column % bytesPerPixel] += source[column];
+                }
+            }
+            uint8_t *target = pixels.data() + (y * scaledWidth + x) * bytesPerPixel;
+            for (uint32_t channel = 0; channel < bytesPerPixel; channel++) {
+                target[channel] = static_cast<uint8_t>((sums[channel] + blockSize / 2) / blockSize);
+            }
+        }
+    }
+    header.width = static_cast<uint16_t>(scaledWidth);
+    header.height = static_cast<uint16_t>(scaledHeight);
+    return true;
+}
+
+int MissionSnapshotCache::Put(int32_t missionId, const ImageInfo &image)
+{
+    SnapshotEntry entry;
+    std::vector<uint8_t> pixels;
+    if (!Downscale(image, maxEdge_, entry.header, pixels)) {
+        return ERR_INVALID_VALUE;
+    }
+    if (pixels.size() > memoryBudget_) {
+        HILOG_ERROR("snapshot of mission %{public}d is larger than the budget", missionId);
+        return ERR_INVALID_VALUE;
+    }
+
+    std::string name = SNAPSHOT_ASHMEM_NAME + std::to_string(missionId);
+    entry.pixels = Ashmem::CreateAshmem(name.c_str(), static_cast<int32_t>(pixels.size()));
+    if (entry.pixels == nullptr || !entry.pixels->MapReadAndWriteAshmem()) {
+        HILOG_ERROR("failed to create the snapshot memory of mission %{public}d", missionId);
+        return ERR_NO_MEMORY;
+    }
+    bool written = entry.pixels->WriteToAshmem(pixels.data(), static_cast<int32_t>(pixels.size()), 0);
+    // the snapshot is never written again, the receivers may only map it for reading.
+    entry.pixels->UnmapAshmem();
+    if (!written || !entry.pixels->SetProtection(PROT_READ)) {
+        HILOG_ERROR("failed to write the snapshot memory of mission %{public}d", missionId);
+        return ERR_NO_MEMORY;
+    }
+    entry.missionId = missionId;
+    entry.dataSize = static_cast<uint32_t>(pixels.size());
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = index_.find(missionId);
+    if (iter != index_.end()) {
+        memoryUsage_ -= iter->second->dataSize;
+        entries_.erase(iter->second);
+        index_.erase(iter);
+    }
+    memoryUsage_ += entry.dataSize;
+    entries_.emplace_front(std::move(entry));
+    index_[missionId] = entries_.begin();
+    EvictLocked();
+    return ERR_OK;
+}
+
+bool MissionSnapshotCache::Get(int32_t missionId, ImageInfo &image)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = index_.find(missionId);
+    if (iter == index_.end()) {
+        missCount_++;
+        return false;
+    }
+    hitCount_++;
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    const SnapshotEntry &entry = *iter->second;
+    image.header = entry.header;
+    image.dataSize = entry.dataSize;
+    image.data = nullptr;
+    image.userDataSize = 0;
+    image.userData = nullptr;
+    image.pixels = entry.pixels;
+    return true;
+}
+
+void MissionSnapshotCache::Remove(int32_t missionId)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = index_.find(missionId);
+    if (iter == index_.end()) {
+        return;
+    }
+    memoryUsage_ -= iter->second->dataSize;
+    entries_.erase(iter->second);
+    index_.erase(iter);
+}
+
+void MissionSnapshotCache::RemoveIf(const std::function<bool(int32_t)> &predicate)
+{
+    std::vector<int32_t> missionIds;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        missionIds.reserve(entries_.size());
+        for (const auto &entry : entries_) {
+            missionIds.emplace_back(entry.missionId);
+        }
+    }
+    for (auto missionId : missionIds) {
+        if (predicate(missionId)) {
+            Remove(missionId);
+        }
+    }
+}
+
+void MissionSnapshotCache::Clear()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    entries_.clear();
+    index_.clear();
+    memoryUsage_ = 0;
+}
+
+void MissionSnapshotCache::EvictLocked()
+{
+    while (memoryUsage_ > memoryBudget_ && !entries_.empty()) {
+        const SnapshotEntry &entry = entries_.back();
+        HILOG_INFO("evict the snapshot of mission %{public}d", entry.missionId);
+        memoryUsage_ -= entry.dataSize;
+        index_.erase(entry.missionId);
+        entries_.pop_back();
+        evictionCount_++;
+    }
+}
+
+size_t MissionSnapshotCache::GetSize()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return entries_.size();
+}
+
+size_t MissionSnapshotCache::GetMemoryUsage()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return memoryUsage_;
+}
+
+void MissionSnapshotCache::Dump(std::vector<std::string> &info)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    info.emplace_back("MissionSnapshots:");
+    info.emplace_back("  size #" + std::to_string(entries_.size()) + "  memory #" + std::to_string(memoryUsage_) +
+                      "  budget #" + std::to_string(memoryBudget_));
+    info.emplace_back("  hit #" + std::to_string(hitCount_) + "  miss #" + std::to_string(missCount_) +
+                      "  eviction #" + std::to_string(evictionCount_));
+    for (const auto &entry : entries_) {
+        info.emplace_back("    mission #" + std::to_string(entry.missionId) + "  " +
+                          std::to_string(entry.header.width) + "x" + std::to_string(entry.header.height) +
+                          "  size #" + std::to_string(entry.dataSize));
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -47,8 +47,7 @@ MissionSnapshotInfo *MissionSnapshotInfo::Unmarshalling(Parcel &parcel)
 
 bool MissionSnapshotInfo::Marshalling(Parcel &parcel) const
 {
-    parcel.WriteParcelable(&snapshot);
-    return true;
+    return parcel.WriteParcelable(&snapshot);
 }
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -19,7 +19,8 @@
 
 namespace OHOS {
 namespace AAFwk {
-MissionStack::MissionStack(int id, int userId) : missionStackId_(id), userId_(userId)
+MissionStack::MissionStack(int id, int userId)
+    : missionStackId_(id), userId_(userId), abilityRecordIndex_(std::make_shared<AbilityRecordIndex>())
 {}
 
 MissionStack::~MissionStack()
@@ -80,15 +81,9 @@ std::shared_ptr<AbilityRecord> MissionStack::GetTopAbilityRecord() const
 
 std::shared_ptr<AbilityRecord> MissionStack::GetAbilityRecordById(const int64_t recordId)
 {
-    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
-    for (std::shared_ptr<MissionRecord> mission : missions_) {
-        abilityRecord = mission->GetAbilityRecordById(recordId);
-        if (abilityRecord != nullptr) {
-            return abilityRecord;
-        }
-    }
-    return nullptr;
+    return abilityRecordIndex_->GetAbilityRecordById(recordId);
 }
+
 std::shared_ptr<MissionRecord> MissionStack::GetTopMissionRecord()
 {
     if (missions_.empty()) {
@@ -123,14 +118,7 @@ std::shared_ptr<MissionRecord> MissionStack::GetMissionRecordById(int id)
 
 std::shared_ptr<AbilityRecord> MissionStack::GetAbilityRecordByToken(const sptr<IRemoteObject> &token)
 {
-    std::shared_ptr<AbilityRecord> abilityRecord = nullptr;
-    for (std::shared_ptr<MissionRecord> mission : missions_) {
-        abilityRecord = mission->GetAbilityRecordByToken(token);
-        if (abilityRecord != nullptr) {
-            return abilityRecord;
-        }
-    }
-    return nullptr;
+    return abilityRecordIndex_->GetAbilityRecordByToken(token);
 }
 
 std::shared_ptr<AbilityRecord> MissionStack::GetAbilityRecordByCaller(
@@ -164,6 +152,7 @@ bool MissionStack::RemoveMissionRecord(int id)
     }
     for (auto iter = missions_.begin(); iter != missions_.end(); iter++) {
         if ((*iter)->GetMissionRecordId() == id) {
+            (*iter)->SetAbilityRecordIndex(nullptr);
             missions_.erase(iter);
             return true;
         }
@@ -173,7 +162,11 @@ bool MissionStack::RemoveMissionRecord(int id)
 
 void MissionStack::RemoveAll()
 {
+    for (auto &mission : missions_) {
+        mission->SetAbilityRecordIndex(nullptr);
+    }
     missions_.clear();
+    abilityRecordIndex_->Clear();
 }
 
 void MissionStack::AddMissionRecordToTop(std::shared_ptr<MissionRecord> mission)
@@ -188,6 +181,7 @@ void MissionStack::AddMissionRecordToTop(std::shared_ptr<MissionRecord> mission)
     auto iter = std::find_if(missions_.begin(), missions_.end(), isExist);
     if (iter == missions_.end()) {
         missions_.push_front(mission);
+        mission->SetAbilityRecordIndex(abilityRecordIndex_);
     }
 }
 
@@ -205,6 +199,7 @@ void MissionStack::MoveMissionRecordToTop(std::shared_ptr<MissionRecord> mission
         }
     }
     missions_.emplace_front(mission);
+    mission->SetAbilityRecordIndex(abilityRecordIndex_);
 }
 
 void MissionStack::MoveMissionRecordToBottom(const std::shared_ptr<MissionRecord> &mission)
@@ -221,6 +216,7 @@ void MissionStack::MoveMissionRecordToBottom(const std::shared_ptr<MissionRecord
         }
     }
     missions_.emplace_back(mission);
+    mission->SetAbilityRecordIndex(abilityRecordIndex_);
 }
 
 void MissionStack::Dump(std::vector<std::string> &info)
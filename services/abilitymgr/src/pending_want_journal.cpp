@@ -0,0 +1,687 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pending_want_journal.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog_wrapper.h"
+#include "parcel.h"
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+// file:   magic, version, next code, generation
+// record: payload size, checksum of payload, payload
+// put:    type, code, uid, caller uid, generation, key hash, key
+// remove: type, code
+constexpr uint32_t JOURNAL_MAGIC = 0x314A5750;  // "PWJ1"
+constexpr size_t FILE_HEADER_SIZE = 16;
+constexpr size_t FILE_GENERATION_OFFSET = 12;
+constexpr size_t RECORD_HEADER_SIZE = 8;
+constexpr size_t PUT_GENERATION_OFFSET = 13;
+constexpr size_t PUT_KEY_HASH_OFFSET = 17;
+constexpr size_t PUT_FIXED_SIZE = 25;
+constexpr size_t REMOVE_SIZE = 5;
+constexpr uint8_t RECORD_PUT = 1;
+constexpr uint8_t RECORD_REMOVE = 2;
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr uint32_t FNV_PRIME = 16777619u;
+constexpr uint64_t FNV64_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV64_PRIME = 1099511628211ull;
+constexpr mode_t JOURNAL_FILE_MODE = 0600;
+constexpr mode_t JOURNAL_DIR_MODE = 0711;
+
+uint32_t Checksum(const uint8_t *data, size_t size)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+template<typename T>
+uint64_t HashValue(uint64_t hash, T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    for (size_t i = 0; i < sizeof(T); i++) {
+        hash = (hash ^ bytes[i]) * FNV64_PRIME;
+    }
+    return hash;
+}
+
+uint64_t HashString(uint64_t hash, const std::string &value)
+{
+    // the length keeps adjacent strings apart.
+    hash = HashValue<uint32_t>(hash, static_cast<uint32_t>(value.size()));
+    for (char c : value) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * FNV64_PRIME;
+    }
+    return hash;
+}
+
+template<typename T>
+void Append(std::vector<uint8_t> &buffer, T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template<typename T>
+T Read(const uint8_t *data)
+{
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+bool WriteAll(int fd, const uint8_t *data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        ssize_t written = pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+
+bool ReadAll(int fd, uint8_t *data, size_t size, uint64_t offset)
+{
+    while (size > 0) {
+        ssize_t read = pread(fd, data, size, static_cast<off_t>(offset));
+        if (read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (read <= 0) {
+            return false;
+        }
+        data += read;
+        size -= static_cast<size_t>(read);
+        offset += static_cast<uint64_t>(read);
+    }
+    return true;
+}
+
+std::vector<uint8_t> MakeFileHeader(int32_t nextCode, uint32_t generation)
+{
+    std::vector<uint8_t> header;
+    Append<uint32_t>(header, JOURNAL_MAGIC);
+    Append<uint32_t>(header, PendingWantJournal::FORMAT_VERSION);
+    Append<int32_t>(header, nextCode);
+    Append<uint32_t>(header, generation);
+    return header;
+}
+
+void SealRecord(std::vector<uint8_t> &record)
+{
+    uint32_t payloadSize = static_cast<uint32_t>(record.size() - RECORD_HEADER_SIZE);
+    uint32_t checksum = Checksum(record.data() + RECORD_HEADER_SIZE, payloadSize);
+    memcpy(record.data(), &payloadSize, sizeof(payloadSize));
+    memcpy(record.data() + sizeof(payloadSize), &checksum, sizeof(checksum));
+}
+
+std::vector<uint8_t> MakeRemoveRecord(int32_t code)
+{
+    std::vector<uint8_t> record(RECORD_HEADER_SIZE);
+    Append<uint8_t>(record, RECORD_REMOVE);
+    Append<int32_t>(record, code);
+    SealRecord(record);
+    return record;
+}
+
+bool EncodeKey(const std::shared_ptr<PendingWantKey> &key, Parcel &parcel)
+{
+    if (!parcel.WriteInt32(key->GetType()) || !parcel.WriteInt32(key->GetRequestCode()) ||
+        !parcel.WriteInt32(key->GetFlags()) || !parcel.WriteInt32(key->GetUserId()) ||
+        !parcel.WriteString(key->GetBundleName()) || !parcel.WriteString(key->GetRequestWho()) ||
+        !parcel.WriteString(key->GetRequestResolvedType()) || !parcel.WriteParcelable(&key->GetRequestWant())) {
+        return false;
+    }
+    const std::vector<WantsInfo> &allWantsInfos = key->GetAllWantsInfos();
+    if (!parcel.WriteUint32(static_cast<uint32_t>(allWantsInfos.size()))) {
+        return false;
+    }
+    for (const auto &wantsInfo : allWantsInfos) {
+        if (!parcel.WriteParcelable(&wantsInfo)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<PendingWantKey> DecodeKey(Parcel &parcel)
+{
+    auto key = std::make_shared<PendingWantKey>();
+    key->SetType(parcel.ReadInt32());
+    key->SetRequestCode(parcel.ReadInt32());
+    key->SetFlags(parcel.ReadInt32());
+    key->SetUserId(parcel.ReadInt32());
+    key->SetBundleName(parcel.ReadString());
+    key->SetRequestWho(parcel.ReadString());
+    key->SetRequestResolvedType(parcel.ReadString());
+    std::unique_ptr<Want> requestWant(parcel.ReadParcelable<Want>());
+    if (requestWant == nullptr) {
+        return nullptr;
+    }
+    key->SetRequestWant(*requestWant);
+    uint32_t count = parcel.ReadUint32();
+    std::vector<WantsInfo> allWantsInfos;
+    for (uint32_t i = 0; i < count; i++) {
+        std::unique_ptr<WantsInfo> wantsInfo(parcel.ReadParcelable<WantsInfo>());
+        if (wantsInfo == nullptr) {
+            return nullptr;
+        }
+        allWantsInfos.emplace_back(*wantsInfo);
+    }
+    key->SetAllWantsInfos(allWantsInfos);
+    return key;
+}
+}  // namespace
+
+PendingWantJournal::PendingWantJournal(const std::string &path) : path_(path)
+{}
+
+PendingWantJournal::~PendingWantJournal()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    CloseLocked();
+}
+
+bool PendingWantJournal::Load()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    CloseLocked();
+    records_.clear();
+    restorableIndex_.clear();
+    restorableCount_ = 0;
+    deadCount_ = 0;
+    if (!LoadLocked()) {
+        CloseLocked();
+        return false;
+    }
+    HILOG_INFO("pending want journal loaded, records: %{public}zu, dead: %{public}zu, next code: %{public}d",
+        records_.size(), deadCount_, nextCode_);
+    if (deadCount_ >= COMPACT_MIN_DEAD_COUNT && deadCount_ > records_.size()) {
+        CompactLocked();
+    }
+    return true;
+}
+
+bool PendingWantJournal::LoadLocked()
+{
+    size_t slash = path_.rfind('/');
+    if (slash != std::string::npos && slash > 0) {
+        std::string dir = path_.substr(0, slash);
+        if (mkdir(dir.c_str(), JOURNAL_DIR_MODE) != 0 && errno != EEXIST) {
+            HILOG_ERROR("failed to create the journal directory, errno: %{public}d", errno);
+            return false;
+        }
+    }
+    fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, JOURNAL_FILE_MODE);
+    if (fd_ < 0) {
+        HILOG_ERROR("failed to open the pending want journal, errno: %{public}d", errno);
+        return false;
+    }
+    struct stat fileStat;
+    if (fstat(fd_, &fileStat) != 0) {
+        HILOG_ERROR("failed to stat the pending want journal, errno: %{public}d", errno);
+        return false;
+    }
+    fileSize_ = static_cast<uint64_t>(fileStat.st_size);
+    if (fileSize_ >= FILE_HEADER_SIZE && MapLocked() && ReadLocked(mapping_, mappingSize_)) {
+        if (!WriteAll(fd_, reinterpret_cast<const uint8_t *>(&generation_), sizeof(generation_),
+            FILE_GENERATION_OFFSET)) {
+            HILOG_ERROR("failed to write the journal generation, errno: %{public}d", errno);
+        }
+        return true;
+    }
+
+    // a missing or unknown journal starts empty.
+    UnmapLocked();
+    records_.clear();
+    restorableIndex_.clear();
+    restorableCount_ = 0;
+    deadCount_ = 0;
+    std::vector<uint8_t> header = MakeFileHeader(nextCode_, generation_);
+    if (ftruncate(fd_, 0) != 0 || !WriteAll(fd_, header.data(), header.size(), 0)) {
+        HILOG_ERROR("failed to reset the pending want journal, errno: %{public}d", errno);
+        return false;
+    }
+    fileSize_ = header.size();
+    return true;
+}
+
+bool PendingWantJournal::ReadLocked(const uint8_t *data, size_t size)
+{
+    if (Read<uint32_t>(data) != JOURNAL_MAGIC || Read<uint32_t>(data + sizeof(uint32_t)) != FORMAT_VERSION) {
+        HILOG_WARN("drop the pending want journal of unknown format");
+        return false;
+    }
+    nextCode_ = std::max(nextCode_, Read<int32_t>(data + sizeof(uint32_t) * 2));
+    generation_ = Read<uint32_t>(data + FILE_GENERATION_OFFSET) + 1;
+
+    size_t offset = FILE_HEADER_SIZE;
+    while (offset + RECORD_HEADER_SIZE <= size) {
+        uint32_t payloadSize = Read<uint32_t>(data + offset);
+        const uint8_t *payload = data + offset + RECORD_HEADER_SIZE;
+        if (payloadSize < REMOVE_SIZE || payloadSize > size - offset - RECORD_HEADER_SIZE ||
+            Read<uint32_t>(data + offset + sizeof(uint32_t)) != Checksum(payload, payloadSize)) {
+            break;
+        }
+        int32_t code = Read<int32_t>(payload + 1);
+        auto iter = records_.find(code);
+        if (payload[0] == RECORD_PUT && payloadSize >= PUT_FIXED_SIZE) {
+            deadCount_ += (iter != records_.end()) ? 1 : 0;
+            Location &location = records_[code];
+            location.offset = offset;
+            location.size = static_cast<uint32_t>(RECORD_HEADER_SIZE + payloadSize);
+            location.keyHash = Read<uint64_t>(payload + PUT_KEY_HASH_OFFSET);
+            location.generation = Read<uint32_t>(payload + PUT_GENERATION_OFFSET);
+            location.restorable = true;
+            nextCode_ = std::max(nextCode_, code + 1);
+        } else if (payload[0] == RECORD_REMOVE) {
+            deadCount_ += (iter != records_.end()) ? 2 : 1;
+            if (iter != records_.end()) {
+                records_.erase(iter);
+            }
+        } else {
+            break;
+        }
+        offset += RECORD_HEADER_SIZE + payloadSize;
+    }
+    if (offset < size) {
+        HILOG_WARN("drop the torn tail of the pending want journal, %{public}zu bytes", size - offset);
+        if (ftruncate(fd_, static_cast<off_t>(offset)) != 0) {
+            HILOG_ERROR("failed to truncate the pending want journal, errno: %{public}d", errno);
+        }
+        fileSize_ = offset;
+    }
+
+    // a record nobody asked for in the last generations belongs to a bundle which is gone or does not use it.
+    size_t expiredCount = 0;
+    for (auto iter = records_.begin(); iter != records_.end();) {
+        if (iter->second.generation + RECORD_EXPIRE_GENERATIONS < generation_) {
+            iter = records_.erase(iter);
+            expiredCount++;
+        } else {
+            ++iter;
+        }
+    }
+    if (expiredCount > 0) {
+        HILOG_INFO("drop %{public}zu expired pending want records", expiredCount);
+        deadCount_ += expiredCount;
+    }
+
+    for (const auto &record : records_) {
+        restorableIndex_.emplace(record.second.keyHash, record.first);
+    }
+    restorableCount_ = records_.size();
+    return true;
+}
+
+uint64_t PendingWantJournal::GetKeyHash(const std::shared_ptr<PendingWantKey> &key)
+{
+    // the entities and the uri are left out, the collisions are told apart by PendingWantKey::IsEqual.
+    auto element = key->GetRequestWant().GetElement();
+    uint64_t hash = FNV64_OFFSET_BASIS;
+    hash = HashValue<int32_t>(hash, key->GetType());
+    hash = HashValue<int32_t>(hash, key->GetRequestCode());
+    hash = HashValue<int32_t>(hash, key->GetFlags());
+    hash = HashValue<int32_t>(hash, key->GetUserId());
+    hash = HashString(hash, key->GetBundleName());
+    hash = HashString(hash, key->GetRequestWho());
+    hash = HashString(hash, key->GetRequestResolvedType());
+    hash = HashString(hash, element.GetDeviceID());
+    hash = HashString(hash, element.GetBundleName());
+    hash = HashString(hash, element.GetAbilityName());
+    hash = HashString(hash, key->GetRequestWant().GetAction());
+    return hash;
+}
+
+int32_t PendingWantJournal::AllocateCode()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return nextCode_++;
+}
+
+bool PendingWantJournal::Put(int32_t uid, int32_t callerUid, const std::shared_ptr<PendingWantKey> &key)
+{
+    if (key == nullptr) {
+        return false;
+    }
+    Parcel parcel;
+    if (!EncodeKey(key, parcel)) {
+        HILOG_ERROR("failed to encode the pending want %{public}d", key->GetCode());
+        return false;
+    }
+    uint64_t keyHash = GetKeyHash(key);
+    std::vector<uint8_t> record(RECORD_HEADER_SIZE);
+    record.reserve(RECORD_HEADER_SIZE + PUT_FIXED_SIZE + parcel.GetDataSize());
+    Append<uint8_t>(record, RECORD_PUT);
+    Append<int32_t>(record, key->GetCode());
+    Append<int32_t>(record, uid);
+    Append<int32_t>(record, callerUid);
+    std::lock_guard<std::mutex> guard(mutex_);
+    Append<uint32_t>(record, generation_);
+    Append<uint64_t>(record, keyHash);
+    const uint8_t *keyData = reinterpret_cast<const uint8_t *>(parcel.GetData());
+    record.insert(record.end(), keyData, keyData + parcel.GetDataSize());
+    SealRecord(record);
+    return AppendLocked(record, keyHash, key->GetCode(), true);
+}
+
+bool PendingWantJournal::Remove(int32_t code)
+{
+    std::vector<uint8_t> record = MakeRemoveRecord(code);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (records_.find(code) == records_.end()) {
+        return true;
+    }
+    return AppendLocked(record, 0, code, false);
+}
+
+bool PendingWantJournal::PurgeBundle(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    std::vector<int32_t> codes;
+    for (const auto &record : records_) {
+        if (!record.second.restorable) {
+            continue;
+        }
+        // a record which can not be decoded is never restored either.
+        JournalRecord decoded;
+        if (!DecodeLocked(record.second, decoded) || decoded.key->GetBundleName() == bundleName) {
+            codes.emplace_back(record.first);
+        }
+    }
+    bool result = true;
+    for (int32_t code : codes) {
+        result = AppendLocked(MakeRemoveRecord(code), 0, code, false) && result;
+    }
+    if (!codes.empty()) {
+        HILOG_INFO("purge %{public}zu pending want records of %{public}s", codes.size(), bundleName.c_str());
+    }
+    return result;
+}
+
+bool PendingWantJournal::AppendLocked(const std::vector<uint8_t> &record, uint64_t keyHash, int32_t code, bool put)
+{
+    if (fd_ < 0) {
+        return false;
+    }
+    if (!WriteAll(fd_, record.data(), record.size(), fileSize_)) {
+        HILOG_ERROR("failed to append to the pending want journal, errno: %{public}d", errno);
+        // a partly written record would be dropped as a torn tail by the next load anyway.
+        if (ftruncate(fd_, static_cast<off_t>(fileSize_)) != 0) {
+            HILOG_ERROR("failed to truncate the pending want journal, errno: %{public}d", errno);
+        }
+        return false;
+    }
+    uint64_t offset = fileSize_;
+    fileSize_ += record.size();
+
+    auto iter = records_.find(code);
+    if (iter != records_.end()) {
+        DropRestorableLocked(code, iter->second);
+        deadCount_++;
+    }
+    if (put) {
+        Location &location = records_[code];
+        location.offset = offset;
+        location.size = static_cast<uint32_t>(record.size());
+        location.keyHash = keyHash;
+        location.generation = generation_;
+        location.restorable = false;
+    } else {
+        records_.erase(code);
+        deadCount_++;
+    }
+    if (deadCount_ >= COMPACT_MIN_DEAD_COUNT && deadCount_ > records_.size()) {
+        CompactLocked();
+    }
+    return true;
+}
+
+bool PendingWantJournal::Restore(const std::shared_ptr<PendingWantKey> &key, JournalRecord &record)
+{
+    if (key == nullptr) {
+        return false;
+    }
+    uint64_t keyHash = GetKeyHash(key);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto range = restorableIndex_.equal_range(keyHash);
+    std::vector<int32_t> candidates;
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        candidates.emplace_back(iter->second);
+    }
+    for (int32_t code : candidates) {
+        Location &location = records_[code];
+        JournalRecord candidate;
+        bool decoded = DecodeLocked(location, candidate);
+        bool matched = decoded && key->IsEqual(candidate.key);
+        if (!decoded || matched) {
+            DropRestorableLocked(code, location);
+        }
+        if (matched) {
+            RefreshLocked(code, location);
+            record = std::move(candidate);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PendingWantJournal::Restore(int32_t code, JournalRecord &record)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = records_.find(code);
+    if (iter == records_.end() || !iter->second.restorable) {
+        return false;
+    }
+    bool decoded = DecodeLocked(iter->second, record);
+    DropRestorableLocked(code, iter->second);
+    if (decoded) {
+        RefreshLocked(code, iter->second);
+    }
+    return decoded;
+}
+
+bool PendingWantJournal::DecodeLocked(const Location &location, JournalRecord &record)
+{
+    if (mapping_ == nullptr || location.offset + location.size > mappingSize_) {
+        return false;
+    }
+    const uint8_t *payload = mapping_ + location.offset + RECORD_HEADER_SIZE;
+    int32_t code = Read<int32_t>(payload + sizeof(uint8_t));
+    record.uid = Read<int32_t>(payload + sizeof(uint8_t) + sizeof(int32_t));
+    record.callerUid = Read<int32_t>(payload + sizeof(uint8_t) + sizeof(int32_t) * 2);
+
+    Parcel parcel;
+    size_t keySize = location.size - RECORD_HEADER_SIZE - PUT_FIXED_SIZE;
+    if (!parcel.WriteBuffer(payload + PUT_FIXED_SIZE, keySize)) {
+        return false;
+    }
+    record.key = DecodeKey(parcel);
+    if (record.key == nullptr) {
+        HILOG_ERROR("failed to decode the pending want %{public}d", code);
+        return false;
+    }
+    record.key->SetCode(code);
+    return true;
+}
+
+void PendingWantJournal::DropRestorableLocked(int32_t code, const Location &location)
+{
+    if (!location.restorable) {
+        return;
+    }
+    auto range = restorableIndex_.equal_range(location.keyHash);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == code) {
+            restorableIndex_.erase(iter);
+            break;
+        }
+    }
+    records_[code].restorable = false;
+    restorableCount_--;
+}
+
+void PendingWantJournal::RefreshLocked(int32_t code, Location location)
+{
+    // write the restored record again in this generation, so it does not expire while it is in use.
+    if (location.generation == generation_ || mapping_ == nullptr ||
+        location.offset + location.size > mappingSize_) {
+        return;
+    }
+    std::vector<uint8_t> record(mapping_ + location.offset, mapping_ + location.offset + location.size);
+    memcpy(record.data() + RECORD_HEADER_SIZE + PUT_GENERATION_OFFSET, &generation_, sizeof(generation_));
+    SealRecord(record);
+    AppendLocked(record, location.keyHash, code, true);
+}
+
+size_t PendingWantJournal::GetLiveCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return records_.size();
+}
+
+size_t PendingWantJournal::GetRestorableCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return restorableCount_;
+}
+
+size_t PendingWantJournal::GetDeadCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return deadCount_;
+}
+
+bool PendingWantJournal::Compact()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return CompactLocked();
+}
+
+bool PendingWantJournal::CompactLocked()
+{
+    if (fd_ < 0) {
+        return false;
+    }
+    std::string tempPath = path_ + ".tmp";
+    int tempFd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, JOURNAL_FILE_MODE);
+    if (tempFd < 0) {
+        HILOG_ERROR("failed to create the compacted journal, errno: %{public}d", errno);
+        return false;
+    }
+
+    // keep the order of the records, so that a later put still wins if the file is read again.
+    std::vector<std::pair<uint64_t, int32_t>> order;
+    order.reserve(records_.size());
+    for (const auto &record : records_) {
+        order.emplace_back(record.second.offset, record.first);
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<uint8_t> buffer = MakeFileHeader(nextCode_, generation_);
+    bool written = WriteAll(tempFd, buffer.data(), buffer.size(), 0);
+    uint64_t offset = buffer.size();
+    std::unordered_map<int32_t, uint64_t> offsets;
+    for (auto iter = order.begin(); written && iter != order.end(); ++iter) {
+        const Location &location = records_[iter->second];
+        buffer.resize(location.size);
+        written = ReadAll(fd_, buffer.data(), buffer.size(), location.offset) &&
+                  WriteAll(tempFd, buffer.data(), buffer.size(), offset);
+        offsets[iter->second] = offset;
+        offset += location.size;
+    }
+    written = written && fsync(tempFd) == 0;
+    close(tempFd);
+    if (!written || rename(tempPath.c_str(), path_.c_str()) != 0) {
+        HILOG_ERROR("failed to compact the pending want journal, errno: %{public}d", errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+
+    HILOG_INFO("pending want journal compacted, records: %{public}zu, dropped: %{public}zu",
+        records_.size(), deadCount_);
+    UnmapLocked();
+    close(fd_);
+    fd_ = open(path_.c_str(), O_RDWR | O_CLOEXEC);
+    fileSize_ = offset;
+    deadCount_ = 0;
+    for (auto &record : records_) {
+        record.second.offset = offsets[record.first];
+    }
+    if (fd_ < 0) {
+        HILOG_ERROR("failed to reopen the pending want journal, errno: %{public}d", errno);
+        return false;
+    }
+    if (restorableCount_ > 0 && !MapLocked()) {
+        // the records not restored yet are lost, they are still kept in the file.
+        restorableIndex_.clear();
+        restorableCount_ = 0;
+        for (auto &record : records_) {
+            record.second.restorable = false;
+        }
+    }
+    return true;
+}
+
+bool PendingWantJournal::MapLocked()
+{
+    void *mapping = mmap(nullptr, static_cast<size_t>(fileSize_), PROT_READ, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        HILOG_ERROR("failed to map the pending want journal, errno: %{public}d", errno);
+        return false;
+    }
+    mapping_ = static_cast<const uint8_t *>(mapping);
+    mappingSize_ = static_cast<size_t>(fileSize_);
+    return true;
+}
+
+void PendingWantJournal::UnmapLocked()
+{
+    if (mapping_ != nullptr) {
+        munmap(const_cast<uint8_t *>(mapping_), mappingSize_);
+        mapping_ = nullptr;
+        mappingSize_ = 0;
+    }
+}
+
+void PendingWantJournal::CloseLocked()
+{
+    UnmapLocked();
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -122,5 +122,60 @@ int32_t PendingWantKey::GetUserId()
     return userId_;
 }
 
+size_t PendingWantKey::GetHashCode()
+{
+    std::hash<std::string> stringHash;
+    auto element = requestWant_.GetElement();
+    size_t hashCode = stringHash(bundleName_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + static_cast<size_t>(type_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWho_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + static_cast<size_t>(requestCode_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(element.GetDeviceID());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(element.GetBundleName());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(element.GetAbilityName());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetAction());
+    for (const auto &entity : requestWant_.GetEntities()) {
+        hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(entity);
+    }
+    hashCode = hashCode * ODD_PRIME_NUMBER + static_cast<size_t>(requestWant_.GetFlags());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestWant_.GetUriString());
+    hashCode = hashCode * ODD_PRIME_NUMBER + stringHash(requestResolvedType_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + static_cast<size_t>(flags_);
+    hashCode = hashCode * ODD_PRIME_NUMBER + static_cast<size_t>(userId_);
+    return hashCode;
+}
+
+bool PendingWantKey::IsEqual(const std::shared_ptr<PendingWantKey> &other)
+{
+    if (other == nullptr) {
+        return false;
+    }
+    if (bundleName_.compare(other->GetBundleName()) != 0) {
+        return false;
+    }
+    if (type_ != other->GetType()) {
+        return false;
+    }
+    if (requestWho_.compare(other->GetRequestWho()) != 0) {
+        return false;
+    }
+    if (requestCode_ != other->GetRequestCode()) {
+        return false;
+    }
+    if (!requestWant_.OperationEquals(other->GetRequestWant())) {
+        return false;
+    }
+    if (requestResolvedType_.compare(other->GetRequestResolvedType()) != 0) {
+        return false;
+    }
+    if (flags_ != other->GetFlags()) {
+        return false;
+    }
+    if (userId_ != other->GetUserId()) {
+        return false;
+    }
+    return true;
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -89,11 +89,14 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
                 wantSenderInfo.allWants.back().resolvedTypes = ref->GetKey()->GetRequestResolvedType();
                 ref->GetKey()->SetAllWantsInfos(wantSenderInfo.allWants);
                 ref->SetCallerUid(callingUid);
+                if (journal_ != nullptr) {
+                    journal_->Put(ref->GetUid(), callingUid, ref->GetKey());
+                }
             }
             return ref;
         }
         MakeWantSenderCanceledLocked(*ref);
-        wantRecords_.erase(ref->GetKey());
+        RemovePendingWantRecordLocked(ref->GetKey());
         return nullptr;
     }
 
@@ -105,8 +108,12 @@ sptr<IWantSender> PendingWantManager::GetWantSenderLocked(const int32_t callingU
         new (std::nothrow) PendingWantRecord(shared_from_this(), uid, callerToken, pendingKey);
     if (rec != nullptr) {
         rec->SetCallerUid(callingUid);
-        pendingKey->SetCode(PendingRecordIdCreate());
+        pendingKey->SetCode((journal_ != nullptr) ? journal_->AllocateCode() : PendingRecordIdCreate());
         wantRecords_.insert(std::make_pair(pendingKey, rec));
+        codeRecords_[pendingKey->GetCode()] = rec;
+        if (journal_ != nullptr) {
+            journal_->Put(uid, callingUid, pendingKey);
+        }
         return rec;
     }
     return nullptr;
@@ -127,12 +134,13 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
     HILOG_INFO("%{public}s:begin.", __func__);
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    for (const auto &item : wantRecords_) {
-        const auto &pendingKey = item.first;
-        const auto &pendingRecord = item.second;
-        if ((pendingRecord != nullptr) && CheckPendingWantRecordByKey(pendingKey, key)) {
-            return pendingRecord;
-        }
+    auto iter = wantRecords_.find(key);
+    if (iter != wantRecords_.end()) {
+        return iter->second;
+    }
+    JournalRecord journalRecord;
+    if (journal_ != nullptr && journal_->Restore(key, journalRecord)) {
+        return RestorePendingWantRecordLocked(journalRecord);
     }
     return nullptr;
 }
@@ -140,31 +148,24 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByKey(const std:
 bool PendingWantManager::CheckPendingWantRecordByKey(
     const std::shared_ptr<PendingWantKey> &inputKey, const std::shared_ptr<PendingWantKey> &key)
 {
-    if (inputKey->GetBundleName().compare(key->GetBundleName()) != 0) {
-        return false;
-    }
-    if (inputKey->GetType() != key->GetType()) {
-        return false;
-    }
-    if (inputKey->GetRequestWho().compare(key->GetRequestWho()) != 0) {
-        return false;
-    }
-    if (inputKey->GetRequestCode() != key->GetRequestCode()) {
-        return false;
-    }
-    if (!inputKey->GetRequestWant().OperationEquals(key->GetRequestWant())) {
-        return false;
-    }
-    if (inputKey->GetRequestResolvedType().compare(key->GetRequestResolvedType()) != 0) {
-        return false;
+    return PendingWantKeyEqual()(inputKey, key);
+}
+
+void PendingWantManager::RemovePendingWantRecordLocked(const std::shared_ptr<PendingWantKey> &key)
+{
+    if (key == nullptr) {
+        return;
     }
-    if (inputKey->GetFlags() != key->GetFlags()) {
-        return false;
+    // a canceled record may share the content of a newer one, only remove the record owning this key.
+    auto iter = wantRecords_.find(key);
+    if (iter == wantRecords_.end() || iter->first != key) {
+        return;
     }
-    if (inputKey->GetUserId() != key->GetUserId()) {
-        return false;
+    if (journal_ != nullptr) {
+        journal_->Remove(iter->first->GetCode());
     }
-    return true;
+    codeRecords_.erase(iter->first->GetCode());
+    wantRecords_.erase(iter);
 }
 
 int32_t PendingWantManager::SendWantSender(const sptr<IWantSender> &target, const SenderInfo &senderInfo)
@@ -204,7 +205,7 @@ void PendingWantManager::CancelWantSenderLocked(PendingWantRecord &record, bool
 
     MakeWantSenderCanceledLocked(record);
     if (cleanAbility) {
-        wantRecords_.erase(record.GetKey());
+        RemovePendingWantRecordLocked(record.GetKey());
     }
 }
 
@@ -221,13 +222,19 @@ int32_t PendingWantManager::PendingWantStartAbilitys(
     HILOG_INFO("%{public}s:begin.", __func__);
 
     int32_t result = ERR_OK;
-    for (const auto &item : wantsInfo) {
-        const auto &want = item.want;
-        result = DelayedSingleton<AbilityManagerService>::GetInstance()->StartAbility(want, callerToken, requestCode);
+    std::vector<Want> wants;
+    for (size_t i = 0; i < wantsInfo.size(); i++) {
+        wants.emplace_back(wantsInfo[i].want);
+        if (wants.size() < MAX_START_ABILITIES && i + 1 < wantsInfo.size()) {
+            continue;
+        }
+        result =
+            DelayedSingleton<AbilityManagerService>::GetInstance()->StartAbilities(wants, callerToken, requestCode);
         if (result != ERR_OK && result != START_ABILITY_WAITING) {
             HILOG_ERROR("%{public}s:result != ERR_OK && result != START_ABILITY_WAITING.", __func__);
             return result;
         }
+        wants.clear();
     }
     return result;
 }
@@ -274,10 +281,65 @@ sptr<PendingWantRecord> PendingWantManager::GetPendingWantRecordByCode(int32_t c
     HILOG_INFO("%{public}s:begin. wantRecords_ size = %{public}zu", __func__, wantRecords_.size());
 
     std::lock_guard<std::recursive_mutex> locker(mutex_);
-    auto iter = std::find_if(wantRecords_.begin(), wantRecords_.end(), [&code](const auto &pair) {
-        return pair.second->GetKey()->GetCode() == code;
-    });
-    return ((iter == wantRecords_.end()) ? nullptr : iter->second);
+    auto iter = codeRecords_.find(code);
+    if (iter != codeRecords_.end()) {
+        return iter->second;
+    }
+    JournalRecord journalRecord;
+    if (journal_ != nullptr && journal_->Restore(code, journalRecord)) {
+        return RestorePendingWantRecordLocked(journalRecord);
+    }
+    return nullptr;
+}
+
+sptr<PendingWantRecord> PendingWantManager::RestorePendingWantRecordLocked(const JournalRecord &journalRecord)
+{
+    HILOG_INFO("%{public}s:restore pending want, code = %{public}d", __func__, journalRecord.key->GetCode());
+
+    // the caller token did not survive the restart, the restored want is started without one.
+    sptr<PendingWantRecord> rec =
+        new (std::nothrow) PendingWantRecord(shared_from_this(), journalRecord.uid, nullptr, journalRecord.key);
+    if (rec == nullptr) {
+        return nullptr;
+    }
+    rec->SetCallerUid(journalRecord.callerUid);
+    wantRecords_.insert(std::make_pair(journalRecord.key, rec));
+    codeRecords_[journalRecord.key->GetCode()] = rec;
+    return rec;
+}
+
+bool PendingWantManager::LoadJournal(const std::string &path)
+{
+    HILOG_INFO("%{public}s:begin.", __func__);
+
+    std::lock_guard<std::recursive_mutex> locker(mutex_);
+    auto journal = std::make_shared<PendingWantJournal>(path);
+    if (!journal->Load()) {
+        HILOG_ERROR("%{public}s:failed to load the journal, pending wants are kept in memory only.", __func__);
+        return false;
+    }
+    journal_ = journal;
+    return true;
+}
+
+void PendingWantManager::ClearPendingWantRecord(const std::string &bundleName)
+{
+    HILOG_INFO("%{public}s:begin, bundleName: %{public}s.", __func__, bundleName.c_str());
+
+    std::lock_guard<std::recursive_mutex> locker(mutex_);
+    std::vector<sptr<PendingWantRecord>> records;
+    for (const auto &item : wantRecords_) {
+        if (item.first->GetBundleName() == bundleName) {
+            records.emplace_back(item.second);
+        }
+    }
+    for (const auto &record : records) {
+        CancelWantSenderLocked(*record, true);
+    }
+    // the records not restored since the boot are in the journal only.
+    if (journal_ != nullptr) {
+        journal_->PurgeBundle(bundleName);
+    }
 }
 
 int32_t PendingWantManager::GetPendingWantUid(const sptr<IWantSender> &target)
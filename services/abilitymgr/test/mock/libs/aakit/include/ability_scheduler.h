@@ -71,6 +71,9 @@ public:
 
     int BatchInsert(const Uri &uri, const std::vector<ValuesBucket> &values) override;
 
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations) override;
+
 private:
     AbilityResult result_;
 };
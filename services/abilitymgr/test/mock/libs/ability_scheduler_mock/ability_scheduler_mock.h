@@ -14,6 +14,8 @@
  */
 
 #pragma once
+#include <chrono>
+#include <thread>
 #include "ability_scheduler_interface.h"
 #include <iremote_object.h>
 #include <iremote_stub.h>
@@ -43,6 +45,18 @@ public:
     int InvokeSendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
     {
         code_ = code;
+        flags_ = option.GetFlags();
+        return 0;
+    }
+
+    // a stalled app, a sync request waits for it, while a one-way request is only queued.
+    int InvokeStalledSendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option)
+    {
+        code_ = code;
+        flags_ = option.GetFlags();
+        if ((flags_ & MessageOption::TF_ASYNC) == 0) {
+            std::this_thread::sleep_for(std::chrono::seconds(STALL_TIME));
+        }
         return 0;
     }
 
@@ -104,7 +118,15 @@ public:
         return -1;
     }
 
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+    {
+        return std::vector<std::shared_ptr<DataAbilityResult>>();
+    }
+
+    static constexpr int STALL_TIME = 5;  // seconds
     int code_ = 0;
+    int flags_ = 0;
 };
 
 }  // namespace AAFwk
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #define private public
@@ -1377,5 +1378,93 @@ HWTEST_F(AbilityConnectManagerTest, AAFWK_Connect_Service_029, TestSize.Level1)
         EXPECT_EQ(it->GetAbilityConnectCallback(), nullptr);
     }
 }
+
+/*
+ * Feature: AbilityConnectManager
+ * Function: TerminateAbility
+ * SubFunction: NA
+ * FunctionPoints: the indexes of the services and the connections
+ * EnvConditions:NA
+ * CaseDescription: Verify the service is found by its token and by its caller and request code,
+ * and the indexes are updated when the service is removed.
+ */
+HWTEST_F(AbilityConnectManagerTest, AAFWK_Connect_Service_030, TestSize.Level1)
+{
+    auto handler = std::make_shared<EventHandler>(EventRunner::Create());
+    ConnectManager()->SetEventHandler(handler);
+
+    abilityRequest_.callerToken = serviceRecord1_->GetToken();
+    abilityRequest_.requestCode = 1;
+    auto result = ConnectManager()->StartAbility(abilityRequest_);
+    EXPECT_EQ(OHOS::ERR_OK, result);
+    WaitUntilTaskDone(handler);
+
+    auto elementName = abilityRequest_.want.GetElement().GetURI();
+    auto service = ConnectManager()->GetServiceRecordByElementName(elementName);
+    EXPECT_NE(service, nullptr);
+    EXPECT_EQ(service, ConnectManager()->GetServiceRecordByToken(service->GetToken()));
+    EXPECT_EQ(OHOS::ERR_INVALID_VALUE, ConnectManager()->TerminateAbility(serviceRecord1_, 0));
+
+    // the request code of the same caller is replaced.
+    service->SetAbilityState(OHOS::AAFwk::AbilityState::ACTIVE);
+    abilityRequest_.requestCode = 2;
+    EXPECT_EQ(OHOS::ERR_OK, ConnectManager()->StartAbility(abilityRequest_));
+    EXPECT_EQ(OHOS::ERR_INVALID_VALUE, ConnectManager()->TerminateAbility(serviceRecord1_, 1));
+    EXPECT_EQ(OHOS::ERR_OK, ConnectManager()->TerminateAbility(serviceRecord1_, 2));
+    WaitUntilTaskDone(handler);
+    EXPECT_EQ(service->GetAbilityState(), TERMINATING);
+
+    ConnectManager()->RemoveServiceAbility(service);
+    EXPECT_EQ(nullptr, ConnectManager()->GetServiceRecordByToken(service->GetToken()));
+    EXPECT_EQ(OHOS::ERR_INVALID_VALUE, ConnectManager()->TerminateAbility(serviceRecord1_, 2));
+    EXPECT_TRUE(ConnectManager()->serviceTokenIndex_.empty());
+    EXPECT_TRUE(ConnectManager()->serviceCallerIndex_.empty());
+}
+
+/*
+ * Feature: AbilityConnectManager
+ * Function: ConnectAbilityLocked and RemoveConnectionRecordFromMap
+ * SubFunction: NA
+ * FunctionPoints: the throughput of the connection bookkeeping
+ * EnvConditions:NA
+ * CaseDescription: Measure connecting and removing 1000 connections of different callbacks.
+ */
+HWTEST_F(AbilityConnectManagerTest, AAFWK_Connect_Service_031, TestSize.Level3)
+{
+    auto handler = std::make_shared<EventHandler>(EventRunner::Create());
+    ConnectManager()->SetEventHandler(handler);
+
+    constexpr int connectionCount = 1000;
+    std::vector<OHOS::sptr<IAbilityConnection>> callbacks;
+    for (int i = 0; i < connectionCount; i++) {
+        callbacks.emplace_back(new AbilityConnectCallback());
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for (auto &callback : callbacks) {
+        EXPECT_EQ(OHOS::ERR_OK, ConnectManager()->ConnectAbilityLocked(abilityRequest_, callback, nullptr));
+    }
+    auto connectCost = std::chrono::steady_clock::now() - begin;
+    EXPECT_EQ(connectionCount, static_cast<int>(ConnectManager()->GetConnectMap().size()));
+    EXPECT_EQ(connectionCount, static_cast<int>(ConnectManager()->connectRecordIndex_.size()));
+
+    auto elementName = abilityRequest_.want.GetElement().GetURI();
+    auto service = ConnectManager()->GetServiceRecordByElementName(elementName);
+    ASSERT_NE(service, nullptr);
+    begin = std::chrono::steady_clock::now();
+    for (auto &connectRecord : service->GetConnectRecordList()) {
+        EXPECT_EQ(service, ConnectManager()->GetServiceRecordByToken(service->GetToken()));
+        ConnectManager()->RemoveConnectionRecordFromMap(connectRecord);
+    }
+    auto disconnectCost = std::chrono::steady_clock::now() - begin;
+    EXPECT_TRUE(ConnectManager()->GetConnectMap().empty());
+    EXPECT_TRUE(ConnectManager()->connectRecordIndex_.empty());
+
+    GTEST_LOG_(INFO) << "connect " << connectionCount << " connections: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(connectCost).count() << " us";
+    GTEST_LOG_(INFO) << "remove " << connectionCount << " connections: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(disconnectCost).count() << " us";
+    WaitUntilTaskDone(handler);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
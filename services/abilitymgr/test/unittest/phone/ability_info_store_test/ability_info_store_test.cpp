@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "ability_info_store.h"
+#include "ability_record.h"
+
+using namespace testing::ext;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr int RECORD_COUNT = 1000;
+}  // namespace
+
+class AbilityInfoStoreTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static AbilityInfo MakeAbilityInfo(const std::string &bundleName, const std::string &name);
+    static ApplicationInfo MakeApplicationInfo(const std::string &bundleName);
+
+    std::shared_ptr<AbilityInfoStore> store_;
+};
+
+void AbilityInfoStoreTest::SetUpTestCase(void)
+{}
+void AbilityInfoStoreTest::TearDownTestCase(void)
+{}
+void AbilityInfoStoreTest::SetUp(void)
+{
+    store_ = DelayedSingleton<AbilityInfoStore>::GetInstance();
+}
+void AbilityInfoStoreTest::TearDown(void)
+{
+    store_.reset();
+}
+
+AbilityInfo AbilityInfoStoreTest::MakeAbilityInfo(const std::string &bundleName, const std::string &name)
+{
+    AbilityInfo abilityInfo;
+    abilityInfo.name = name;
+    abilityInfo.bundleName = bundleName;
+    abilityInfo.applicationName = bundleName;
+    abilityInfo.type = AbilityType::PAGE;
+    abilityInfo.codePath = "/system/app/" + bundleName + "/code/path/of/the/ability";
+    abilityInfo.resourcePath = "/system/app/" + bundleName + "/resources/path/of/the/ability";
+    abilityInfo.applicationInfo = MakeApplicationInfo(bundleName);
+    return abilityInfo;
+}
+
+ApplicationInfo AbilityInfoStoreTest::MakeApplicationInfo(const std::string &bundleName)
+{
+    ApplicationInfo applicationInfo;
+    applicationInfo.name = bundleName;
+    applicationInfo.bundleName = bundleName;
+    applicationInfo.dataDir = "/data/accounts/account_0/appdata/" + bundleName;
+    return applicationInfo;
+}
+
+/*
+ * Feature: AbilityInfoStore
+ * Function: Intern
+ * SubFunction: NA
+ * FunctionPoints: share the same infos
+ * EnvConditions: NA
+ * CaseDescription: the same content gets the same copy, a different content gets its own copy.
+ */
+HWTEST_F(AbilityInfoStoreTest, Intern_001, TestSize.Level0)
+{
+    auto abilityInfo = MakeAbilityInfo("com.ix.store.intern", "MainAbility");
+    auto first = store_->Intern(abilityInfo);
+    auto second = store_->Intern(abilityInfo);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ("MainAbility", first->name);
+
+    abilityInfo.launchMode = LaunchMode::SINGLETON;
+    auto changed = store_->Intern(abilityInfo);
+    EXPECT_NE(first.get(), changed.get());
+    EXPECT_EQ(LaunchMode::SINGLETON, changed->launchMode);
+
+    auto applicationInfo = MakeApplicationInfo("com.ix.store.intern");
+    EXPECT_EQ(store_->Intern(applicationInfo).get(), store_->Intern(applicationInfo).get());
+}
+
+/*
+ * Feature: AbilityInfoStore
+ * Function: Invalidate
+ * SubFunction: NA
+ * FunctionPoints: bundle versions
+ * EnvConditions: NA
+ * CaseDescription: the infos interned after the bundle changes are not shared with the earlier ones,
+ *                  and an info is freed with its last holder.
+ */
+HWTEST_F(AbilityInfoStoreTest, Invalidate_001, TestSize.Level0)
+{
+    auto abilityInfo = MakeAbilityInfo("com.ix.store.invalidate", "MainAbility");
+    auto before = store_->Intern(abilityInfo);
+    store_->Invalidate("com.ix.store.other");
+    EXPECT_EQ(before.get(), store_->Intern(abilityInfo).get());
+
+    store_->Invalidate("com.ix.store.invalidate");
+    auto after = store_->Intern(abilityInfo);
+    EXPECT_NE(before.get(), after.get());
+    EXPECT_EQ(after.get(), store_->Intern(abilityInfo).get());
+
+    std::weak_ptr<const AbilityInfo> weak = after;
+    after.reset();
+    EXPECT_TRUE(weak.expired());
+}
+
+/*
+ * Feature: AbilityInfoStore
+ * Function: SetEnabled
+ * SubFunction: NA
+ * FunctionPoints: disable sharing
+ * EnvConditions: NA
+ * CaseDescription: a disabled store returns a new copy for every info, sharing resumes once it is enabled.
+ */
+HWTEST_F(AbilityInfoStoreTest, SetEnabled_001, TestSize.Level0)
+{
+    auto abilityInfo = MakeAbilityInfo("com.ix.store.enabled", "MainAbility");
+    store_->SetEnabled(false);
+    auto first = store_->Intern(abilityInfo);
+    auto second = store_->Intern(abilityInfo);
+    store_->SetEnabled(true);
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ("MainAbility", first->name);
+    EXPECT_EQ(store_->Intern(abilityInfo).get(), store_->Intern(abilityInfo).get());
+}
+
+/*
+ * Feature: AbilityInfoStore
+ * Function: Dump
+ * SubFunction: NA
+ * FunctionPoints: memory accounting
+ * EnvConditions: NA
+ * CaseDescription: the records of the same ability share their infos, the dump shows the bytes per record
+ *                  of copied infos and of shared infos.
+ */
+HWTEST_F(AbilityInfoStoreTest, Dump_001, TestSize.Level1)
+{
+    Want want;
+    auto abilityInfo = MakeAbilityInfo("com.ix.store.dump", "MainAbility");
+    auto applicationInfo = MakeApplicationInfo("com.ix.store.dump");
+    std::vector<std::shared_ptr<AbilityRecord>> records;
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        records.emplace_back(std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo));
+    }
+    EXPECT_EQ(&records.front()->GetAbilityInfo(), &records.back()->GetAbilityInfo());
+    EXPECT_EQ(&records.front()->GetApplicationInfo(), &records.back()->GetApplicationInfo());
+    EXPECT_EQ(applicationInfo.dataDir, records.back()->GetApplicationInfo().dataDir);
+
+    std::vector<std::string> info;
+    store_->Dump(info);
+    ASSERT_FALSE(info.empty());
+    EXPECT_EQ("AbilityInfoStore:", info.front());
+    EXPECT_EQ(0U, info.back().find("  records #"));
+    for (const auto &line : info) {
+        GTEST_LOG_(INFO) << line;
+    }
+}
+}  // namespace AAFwk
+}  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ability_lifecycle_tracer.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint64_t MILLISECOND = 1000;  // us
+constexpr uint32_t HEX_RECORD_LENGTH = AbilityLifecycleTracer::TRACE_RECORD_SIZE * 2;
+
+uint64_t DecodeHex(const std::string &record, size_t offset, size_t bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        uint64_t byte = std::stoull(record.substr((offset + i) * 2, 2), nullptr, 16);
+        value |= byte << (i * 8);
+    }
+    return value;
+}
+}  // namespace
+
+class AbilityLifecycleTracerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void AbilityLifecycleTracerTest::SetUpTestCase(void)
+{}
+void AbilityLifecycleTracerTest::TearDownTestCase(void)
+{}
+void AbilityLifecycleTracerTest::SetUp(void)
+{}
+void AbilityLifecycleTracerTest::TearDown(void)
+{}
+
+/*
+ * Feature: LatencyHistogram
+ * Function: GetBucketIndex GetBucketUpperBound
+ * SubFunction: NA
+ * FunctionPoints: log-linear buckets
+ * EnvConditions: NA
+ * CaseDescription: every latency falls in the bucket bounding it, and a bucket is at most a quarter wide.
+ */
+HWTEST_F(AbilityLifecycleTracerTest, Histogram_001, TestSize.Level0)
+{
+    for (uint64_t latency = 0; latency < 100 * MILLISECOND; latency += 3) {
+        uint32_t index = LatencyHistogram::GetBucketIndex(latency);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        EXPECT_GE(LatencyHistogram::GetBucketUpperBound(index), latency);
+        EXPECT_LE(LatencyHistogram::GetBucketUpperBound(index), latency + latency / 4);
+        if (index > 0) {
+            EXPECT_LT(LatencyHistogram::GetBucketUpperBound(index - 1), latency);
+        }
+    }
+    EXPECT_EQ(LatencyHistogram::BUCKET_COUNT - 1, LatencyHistogram::GetBucketIndex(UINT64_MAX));
+}
+
+/*
+ * Feature: LatencyHistogram
+ * Function: GetPercentile
+ * SubFunction: NA
+ * FunctionPoints: percentiles
+ * EnvConditions: NA
+ * CaseDescription: the percentiles are within a quarter of the recorded latencies.
+ */
+HWTEST_F(AbilityLifecycleTracerTest, Histogram_002, TestSize.Level0)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(0u, histogram.GetPercentile(99));
+    for (uint64_t i = 1; i <= 100; i++) {
+        histogram.Record(i * MILLISECOND);
+    }
+    EXPECT_EQ(100u, histogram.GetCount());
+    EXPECT_EQ(100 * MILLISECOND, histogram.GetMax());
+    EXPECT_EQ(50500u, histogram.GetAverage());
+    uint64_t p50 = histogram.GetPercentile(50);
+    EXPECT_GE(p50, 50 * MILLISECOND);
+    EXPECT_LE(p50, 50 * MILLISECOND * 5 / 4);
+    uint64_t p99 = histogram.GetPercentile(99);
+    EXPECT_GE(p99, 99 * MILLISECOND);
+    EXPECT_LE(p99, 100 * MILLISECOND);
+}
+
+/*
+ * Feature: AbilityLifecycleTracer
+ * Function: BeginTransition CompleteTransition
+ * SubFunction: NA
+ * FunctionPoints: global and per-bundle histograms
+ * EnvConditions: NA
+ * CaseDescription: a completed transition is recorded in the global and the bundle histogram.
+ */
+HWTEST_F(AbilityLifecycleTracerTest, Transition_001, TestSize.Level0)
+{
+    AbilityLifecycleTracer tracer;
+    auto music = tracer.GetBundleStats("com.ix.hiMusic");
+    auto radio = tracer.GetBundleStats("com.ix.hiRadio");
+    ASSERT_NE(music, nullptr);
+    EXPECT_EQ(music, tracer.GetBundleStats("com.ix.hiMusic"));
+    EXPECT_NE(music->bundleId, radio->bundleId);
+
+    int64_t begin = tracer.BeginTransition(music, 1, TRANSITION_LOAD);
+    tracer.CompleteTransition(music, 1, TRANSITION_LOAD, begin - 20 * MILLISECOND);
+    begin = tracer.BeginTransition(radio, 2, TRANSITION_ACTIVATE);
+    tracer.CompleteTransition(radio, 2, TRANSITION_ACTIVATE, begin);
+
+    EXPECT_EQ(1u, tracer.GetHistogram(TRANSITION_LOAD).GetCount());
+    EXPECT_GE(tracer.GetHistogram(TRANSITION_LOAD).GetMax(), 20 * MILLISECOND);
+    EXPECT_EQ(1u, tracer.GetHistogram(TRANSITION_ACTIVATE).GetCount());
+    EXPECT_EQ(1u, music->histograms[TRANSITION_LOAD].GetCount());
+    EXPECT_EQ(0u, music->histograms[TRANSITION_ACTIVATE].GetCount());
+    EXPECT_EQ(1u, radio->histograms[TRANSITION_ACTIVATE].GetCount());
+
+    std::vector<std::string> info;
+    tracer.Dump(info);
+    auto contains = [&info](const std::string &text) {
+        return std::any_of(info.begin(), info.end(),
+            [&text](const std::string &line) { return line.find(text) != std::string::npos; });
+    };
+    EXPECT_TRUE(contains("bundle: com.ix.hiMusic"));
+    EXPECT_TRUE(contains("load  count #1"));
+    EXPECT_FALSE(contains("terminate  count"));
+}
+
+/*
+ * Feature: AbilityLifecycleTracer
+ * Function: GetBundleStats
+ * SubFunction: NA
+ * FunctionPoints: bounded bundle stats
+ * EnvConditions: NA
+ * CaseDescription: the bundles beyond the limit share the stats with bundle id 0.
+ */
+HWTEST_F(AbilityLifecycleTracerTest, GetBundleStats_001, TestSize.Level0)
+{
+    AbilityLifecycleTracer tracer;
+    for (uint32_t i = 0; i < AbilityLifecycleTracer::MAX_BUNDLE_COUNT; i++) {
+        EXPECT_NE(0, tracer.GetBundleStats("com.ix.bundle" + std::to_string(i))->bundleId);
+    }
+    auto first = tracer.GetBundleStats("com.ix.more1");
+    EXPECT_EQ(0, first->bundleId);
+    EXPECT_EQ(first, tracer.GetBundleStats("com.ix.more2"));
+}
+
+/*
+ * Feature: AbilityLifecycleTracer
+ * Function: DumpTrace
+ * SubFunction: NA
+ * FunctionPoints: binary trace ring
+ * EnvConditions: NA
+ * CaseDescription: the trace keeps the latest events in order, each one a little endian record.
+ */
+HWTEST_F(AbilityLifecycleTracerTest, DumpTrace_001, TestSize.Level0)
+{
+    AbilityLifecycleTracer tracer;
+    auto stats = tracer.GetBundleStats("com.ix.hiMusic");
+    uint32_t transitions = AbilityLifecycleTracer::TRACE_CAPACITY;  // two events each
+    for (uint32_t i = 0; i < transitions; i++) {
+        int64_t begin = tracer.BeginTransition(stats, i, TRANSITION_TERMINATE);
+        tracer.CompleteTransition(stats, i, TRANSITION_TERMINATE, begin - 5 * MILLISECOND);
+    }
+
+    std::vector<std::string> info;
+    tracer.DumpTrace(info);
+    std::vector<std::string> records;
+    for (const auto &line : info) {
+        if (line.size() == HEX_RECORD_LENGTH && line.find(' ') == std::string::npos) {
+            records.emplace_back(line);
+        }
+    }
+    ASSERT_EQ(AbilityLifecycleTracer::TRACE_CAPACITY, records.size());
+
+    // the oldest half was dropped, the last record completes the last transition.
+    const std::string &first = records.front();
+    EXPECT_EQ(transitions / 2, DecodeHex(first, 12, 4));  // record id
+    EXPECT_EQ(AbilityLifecycleTracer::PHASE_BEGIN, DecodeHex(first, 19, 1));
+    const std::string &last = records.back();
+    EXPECT_GE(DecodeHex(last, 8, 4), 5 * MILLISECOND);  // latency
+    EXPECT_EQ(transitions - 1, DecodeHex(last, 12, 4));
+    EXPECT_EQ(stats->bundleId, DecodeHex(last, 16, 2));
+    EXPECT_EQ(TRANSITION_TERMINATE, DecodeHex(last, 18, 1));
+    EXPECT_EQ(AbilityLifecycleTracer::PHASE_COMPLETE, DecodeHex(last, 19, 1));
+    EXPECT_LE(DecodeHex(first, 0, 8), DecodeHex(last, 0, 8));  // time
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -712,5 +712,53 @@ HWTEST_F(AbilityManagerProxyTest, AbilityManagerProxy_ReleaseDataAbility_004, Te
     EXPECT_CALL(*mock_, SendRequest(_, _, _, _)).WillOnce(Return(TRANSACTION_ERR));
     EXPECT_EQ(proxy_->ReleaseDataAbility(scheduler, abilityRecord->GetToken()), TRANSACTION_ERR);
 }
+
+/*
+ * Feature: AbilityManagerService
+ * Function: StartAbilities
+ * SubFunction: NA
+ * FunctionPoints: AbilityManagerService StartAbilities
+ * EnvConditions: NA
+ * CaseDescription: Verify the wants are sent in one request, and an empty or too large batch is not sent.
+ */
+HWTEST_F(AbilityManagerProxyTest, AbilityManagerProxy_StartAbilities_001, TestSize.Level0)
+{
+    EXPECT_CALL(*mock_, SendRequest(_, _, _, _))
+        .Times(1)
+        .WillOnce(Invoke(mock_.GetRefPtr(), &AbilityManagerStubMock::InvokeSendRequest));
+    std::vector<Want> wants(5);
+    auto res = proxy_->StartAbilities(wants, nullptr, 9);
+    EXPECT_EQ(IAbilityManager::START_ABILITIES, mock_->code_);
+    EXPECT_EQ(res, NO_ERROR);
+
+    EXPECT_EQ(proxy_->StartAbilities(std::vector<Want>(), nullptr, 9), ERR_INVALID_VALUE);
+    EXPECT_EQ(proxy_->StartAbilities(std::vector<Want>(MAX_START_ABILITIES + 1), nullptr, 9), ERR_INVALID_VALUE);
+}
+
+/*
+ * Feature: AbilityManagerService
+ * Function: UpdateMissionSnapshot
+ * SubFunction: NA
+ * FunctionPoints: AbilityManagerService UpdateMissionSnapshot
+ * EnvConditions: NA
+ * CaseDescription: Verify the snapshot is sent, and a snapshot without pixels is not sent.
+ */
+HWTEST_F(AbilityManagerProxyTest, AbilityManagerProxy_UpdateMissionSnapshot_001, TestSize.Level0)
+{
+    EXPECT_CALL(*mock_, SendRequest(_, _, _, _))
+        .Times(1)
+        .WillOnce(Invoke(mock_.GetRefPtr(), &AbilityManagerStubMock::InvokeSendRequest));
+    std::vector<uint8_t> pixels(16 * 16 * 4, 1);
+    ImageInfo snapshot;
+    snapshot.header.width = 16;
+    snapshot.header.height = 16;
+    snapshot.dataSize = pixels.size();
+    snapshot.data = pixels.data();
+    auto res = proxy_->UpdateMissionSnapshot(1, snapshot);
+    EXPECT_EQ(IAbilityManager::UPDATE_MISSION_SNAPSHOT, mock_->code_);
+    EXPECT_EQ(res, NO_ERROR);
+
+    EXPECT_EQ(proxy_->UpdateMissionSnapshot(1, ImageInfo()), ERR_INVALID_VALUE);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
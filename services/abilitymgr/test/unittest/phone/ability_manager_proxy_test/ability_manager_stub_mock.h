@@ -162,6 +162,11 @@ public:
         return 0;
     }
 
+    int UpdateMissionSnapshot(const int32_t missionId, const ImageInfo &snapshot)
+    {
+        return 0;
+    }
+
     virtual int RemoveMission(int id)
     {
         return 0;
@@ -234,6 +239,8 @@ public:
 
     MOCK_METHOD2(TerminateAbilityByCaller, int(const sptr<IRemoteObject> &callerToken, int requestCode));
     MOCK_METHOD3(StartAbility, int(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode));
+    MOCK_METHOD3(StartAbilities,
+        int(const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode));
     MOCK_METHOD2(
         GetWantSender, sptr<IWantSender>(const WantSenderInfo &wantSenderInfo, const sptr<IRemoteObject> &callerToken));
     MOCK_METHOD2(SendWantSender, int(const sptr<IWantSender> &target, const SenderInfo &senderInfo));
@@ -1606,12 +1606,12 @@ HWTEST_F(AbilityManagerServiceTest, systemDialog_002, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_001, TestSize.Level1)
 {
@@ -1629,7 +1629,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_001, TestSize.Level1)
     OHOS::sptr<IAbilityScheduler> scheduler = new AbilityScheduler();
     EXPECT_EQ(abilityMs_->AttachAbilityThread(scheduler, dialogtoken), OHOS::ERR_OK);
     EXPECT_TRUE(barAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
-    abilityMs_->HandleLoadTimeOut(barAbility->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, barAbility);
     WaitUntilTaskFinished();
     auto newStackManager = abilityMs_->systemAppManager_;
     auto newBarAbility = newStackManager->GetCurrentTopAbility();
@@ -1641,12 +1641,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_001, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_002, TestSize.Level1)
 {
@@ -1662,7 +1662,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_002, TestSize.Level1)
     OHOS::sptr<IAbilityScheduler> scheduler = new AbilityScheduler();
     EXPECT_EQ(abilityMs_->AttachAbilityThread(scheduler, dialogtoken), OHOS::ERR_OK);
     EXPECT_TRUE(navigationAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
-    abilityMs_->HandleLoadTimeOut(navigationAbility->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, navigationAbility);
     auto newStackManager = abilityMs_->systemAppManager_;
     auto newNavigationAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newNavigationAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
@@ -1671,12 +1671,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_002, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when timeout ,the HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when timeout ,the HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_003, TestSize.Level1)
 {
@@ -1691,7 +1691,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_003, TestSize.Level1)
     AbilityRecordInfo barAbilityInfo;
     barAbility->GetAbilityRecordInfo(barAbilityInfo);
     EXPECT_TRUE(barAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
-    abilityMs_->HandleLoadTimeOut(barAbility->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, barAbility);
     auto newStackManager = abilityMs_->systemAppManager_;
     auto newBarAbility = newStackManager->GetCurrentTopAbility();
     AbilityRecordInfo newAbilityInfo;
@@ -1702,12 +1702,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_003, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when timeout ,the HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when timeout ,the HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_004, TestSize.Level1)
 {
@@ -1720,7 +1720,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_004, TestSize.Level1)
     auto stackManager = abilityMs_->systemAppManager_;
     auto navigationAbility = stackManager->GetCurrentTopAbility();
     EXPECT_TRUE(navigationAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
-    abilityMs_->HandleLoadTimeOut(navigationAbility->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, navigationAbility);
     auto newStackManager = abilityMs_->systemAppManager_;
     auto newNavigationAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newNavigationAbility->GetAbilityInfo().bundleName == AbilityConfig::SYSTEM_UI_BUNDLE_NAME);
@@ -1729,12 +1729,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_004, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_005, TestSize.Level1)
 {
@@ -1758,12 +1758,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_005, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start systemui, when HandleLoadTimeOut called, restart systemui
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start systemui, when HandleTimeOut called, restart systemui
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_006, TestSize.Level1)
 {
@@ -1787,12 +1787,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_006, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when HandleLoadTimeOut called, restart previous ability
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when HandleTimeOut called, restart previous ability
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_007, TestSize.Level1)
 {
@@ -1813,7 +1813,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_007, TestSize.Level1)
     EXPECT_EQ(OHOS::ERR_OK, resultTv);
     auto stackManagerTv = abilityMs_->GetStackManager();
     auto abilityTv = stackManagerTv->GetCurrentTopAbility();
-    abilityMs_->HandleLoadTimeOut(abilityTv->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityTv);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName == "com.ix.hiMusic");
@@ -1821,12 +1821,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_007, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when HandleLoadTimeOut called, restart previous ability
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when HandleTimeOut called, restart previous ability
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_008, TestSize.Level1)
 {
@@ -1847,7 +1847,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_008, TestSize.Level1)
     EXPECT_EQ(OHOS::ERR_OK, resultTv);
     auto stackManagerTv = abilityMs_->GetStackManager();
     auto abilityTv = stackManagerTv->GetCurrentTopAbility();
-    abilityMs_->HandleLoadTimeOut(abilityTv->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityTv);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName == COM_IX_HIWORLD);
@@ -1855,12 +1855,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_008, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when Activate timeout, the HandleLoadTimeOut called, restart launch
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when Activate timeout, the HandleTimeOut called, restart launch
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_009, TestSize.Level1)
 {
@@ -1885,7 +1885,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_009, TestSize.Level1)
     OHOS::sptr<IAbilityScheduler> newScheduler = new AbilityScheduler();
     EXPECT_EQ(abilityMs_->AttachAbilityThread(newScheduler, abilityTokenTv), OHOS::ERR_OK);
     abilityTv->Activate();
-    abilityMs_->HandleLoadTimeOut(abilityTv->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityTv);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName != "com.ix.hiTv");
@@ -1893,12 +1893,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_009, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when InActivate timeout, the HandleLoadTimeOut called, restart launch
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when InActivate timeout, the HandleTimeOut called, restart launch
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_010, TestSize.Level1)
 {
@@ -1923,7 +1923,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_010, TestSize.Level1)
     OHOS::sptr<IAbilityScheduler> newScheduler = new AbilityScheduler();
     EXPECT_EQ(abilityMs_->AttachAbilityThread(newScheduler, abilityTokenTv), OHOS::ERR_OK);
     abilityTv->Inactivate();
-    abilityMs_->HandleLoadTimeOut(abilityTv->GetEventId());
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, abilityTv);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName != "com.ix.hiTv");
@@ -1931,12 +1931,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_010, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when HandleLoadTimeOut called,the parameter is the maximum,nothing is done.
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when HandleTimeOut called,the record is null,nothing is done.
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_011, TestSize.Level1)
 {
@@ -1957,7 +1957,7 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_011, TestSize.Level1)
     EXPECT_EQ(OHOS::ERR_OK, resultTv);
     auto stackManagerTv = abilityMs_->GetStackManager();
     auto abilityTv = stackManagerTv->GetCurrentTopAbility();
-    abilityMs_->HandleLoadTimeOut(INT32_MAX);
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, nullptr);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName == "com.ix.hiTv");
@@ -1966,12 +1966,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_011, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
- * When you start page ability, when HandleLoadTimeOut called,the parameter is the minimum,nothing is done.
+ * CaseDescription: Verify function HandleTimeOut
+ * When you start page ability, when HandleTimeOut called,the record is not in stacks,nothing is done.
  */
 HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_012, TestSize.Level1)
 {
@@ -1992,7 +1992,12 @@ HWTEST_F(AbilityManagerServiceTest, handleloadtimeout_012, TestSize.Level1)
     EXPECT_EQ(OHOS::ERR_OK, resultTv);
     auto stackManagerTv = abilityMs_->GetStackManager();
     auto abilityTv = stackManagerTv->GetCurrentTopAbility();
-    abilityMs_->HandleLoadTimeOut(INT32_MIN);
+    AbilityRequest requestInfo;
+    requestInfo.want = abilityTv->GetWant();
+    requestInfo.abilityInfo = abilityTv->GetAbilityInfo();
+    requestInfo.appInfo = abilityTv->GetApplicationInfo();
+    auto detachedAbility = AbilityRecord::CreateAbilityRecord(requestInfo);
+    abilityMs_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, detachedAbility);
     auto newStackManager = abilityMs_->GetStackManager();
     auto newAbility = newStackManager->GetCurrentTopAbility();
     EXPECT_TRUE(newAbility->GetAbilityInfo().bundleName == "com.ix.hiTv");
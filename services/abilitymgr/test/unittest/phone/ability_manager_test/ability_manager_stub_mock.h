@@ -52,6 +52,7 @@ public:
     MOCK_METHOD1(GetAllStackInfo, int(StackInfo &));
     MOCK_METHOD3(GetRecentMissions, int(const int32_t, const int32_t, std::vector<AbilityMissionInfo> &));
     MOCK_METHOD2(GetMissionSnapshot, int(const int32_t, MissionSnapshotInfo &));
+    MOCK_METHOD2(UpdateMissionSnapshot, int(const int32_t, const ImageInfo &));
     MOCK_METHOD1(RemoveMission, int(int));
     MOCK_METHOD1(RemoveStack, int(int));
     MOCK_METHOD1(MoveMissionToTop, int(int32_t));
@@ -59,6 +60,8 @@ public:
     MOCK_METHOD1(UninstallApp, int(const std::string &));
     MOCK_METHOD2(TerminateAbilityByCaller, int(const sptr<IRemoteObject> &callerToken, int requestCode));
     MOCK_METHOD3(StartAbility, int(const Want &want, const sptr<IRemoteObject> &callerToken, int requestCode));
+    MOCK_METHOD3(StartAbilities,
+        int(const std::vector<Want> &wants, const sptr<IRemoteObject> &callerToken, int requestCode));
     MOCK_METHOD2(MoveMissionToEnd, int(const sptr<IRemoteObject> &token, const bool nonFirst));
     MOCK_METHOD1(IsFirstInMission, bool(const sptr<IRemoteObject> &token));
     MOCK_METHOD4(CompelVerifyPermission, int(const std::string &permission, int pid, int uid, std::string &message));
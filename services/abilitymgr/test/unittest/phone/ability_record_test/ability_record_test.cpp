@@ -21,7 +21,9 @@
 #undef private
 #undef protected
 
+#include "ability_manager_service.h"
 #include "ability_scheduler.h"
+#include "ability_token_registry.h"
 #include "connection_record.h"
 #include "mission_record.h"
 #include "mock_ability_connect_callback.h"
@@ -220,21 +222,6 @@ HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_SetGetPreNextAbilityReocrd, TestSize
     EXPECT_EQ(abilityRecord_->GetNextAbilityRecord().get(), nextAbilityRecord.get());
 }
 
-/*
- * Feature: AbilityRecord
- * Function: create AbilityRecord
- * SubFunction: NA
- * FunctionPoints: SetEventId GetEventId
- * EnvConditions:NA
- * CaseDescription: SetEventId GetEventId UT.
- */
-HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_SetGetEventId, TestSize.Level1)
-{
-    int64_t eventId = 1;
-    abilityRecord_->SetEventId(eventId);
-    EXPECT_EQ(eventId, abilityRecord_->GetEventId());
-}
-
 /*
  * Feature: AbilityRecord
  * Function: create AbilityRecord
@@ -686,5 +673,79 @@ HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_CreateByConnect, TestSize.Level1)
     abilityRecord_->SetCreateByConnectMode();
     EXPECT_EQ(true, abilityRecord_->IsCreateByConnect());
 }
+
+/*
+ * Feature: AbilityRecord
+ * Function: Init SetKernalSystemAbility
+ * SubFunction: AbilityTokenRegistry
+ * FunctionPoints: NA
+ * EnvConditions:NA
+ * CaseDescription: Verify the token is registered with its owner while the ability record is alive
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_TokenRegistry, TestSize.Level1)
+{
+    auto registry = DelayedSingleton<AbilityTokenRegistry>::GetInstance();
+    sptr<IRemoteObject> token = abilityRecord_->GetToken()->AsObject();
+    EXPECT_TRUE(registry->IsAlive(token));
+    EXPECT_EQ(AbilityTokenRegistry::OWNER_STACK_MANAGER, registry->GetOwner(token));
+
+    abilityRecord_->SetKernalSystemAbility();
+    EXPECT_EQ(AbilityTokenRegistry::OWNER_SYSTEM_APP_MANAGER, registry->GetOwner(token));
+
+    OHOS::AppExecFwk::AbilityInfo abilityInfo;
+    abilityInfo.type = OHOS::AppExecFwk::AbilityType::SERVICE;
+    OHOS::AppExecFwk::ApplicationInfo applicationInfo;
+    Want want;
+    auto serviceRecord = std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+    serviceRecord->Init();
+    sptr<IRemoteObject> serviceToken = serviceRecord->GetToken()->AsObject();
+    EXPECT_EQ(AbilityTokenRegistry::OWNER_CONNECT_MANAGER, registry->GetOwner(serviceToken));
+
+    abilityRecord_.reset();
+    serviceRecord.reset();
+    EXPECT_FALSE(registry->IsAlive(token));
+    EXPECT_FALSE(registry->IsAlive(serviceToken));
+}
+
+/*
+ * Feature: AbilityRecord
+ * Function: RevokeToken
+ * SubFunction: AbilityTokenRegistry
+ * FunctionPoints: NA
+ * EnvConditions:NA
+ * CaseDescription: Verify the token is no longer alive once its manager drops the ability record
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_RevokeToken, TestSize.Level1)
+{
+    auto registry = DelayedSingleton<AbilityTokenRegistry>::GetInstance();
+    sptr<IRemoteObject> token = abilityRecord_->GetToken()->AsObject();
+    EXPECT_TRUE(registry->IsAlive(token));
+
+    abilityRecord_->RevokeToken();
+    EXPECT_FALSE(registry->IsAlive(token));
+}
+
+/*
+ * Feature: AbilityRecord
+ * Function: Inactivate CompleteTransition
+ * SubFunction: AbilityLifecycleTracer
+ * FunctionPoints: NA
+ * EnvConditions:NA
+ * CaseDescription: Verify a lifecycle transition is recorded once when it completes
+ */
+HWTEST_F(AbilityRecordTest, AaFwk_AbilityMS_LifecycleTransition, TestSize.Level1)
+{
+    auto tracer = DelayedSingleton<AbilityManagerService>::GetInstance()->GetLifecycleTracer();
+    ASSERT_NE(tracer, nullptr);
+    uint64_t count = tracer->GetHistogram(TRANSITION_INACTIVATE).GetCount();
+
+    abilityRecord_->Inactivate();
+    EXPECT_EQ(count, tracer->GetHistogram(TRANSITION_INACTIVATE).GetCount());
+    abilityRecord_->CompleteTransition(TRANSITION_INACTIVATE);
+    EXPECT_EQ(count + 1, tracer->GetHistogram(TRANSITION_INACTIVATE).GetCount());
+    // completed already, e.g. by the timeout.
+    abilityRecord_->CompleteTransition(TRANSITION_INACTIVATE);
+    EXPECT_EQ(count + 1, tracer->GetHistogram(TRANSITION_INACTIVATE).GetCount());
+}
 }  // namespace AAFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "ability_resolve_cache.h"
+#include "bundlemgr/mock_bundle_manager.h"
+#include "want.h"
+
+using namespace testing::ext;
+using namespace OHOS::AppExecFwk;
+
+namespace OHOS {
+namespace AAFwk {
+// a bundle is updated while the cache waits for the query.
+class UpdatingBundleMgrService : public BundleMgrService {
+public:
+    bool QueryAbilityInfo(const AAFwk::Want &want, AbilityInfo &abilityInfo) override
+    {
+        if (cache_ != nullptr) {
+            cache_->Invalidate(want.GetBundle());
+        }
+        return BundleMgrService::QueryAbilityInfo(want, abilityInfo);
+    }
+
+    AbilityResolveCache *cache_ = nullptr;
+};
+
+class AbilityResolveCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    Want MakeWant(const std::string &bundleName, const std::string &abilityName) const;
+
+    sptr<IBundleMgr> bms_ = nullptr;
+};
+
+void AbilityResolveCacheTest::SetUpTestCase(void)
+{}
+void AbilityResolveCacheTest::TearDownTestCase(void)
+{}
+void AbilityResolveCacheTest::SetUp(void)
+{
+    bms_ = new BundleMgrService();
+}
+void AbilityResolveCacheTest::TearDown(void)
+{
+    bms_ = nullptr;
+}
+
+Want AbilityResolveCacheTest::MakeWant(const std::string &bundleName, const std::string &abilityName) const
+{
+    Want want;
+    want.SetElementName(bundleName, abilityName);
+    return want;
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: QueryAbilityInfo
+ * SubFunction: NA
+ * FunctionPoints: query the same want twice
+ * EnvConditions: NA
+ * CaseDescription: the second query is served by the cache with the same ability info.
+ */
+HWTEST_F(AbilityResolveCacheTest, QueryAbilityInfo_001, TestSize.Level0)
+{
+    AbilityResolveCache cache;
+    Want want = MakeWant("com.ix.hiMusic", "MusicAbility");
+    AbilityInfo first;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, want, first));
+    EXPECT_EQ(0u, cache.GetHitCount());
+    EXPECT_EQ(1u, cache.GetMissCount());
+
+    AbilityInfo second;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, want, second));
+    EXPECT_EQ(1u, cache.GetHitCount());
+    EXPECT_EQ(1u, cache.GetMissCount());
+    EXPECT_EQ(first.name, second.name);
+    EXPECT_EQ(first.bundleName, second.bundleName);
+
+    // another action is resolved on its own.
+    want.SetAction("action.system.test");
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, want, second));
+    EXPECT_EQ(2u, cache.GetMissCount());
+    EXPECT_EQ(2u, cache.GetSize());
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: QueryAbilityInfo
+ * SubFunction: NA
+ * FunctionPoints: failed query
+ * EnvConditions: NA
+ * CaseDescription: failed queries are not cached.
+ */
+HWTEST_F(AbilityResolveCacheTest, QueryAbilityInfo_002, TestSize.Level0)
+{
+    AbilityResolveCache cache;
+    Want want = MakeWant("", "");
+    AbilityInfo abilityInfo;
+    EXPECT_FALSE(cache.QueryAbilityInfo(bms_, want, abilityInfo));
+    EXPECT_FALSE(cache.QueryAbilityInfo(bms_, want, abilityInfo));
+    EXPECT_EQ(0u, cache.GetHitCount());
+    EXPECT_EQ(0u, cache.GetSize());
+    EXPECT_FALSE(cache.QueryAbilityInfo(nullptr, want, abilityInfo));
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: Invalidate
+ * SubFunction: NA
+ * FunctionPoints: invalidate the results of a bundle
+ * EnvConditions: NA
+ * CaseDescription: only the results of the bundle are dropped, others are still served by the cache.
+ */
+HWTEST_F(AbilityResolveCacheTest, Invalidate_001, TestSize.Level0)
+{
+    AbilityResolveCache cache;
+    AbilityInfo abilityInfo;
+    BundleInfo bundleInfo;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiRadio", "RadioAbility"), abilityInfo));
+    EXPECT_TRUE(cache.GetBundleInfo(bms_, "com.ix.hiMusic", bundleInfo));
+    EXPECT_EQ(3u, cache.GetSize());
+
+    cache.Invalidate("com.ix.hiMusic");
+    EXPECT_EQ(1u, cache.GetInvalidationCount());
+    EXPECT_EQ(1u, cache.GetSize());
+
+    uint64_t hitCount = cache.GetHitCount();
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiRadio", "RadioAbility"), abilityInfo));
+    EXPECT_EQ(hitCount + 1, cache.GetHitCount());
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(hitCount + 1, cache.GetHitCount());
+
+    cache.Clear();
+    EXPECT_EQ(2u, cache.GetInvalidationCount());
+    EXPECT_EQ(0u, cache.GetSize());
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: QueryAbilityInfo
+ * SubFunction: NA
+ * FunctionPoints: bounded capacity
+ * EnvConditions: NA
+ * CaseDescription: the least recently used result is evicted when the cache is full.
+ */
+HWTEST_F(AbilityResolveCacheTest, Capacity_001, TestSize.Level0)
+{
+    AbilityResolveCache cache(2);
+    AbilityInfo abilityInfo;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiRadio", "RadioAbility"), abilityInfo));
+    // touch the first one, the second one becomes the least recently used.
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiVideo", "VideoAbility"), abilityInfo));
+    EXPECT_EQ(2u, cache.GetSize());
+
+    uint64_t missCount = cache.GetMissCount();
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(missCount, cache.GetMissCount());
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiRadio", "RadioAbility"), abilityInfo));
+    EXPECT_EQ(missCount + 1, cache.GetMissCount());
+
+    std::vector<std::string> info;
+    cache.Dump(info);
+    EXPECT_FALSE(info.empty());
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: QueryAbilityInfo
+ * SubFunction: NA
+ * FunctionPoints: invalidate during the query
+ * EnvConditions: NA
+ * CaseDescription: a result queried before its bundle was invalidated is not cached, other bundles are.
+ */
+HWTEST_F(AbilityResolveCacheTest, Invalidate_002, TestSize.Level0)
+{
+    AbilityResolveCache cache;
+    sptr<UpdatingBundleMgrService> bms = new UpdatingBundleMgrService();
+    AbilityInfo abilityInfo;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms, MakeWant("com.ix.hiRadio", "RadioAbility"), abilityInfo));
+    EXPECT_EQ(1u, cache.GetSize());
+
+    bms->cache_ = &cache;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(1u, cache.GetSize());
+    bms->cache_ = nullptr;
+
+    uint64_t missCount = cache.GetMissCount();
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(missCount + 1, cache.GetMissCount());
+    EXPECT_EQ(2u, cache.GetSize());
+}
+
+/*
+ * Feature: AbilityResolveCache
+ * Function: SetEnabled
+ * SubFunction: NA
+ * FunctionPoints: disable the cache
+ * EnvConditions: NA
+ * CaseDescription: a disabled cache drops its results and asks bms for every query.
+ */
+HWTEST_F(AbilityResolveCacheTest, SetEnabled_001, TestSize.Level0)
+{
+    AbilityResolveCache cache;
+    AbilityInfo abilityInfo;
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(1u, cache.GetSize());
+
+    cache.SetEnabled(false);
+    EXPECT_EQ(0u, cache.GetSize());
+    uint64_t missCount = cache.GetMissCount();
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ("MusicAbility", abilityInfo.name);
+    EXPECT_EQ(missCount + 2, cache.GetMissCount());
+    EXPECT_EQ(0u, cache.GetSize());
+
+    cache.SetEnabled(true);
+    EXPECT_TRUE(cache.QueryAbilityInfo(bms_, MakeWant("com.ix.hiMusic", "MusicAbility"), abilityInfo));
+    EXPECT_EQ(1u, cache.GetSize());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
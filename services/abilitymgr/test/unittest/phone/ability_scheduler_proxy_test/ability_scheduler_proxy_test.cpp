@@ -277,5 +277,37 @@ HWTEST_F(AbilitySchedulerProxyTest, ability_scheduler_proxy_operating_012, TestS
 
     EXPECT_EQ(IAbilityScheduler::SCHEDULE_ABILITY_COMMAND, mock_->code_);
 }
+
+/*
+ * Feature: AbilitySchedulerProxy
+ * Function: ScheduleAbilityTransaction, SendResult, ScheduleConnectAbility, ScheduleDisconnectAbility
+ *           and ScheduleCommandAbility
+ * SubFunction: NA
+ * FunctionPoints: the lifecycle scheduling is one-way
+ * EnvConditions: NA
+ * CaseDescription: verify the lifecycle scheduling requests are sent with TF_ASYNC
+ */
+HWTEST_F(AbilitySchedulerProxyTest, ability_scheduler_proxy_operating_013, TestSize.Level0)
+{
+    EXPECT_CALL(*mock_, SendRequest(_, _, _, _))
+        .Times(5)
+        .WillRepeatedly(Invoke(mock_.GetRefPtr(), &AbilitySchedulerMock::InvokeSendRequest));
+    Want want;
+    LifeCycleStateInfo info;
+    abilitySchedulerProxy_->ScheduleAbilityTransaction(want, info);
+    EXPECT_EQ(MessageOption::TF_ASYNC, mock_->flags_);
+    mock_->flags_ = 0;
+    abilitySchedulerProxy_->SendResult(1, 0, want);
+    EXPECT_EQ(MessageOption::TF_ASYNC, mock_->flags_);
+    mock_->flags_ = 0;
+    abilitySchedulerProxy_->ScheduleConnectAbility(want);
+    EXPECT_EQ(MessageOption::TF_ASYNC, mock_->flags_);
+    mock_->flags_ = 0;
+    abilitySchedulerProxy_->ScheduleDisconnectAbility(want);
+    EXPECT_EQ(MessageOption::TF_ASYNC, mock_->flags_);
+    mock_->flags_ = 0;
+    abilitySchedulerProxy_->ScheduleCommandAbility(want, false, 1);
+    EXPECT_EQ(MessageOption::TF_ASYNC, mock_->flags_);
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
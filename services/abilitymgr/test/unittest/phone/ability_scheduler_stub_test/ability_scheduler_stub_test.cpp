@@ -13,13 +13,42 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include "ability_schedule_stub_mock.h"
+#include "ability_scheduler_proxy.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
 namespace AAFwk {
+namespace {
+const std::string BATCH_URI = "dataability://device_id/com.domainname.dataability.persondata/person";
+constexpr int BATCH_SIZE = 1000;
+}  // namespace
+
+class BatchAbilitySchedulerStubMock : public AbilitySchedulerStubMock {
+public:
+    int Insert(const Uri &uri, const ValuesBucket &value) override
+    {
+        return ++lastId_;
+    }
+
+    std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations) override
+    {
+        operations_ = operations;
+        std::vector<std::shared_ptr<DataAbilityResult>> results;
+        for (auto &operation : operations) {
+            results.emplace_back(std::make_shared<DataAbilityResult>(*operation->GetUri(), ++lastId_));
+        }
+        return results;
+    }
+
+    int lastId_ = 0;
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations_;
+};
+
 class AbilitySchedulerStubTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -216,5 +245,100 @@ HWTEST_F(AbilitySchedulerStubTest, AbilitySchedulerStub_008, TestSize.Level0)
     auto res = stub_->OnRemoteRequest(INT_MAX, data, reply, option);
     EXPECT_NE(res, NO_ERROR);
 }
+
+/*
+ * Feature: AbilitySchedulerStub
+ * Function: ExecuteBatch
+ * SubFunction: NA
+ * FunctionPoints: AbilitySchedulerProxy ExecuteBatch, AbilitySchedulerStub ExecuteBatchInner
+ * EnvConditions: NA
+ * CaseDescription: Verify the operations and results of a batch survive one round trip
+ */
+HWTEST_F(AbilitySchedulerStubTest, AbilitySchedulerStub_009, TestSize.Level0)
+{
+    sptr<BatchAbilitySchedulerStubMock> stub = new BatchAbilitySchedulerStubMock();
+    sptr<AbilitySchedulerProxy> proxy = new AbilitySchedulerProxy(stub);
+    std::shared_ptr<Uri> uri = std::make_shared<Uri>(BATCH_URI);
+
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+    operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->Build());
+    operations.emplace_back(DataAbilityOperation::NewDeleteBuilder(uri)
+                                ->WithPredicatesBackReference(0, 0)
+                                ->WithExpectedCount(1)
+                                ->WithInterruptionAllowed(true)
+                                ->Build());
+    auto results = proxy->ExecuteBatch(operations);
+
+    ASSERT_EQ(stub->operations_.size(), operations.size());
+    EXPECT_TRUE(stub->operations_[0]->IsInsertOperation());
+    EXPECT_EQ(stub->operations_[0]->GetUri()->ToString(), BATCH_URI);
+    EXPECT_TRUE(stub->operations_[1]->IsDeleteOperation());
+    EXPECT_EQ(stub->operations_[1]->GetExpectedCount(), 1);
+    EXPECT_TRUE(stub->operations_[1]->IsInterruptionAllowed());
+    EXPECT_EQ(stub->operations_[1]->GetDataAbilityPredicatesBackReferences().size(), 1);
+
+    ASSERT_EQ(results.size(), operations.size());
+    EXPECT_EQ(results[1]->GetCount(), 2);
+    EXPECT_EQ(results[1]->GetUri().ToString(), BATCH_URI);
+}
+
+/*
+ * Feature: AbilitySchedulerStub
+ * Function: ExecuteBatch
+ * SubFunction: NA
+ * FunctionPoints: AbilitySchedulerProxy ExecuteBatch, AbilitySchedulerProxy Insert
+ * EnvConditions: NA
+ * CaseDescription: Benchmark 1000 single inserts against one batch of 1000 insert operations
+ */
+HWTEST_F(AbilitySchedulerStubTest, AbilitySchedulerStub_010, TestSize.Level1)
+{
+    sptr<BatchAbilitySchedulerStubMock> stub = new BatchAbilitySchedulerStubMock();
+    sptr<AbilitySchedulerProxy> proxy = new AbilitySchedulerProxy(stub);
+    std::shared_ptr<Uri> uri = std::make_shared<Uri>(BATCH_URI);
+    ValuesBucket value("value");
+
+    auto singleStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        proxy->Insert(*uri, value);
+    }
+    auto singleCost = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - singleStart).count();
+    EXPECT_EQ(stub->lastId_, BATCH_SIZE);
+
+    std::vector<std::shared_ptr<DataAbilityOperation>> operations;
+    std::shared_ptr<ValuesBucket> values = std::make_shared<ValuesBucket>(value);
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        operations.emplace_back(DataAbilityOperation::NewInsertBuilder(uri)->WithValuesBucket(values)->Build());
+    }
+    auto batchStart = std::chrono::steady_clock::now();
+    auto results = proxy->ExecuteBatch(operations);
+    auto batchCost = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - batchStart).count();
+    EXPECT_EQ(results.size(), static_cast<size_t>(BATCH_SIZE));
+
+    GTEST_LOG_(INFO) << BATCH_SIZE << " single inserts cost " << singleCost << " us, one batch costs " << batchCost
+                     << " us";
+}
+
+/*
+ * Feature: AbilitySchedulerStub
+ * Function: ExecuteBatch
+ * SubFunction: NA
+ * FunctionPoints: AbilitySchedulerStub ExecuteBatchInner
+ * EnvConditions: NA
+ * CaseDescription: Verify a batch count larger than the parcel is rejected before any operation is read
+ */
+HWTEST_F(AbilitySchedulerStubTest, AbilitySchedulerStub_011, TestSize.Level1)
+{
+    sptr<BatchAbilitySchedulerStubMock> stub = new BatchAbilitySchedulerStubMock();
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    WriteInterfaceToken(data);
+    data.WriteInt32(INT_MAX);
+    auto res = stub->OnRemoteRequest(IAbilityScheduler::SCHEDULE_EXECUTEBATCH, data, reply, option);
+    EXPECT_EQ(res, ERR_INVALID_VALUE);
+    EXPECT_TRUE(stub->operations_.empty());
+}
 }  // namespace AAFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 
 #define private public
@@ -28,6 +30,7 @@
 #include "system_ability_definition.h"
 #include "ability_manager_errors.h"
 #include "ability_scheduler.h"
+#include "ability_scheduler_proxy.h"
 #include "mock_ability_connect_callback.h"
 #include "ability_scheduler_mock.h"
 
@@ -2131,6 +2134,247 @@ HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_060, TestSize.
     EXPECT_EQ(ERR_OK, result1);
 }
 
+/*
+ * Feature: AbilityStackManager
+ * Function:  GetRecentMissions
+ * SubFunction: NA
+ * FunctionPoints: GetStackModel
+ * EnvConditions: NA
+ * CaseDescription: the queries share the published model until the stacks are changed
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_061, TestSize.Level1)
+{
+    stackManager_->Init();
+    auto result = stackManager_->StartAbility(musicAbilityRequest_);
+    EXPECT_EQ(ERR_OK, result);
+    auto musicAbility = stackManager_->GetCurrentTopAbility();
+    musicAbility->SetAbilityState(OHOS::AAFwk::ACTIVE);
+
+    std::vector<AbilityMissionInfo> info;
+    result = stackManager_->GetRecentMissions(10, 1, info);
+    EXPECT_EQ(ERR_OK, result);
+    EXPECT_EQ(static_cast<int>(info.size()), 1);
+    auto stackModel = stackManager_->GetStackModel();
+    EXPECT_EQ(stackModel, stackManager_->GetStackModel());
+    EXPECT_TRUE(stackManager_->IsFirstInMission(musicAbility->GetToken()));
+
+    result = stackManager_->StartAbility(radioAbilityRequest_);
+    EXPECT_EQ(ERR_OK, result);
+    auto radioAbility = stackManager_->GetCurrentTopAbility();
+    radioAbility->SetAbilityState(OHOS::AAFwk::ACTIVE);
+    EXPECT_NE(stackModel, stackManager_->GetStackModel());
+    EXPECT_TRUE(stackManager_->IsFirstInMission(musicAbility->GetToken()));
+    EXPECT_FALSE(stackManager_->IsFirstInMission(radioAbility->GetToken()));
+
+    StackInfo stackInfo;
+    stackManager_->GetAllStackInfo(stackInfo);
+    EXPECT_EQ(static_cast<int>(stackInfo.missionStackInfos.size()), 2);
+    for (const auto &missionStackInfo : stackInfo.missionStackInfos) {
+        if (missionStackInfo.id == AbilityStackManager::DEFAULT_MISSION_STACK_ID) {
+            ASSERT_EQ(static_cast<int>(missionStackInfo.missionRecords.size()), 1);
+            EXPECT_EQ(static_cast<int>(missionStackInfo.missionRecords[0].abilityRecordInfos.size()), 2);
+        }
+    }
+
+    MissionDescriptionInfo description;
+    description.label = "radio";
+    EXPECT_EQ(ERR_OK, stackManager_->SetMissionDescriptionInfo(radioAbility, description));
+    info.clear();
+    result = stackManager_->GetRecentMissions(1, 1, info);
+    EXPECT_EQ(ERR_OK, result);
+    EXPECT_EQ(static_cast<int>(info.size()), 1);
+    EXPECT_EQ("radio", info[0].missionDescription.label);
+}
+
+/*
+ * Feature: AbilityStackManager
+ * Function:  GetRecentMissions
+ * SubFunction: NA
+ * FunctionPoints: GetStackModel
+ * EnvConditions: NA
+ * CaseDescription: measure polling the recent missions while the stacks are not changed
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_062, TestSize.Level3)
+{
+    stackManager_->Init();
+    EXPECT_EQ(ERR_OK, stackManager_->StartAbility(musicAbilityRequest_));
+    stackManager_->GetCurrentTopAbility()->SetAbilityState(OHOS::AAFwk::ACTIVE);
+    EXPECT_EQ(ERR_OK, stackManager_->StartAbility(radioAbilityRequest_));
+
+    constexpr int rounds = 10000;
+    auto begin = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        std::vector<AbilityMissionInfo> info;
+        EXPECT_EQ(ERR_OK, stackManager_->GetRecentMissions(10, 1, info));
+        EXPECT_EQ(static_cast<int>(info.size()), 1);
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    GTEST_LOG_(INFO) << "get recent missions " << rounds << " times: " << cost.count() << " us";
+}
+
+/*
+ * Feature: AbilityStackManager
+ * Function:  StartAbilities
+ * SubFunction: NA
+ * FunctionPoints: StartAbilities
+ * EnvConditions: NA
+ * CaseDescription: the abilities are pushed in order, the current top hands over to the last one directly
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_063, TestSize.Level1)
+{
+    stackManager_->Init();
+    EXPECT_EQ(ERR_INVALID_VALUE, stackManager_->StartAbilities(std::vector<AbilityRequest>()));
+    auto result = stackManager_->StartAbility(launcherAbilityRequest_);
+    EXPECT_EQ(ERR_OK, result);
+    auto launcherAbility = stackManager_->GetCurrentTopAbility();
+    launcherAbility->SetAbilityState(OHOS::AAFwk::ACTIVE);
+
+    std::vector<AbilityRequest> abilityRequests = {musicAbilityRequest_,
+        radioAbilityRequest_,
+        musicTopAbilityRequest_,
+        radioAbilityRequest_,
+        musicAbilityRequest_};
+    result = stackManager_->StartAbilities(abilityRequests);
+    EXPECT_EQ(ERR_OK, result);
+
+    auto topAbility = stackManager_->GetCurrentTopAbility();
+    ASSERT_TRUE(topAbility);
+    EXPECT_EQ("MusicAbility", topAbility->GetAbilityInfo().name);
+    auto missionRecord = topAbility->GetMissionRecord();
+    ASSERT_TRUE(missionRecord);
+    EXPECT_EQ(static_cast<int>(abilityRequests.size()), missionRecord->GetAbilityRecordCount());
+    EXPECT_EQ(launcherAbility->GetNextAbilityRecord(), topAbility);
+    EXPECT_EQ(topAbility->GetPreAbilityRecord(), launcherAbility);
+
+    // the abilities below the top one are not scheduled until they are returned to.
+    auto bottomAbility = missionRecord->GetBottomAbilityRecord();
+    ASSERT_TRUE(bottomAbility);
+    EXPECT_EQ("MusicAbility", bottomAbility->GetAbilityInfo().name);
+    EXPECT_TRUE(bottomAbility->IsAbilityState(OHOS::AAFwk::INITIAL));
+    EXPECT_FALSE(bottomAbility->IsReady());
+
+    // the top ability is not active yet, the next batch waits.
+    result = stackManager_->StartAbilities({radioAbilityRequest_, musicAbilityRequest_});
+    EXPECT_EQ(START_ABILITY_WAITING, result);
+    EXPECT_EQ(static_cast<int>(abilityRequests.size()), missionRecord->GetAbilityRecordCount());
+    EXPECT_FALSE(stackManager_->waittingAbilityQueue_.IsEmpty());
+}
+
+/*
+ * Feature: AbilityStackManager
+ * Function:  StartAbilities
+ * SubFunction: NA
+ * FunctionPoints: StartAbilities
+ * EnvConditions: NA
+ * CaseDescription: measure a start chain of 5 abilities, started one by one and started together
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_064, TestSize.Level3)
+{
+    constexpr int rounds = 100;
+    std::vector<AbilityRequest> abilityRequests = {musicAbilityRequest_,
+        radioAbilityRequest_,
+        musicTopAbilityRequest_,
+        radioAbilityRequest_,
+        musicAbilityRequest_};
+    auto prepare = []() {
+        auto stackManager = std::make_shared<AbilityStackManager>(0);
+        stackManager->Init();
+        return stackManager;
+    };
+
+    std::chrono::microseconds oneByOneCost(0);
+    std::chrono::microseconds togetherCost(0);
+    for (int round = 0; round < rounds; round++) {
+        auto stackManager = prepare();
+        stackManager->StartAbility(launcherAbilityRequest_);
+        stackManager->GetCurrentTopAbility()->SetAbilityState(OHOS::AAFwk::ACTIVE);
+        auto begin = std::chrono::steady_clock::now();
+        for (const auto &abilityRequest : abilityRequests) {
+            EXPECT_EQ(ERR_OK, stackManager->StartAbility(abilityRequest));
+            // each ability has to be active before the next one is started.
+            stackManager->GetCurrentTopAbility()->SetAbilityState(OHOS::AAFwk::ACTIVE);
+        }
+        oneByOneCost += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+        stackManager = prepare();
+        stackManager->StartAbility(launcherAbilityRequest_);
+        stackManager->GetCurrentTopAbility()->SetAbilityState(OHOS::AAFwk::ACTIVE);
+        begin = std::chrono::steady_clock::now();
+        EXPECT_EQ(ERR_OK, stackManager->StartAbilities(abilityRequests));
+        togetherCost += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    }
+    GTEST_LOG_(INFO) << "start 5 abilities one by one: " << oneByOneCost.count() / rounds << " us, "
+                     << abilityRequests.size() << " lifecycles";
+    GTEST_LOG_(INFO) << "start 5 abilities together: " << togetherCost.count() / rounds << " us, 1 lifecycle";
+}
+
+/*
+ * Feature: AbilityStackManager
+ * Function: StartAbility
+ * SubFunction: NA
+ * FunctionPoints: a stalled app does not stall the ability manager
+ * EnvConditions: NA
+ * CaseDescription: the top ability belongs to a stalled app, the start inactivating it under the stack lock returns
+ *                  at once, and the other starts waiting for the lock proceed
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_065, TestSize.Level1)
+{
+    stackManager_->Init();
+    EXPECT_EQ(ERR_OK, stackManager_->StartAbility(launcherAbilityRequest_));
+    auto launcherAbility = stackManager_->GetCurrentTopAbility();
+    ASSERT_NE(launcherAbility, nullptr);
+    launcherAbility->SetAbilityState(OHOS::AAFwk::ACTIVE);
+
+    // a sync request to the app would hold the stack lock for STALL_TIME.
+    OHOS::sptr<AbilitySchedulerMock> stalledApp(new AbilitySchedulerMock());
+    EXPECT_CALL(*stalledApp, SendRequest(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly(testing::Invoke(stalledApp.GetRefPtr(), &AbilitySchedulerMock::InvokeStalledSendRequest));
+    launcherAbility->SetScheduler(new AbilitySchedulerProxy(stalledApp));
+
+    constexpr int startCount = 10;
+    auto begin = std::chrono::steady_clock::now();
+    std::thread stalledStart([this]() {
+        int result = stackManager_->StartAbility(musicAbilityRequest_);
+        EXPECT_TRUE(result == ERR_OK || result == START_ABILITY_WAITING);
+    });
+    for (int i = 0; i < startCount; i++) {
+        int result = stackManager_->StartAbility(radioAbilityRequest_);
+        EXPECT_TRUE(result == ERR_OK || result == START_ABILITY_WAITING);
+    }
+    stalledStart.join();
+    auto cost = std::chrono::steady_clock::now() - begin;
+
+    // whichever start came first inactivated the stalled app, one way.
+    EXPECT_EQ(OHOS::AAFwk::INACTIVATING, launcherAbility->GetAbilityState());
+    EXPECT_EQ(IAbilityScheduler::SCHEDULE_ABILITY_TRANSACTION, stalledApp->code_);
+    EXPECT_EQ(MessageOption::TF_ASYNC, stalledApp->flags_);
+    EXPECT_LT(cost, std::chrono::seconds(AbilitySchedulerMock::STALL_TIME));
+}
+
+/*
+ * Feature: AbilityStackManager
+ * Function:  CheckStartAbilities
+ * SubFunction: NA
+ * FunctionPoints: CheckStartAbilities
+ * EnvConditions: NA
+ * CaseDescription: the pages refused by the locked mission are refused by the check, and nothing is pushed
+ */
+HWTEST_F(AbilityStackManagerTest, ability_stack_manager_operating_066, TestSize.Level1)
+{
+    stackManager_->Init();
+    EXPECT_EQ(ERR_OK, stackManager_->StartAbility(launcherAbilityRequest_));
+    stackManager_->GetCurrentTopAbility()->SetAbilityState(OHOS::AAFwk::ACTIVE);
+    auto launcherMissionRecord = stackManager_->GetTopMissionRecord();
+    ASSERT_TRUE(launcherMissionRecord);
+    EXPECT_EQ(ERR_OK, stackManager_->CheckStartAbilities({musicAbilityRequest_, radioAbilityRequest_}));
+
+    EXPECT_EQ(ERR_OK, stackManager_->StartLockMission(1000, launcherMissionRecord->GetMissionRecordId(), true, true));
+    EXPECT_EQ(LOCK_MISSION_STATE_DENY_REQUEST,
+        stackManager_->CheckStartAbilities({musicAbilityRequest_, radioAbilityRequest_}));
+    EXPECT_EQ(1, launcherMissionRecord->GetAbilityRecordCount());
+    EXPECT_EQ(launcherMissionRecord, stackManager_->GetTopMissionRecord());
+}
+
 /*
  * Feature: AbilityStackManager
  * Function:  SetMissionDescriptionInfo
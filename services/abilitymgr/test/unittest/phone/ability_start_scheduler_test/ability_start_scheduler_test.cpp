@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "ability_config.h"
+#include "ability_manager_errors.h"
+#include "ability_start_scheduler.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+class AbilityStartSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    AbilityRequest MakeRequest(const std::string &bundleName, const std::string &abilityName,
+        const std::string &action = "", int requestCode = -1,
+        AppExecFwk::LaunchMode launchMode = AppExecFwk::LaunchMode::SINGLETON) const;
+};
+
+void AbilityStartSchedulerTest::SetUpTestCase(void)
+{}
+void AbilityStartSchedulerTest::TearDownTestCase(void)
+{}
+void AbilityStartSchedulerTest::SetUp(void)
+{}
+void AbilityStartSchedulerTest::TearDown(void)
+{}
+
+AbilityRequest AbilityStartSchedulerTest::MakeRequest(const std::string &bundleName, const std::string &abilityName,
+    const std::string &action, int requestCode, AppExecFwk::LaunchMode launchMode) const
+{
+    AbilityRequest request;
+    request.want.SetElementName(bundleName, abilityName);
+    request.want.SetAction(action);
+    request.abilityInfo.bundleName = bundleName;
+    request.abilityInfo.name = abilityName;
+    request.requestCode = requestCode;
+    request.abilityInfo.launchMode = launchMode;
+    return request;
+}
+
+/*
+ * Feature: AbilityStartScheduler
+ * Function: Enqueue
+ * SubFunction: NA
+ * FunctionPoints: collapse repeated starts
+ * EnvConditions: NA
+ * CaseDescription: repeated identical starts of a singleton ability keep one place, starts with another want,
+ *                  starts of a standard ability and for-result starts are kept apart.
+ */
+HWTEST_F(AbilityStartSchedulerTest, Enqueue_001, TestSize.Level0)
+{
+    AbilityStartScheduler scheduler;
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility", "first")));
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiRadio", "RadioAbility")));
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility", "first")));
+    EXPECT_EQ(2u, scheduler.GetSize());
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility", "second")));
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility", "result", 0)));
+    AbilityRequest standard = MakeRequest("com.ix.hiVideo", "VideoAbility", "", -1, AppExecFwk::LaunchMode::STANDARD);
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(standard));
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(standard));
+    EXPECT_EQ(6u, scheduler.GetSize());
+
+    AbilityRequest request;
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("MusicAbility", request.abilityInfo.name);
+    EXPECT_EQ("first", request.want.GetAction());
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("RadioAbility", request.abilityInfo.name);
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("second", request.want.GetAction());
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("result", request.want.GetAction());
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("VideoAbility", request.abilityInfo.name);
+    EXPECT_FALSE(scheduler.Dequeue(request));
+    EXPECT_TRUE(scheduler.IsEmpty());
+
+    // the dequeued ability is not collapsed any more.
+    scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility"));
+    EXPECT_EQ(1u, scheduler.GetSize());
+}
+
+/*
+ * Feature: AbilityStartScheduler
+ * Function: Dequeue
+ * SubFunction: NA
+ * FunctionPoints: system ui and launcher starts go first
+ * EnvConditions: NA
+ * CaseDescription: high priority starts are dequeued before normal ones, each priority in order.
+ */
+HWTEST_F(AbilityStartSchedulerTest, Dequeue_001, TestSize.Level0)
+{
+    AbilityStartScheduler scheduler;
+    AbilityRequest launcher = MakeRequest("com.ix.hiworld", "MainAbility");
+    launcher.abilityInfo.applicationInfo.isLauncherApp = true;
+    EXPECT_EQ(AbilityStartScheduler::PRIORITY_HIGH, AbilityStartScheduler::GetPriority(launcher));
+
+    scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility"));
+    scheduler.Enqueue(MakeRequest(AbilityConfig::SYSTEM_UI_BUNDLE_NAME, AbilityConfig::SYSTEM_UI_STATUS_BAR));
+    scheduler.Enqueue(MakeRequest("com.ix.hiRadio", "RadioAbility"));
+    scheduler.Enqueue(launcher);
+
+    std::vector<std::string> order;
+    AbilityRequest request;
+    while (scheduler.Dequeue(request)) {
+        order.emplace_back(request.abilityInfo.name);
+    }
+    std::vector<std::string> expected = {
+        AbilityConfig::SYSTEM_UI_STATUS_BAR, "MainAbility", "MusicAbility", "RadioAbility" };
+    EXPECT_EQ(expected, order);
+}
+
+/*
+ * Feature: AbilityStartScheduler
+ * Function: Enqueue
+ * SubFunction: NA
+ * FunctionPoints: bounded queue
+ * EnvConditions: NA
+ * CaseDescription: starts of any priority are rejected when full, the waiting starts are kept.
+ */
+HWTEST_F(AbilityStartSchedulerTest, Enqueue_002, TestSize.Level0)
+{
+    AbilityStartScheduler scheduler(2);
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility")));
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiRadio", "RadioAbility")));
+    EXPECT_EQ(START_ABILITY_QUEUE_FULL, scheduler.Enqueue(MakeRequest("com.ix.hiVideo", "VideoAbility")));
+    // a waiting ability is still collapsed when full.
+    EXPECT_EQ(START_ABILITY_WAITING, scheduler.Enqueue(MakeRequest("com.ix.hiRadio", "RadioAbility")));
+
+    EXPECT_EQ(START_ABILITY_QUEUE_FULL, scheduler.Enqueue(
+        MakeRequest(AbilityConfig::SYSTEM_UI_BUNDLE_NAME, AbilityConfig::SYSTEM_UI_STATUS_BAR)));
+    EXPECT_EQ(2u, scheduler.GetSize());
+
+    AbilityRequest request;
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("MusicAbility", request.abilityInfo.name);
+    EXPECT_TRUE(scheduler.Dequeue(request));
+    EXPECT_EQ("RadioAbility", request.abilityInfo.name);
+    EXPECT_TRUE(scheduler.IsEmpty());
+}
+
+/*
+ * Feature: AbilityStartScheduler
+ * Function: Dump
+ * SubFunction: NA
+ * FunctionPoints: dump statistics and waiting starts
+ * EnvConditions: NA
+ * CaseDescription: the dump shows the counters and every waiting start.
+ */
+HWTEST_F(AbilityStartSchedulerTest, Dump_001, TestSize.Level0)
+{
+    AbilityStartScheduler scheduler;
+    scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility"));
+    scheduler.Enqueue(MakeRequest("com.ix.hiMusic", "MusicAbility"));
+    scheduler.Enqueue(MakeRequest("com.ix.hiRadio", "RadioAbility"));
+    AbilityRequest request;
+    scheduler.Dequeue(request);
+
+    std::vector<std::string> info;
+    scheduler.Dump(info);
+    ASSERT_FALSE(info.empty());
+    EXPECT_NE(std::string::npos, info[0].find("waiting #1  started #1  coalesced #1  rejected #0"));
+    auto isRadio = [](const std::string &line) { return line.find("RadioAbility") != std::string::npos; };
+    EXPECT_NE(info.end(), std::find_if(info.begin(), info.end(), isRadio));
+
+    scheduler.Clear();
+    EXPECT_TRUE(scheduler.IsEmpty());
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "ability_manager_service.h"
+#include "ability_record.h"
+#include "ability_timeout_scheduler.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t TEST_MSG = 7;
+constexpr int64_t MARGIN = 10 * AbilityTimeoutScheduler::TICK;
+}  // namespace
+
+class AbilityTimeoutSchedulerTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<AbilityRecord> MakeAbilityRecord(const std::string &bundleName, const std::string &name) const;
+
+    std::shared_ptr<AbilityTimeoutScheduler> scheduler_;
+    std::vector<std::pair<uint32_t, std::shared_ptr<AbilityRecord>>> fired_;
+};
+
+void AbilityTimeoutSchedulerTest::SetUpTestCase(void)
+{}
+void AbilityTimeoutSchedulerTest::TearDownTestCase(void)
+{}
+void AbilityTimeoutSchedulerTest::SetUp(void)
+{
+    fired_.clear();
+    // without handler, the wheel is advanced by the test.
+    scheduler_ = std::make_shared<AbilityTimeoutScheduler>(
+        nullptr, [this](uint32_t msgId, const std::shared_ptr<AbilityRecord> &abilityRecord) {
+            fired_.emplace_back(msgId, abilityRecord);
+        });
+}
+void AbilityTimeoutSchedulerTest::TearDown(void)
+{
+    scheduler_.reset();
+}
+
+std::shared_ptr<AbilityRecord> AbilityTimeoutSchedulerTest::MakeAbilityRecord(
+    const std::string &bundleName, const std::string &name) const
+{
+    Want want;
+    AppExecFwk::AbilityInfo abilityInfo;
+    abilityInfo.bundleName = bundleName;
+    abilityInfo.name = name;
+    AppExecFwk::ApplicationInfo applicationInfo;
+    return std::make_shared<AbilityRecord>(want, abilityInfo, applicationInfo);
+}
+
+/*
+ * Feature: AbilityTimeoutScheduler
+ * Function: Arm
+ * SubFunction: NA
+ * FunctionPoints: arm a timeout with task
+ * EnvConditions: NA
+ * CaseDescription: the task runs once the timeout is due, not before.
+ */
+HWTEST_F(AbilityTimeoutSchedulerTest, Arm_001, TestSize.Level0)
+{
+    int count = 0;
+    int64_t now = AbilityTimeoutScheduler::GetCurrentTime();
+    auto handle = scheduler_->Arm(nullptr, TEST_MSG, AbilityManagerService::INACTIVE_TIMEOUT, [&count]() { count++; });
+    EXPECT_NE(AbilityTimeoutScheduler::INVALID_HANDLE, handle);
+    EXPECT_EQ(1u, scheduler_->GetPendingCount());
+
+    scheduler_->Advance(now + AbilityManagerService::INACTIVE_TIMEOUT - MARGIN);
+    EXPECT_EQ(0, count);
+    scheduler_->Advance(now + AbilityManagerService::INACTIVE_TIMEOUT + MARGIN);
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(0u, scheduler_->GetPendingCount());
+    EXPECT_TRUE(fired_.empty());
+}
+
+/*
+ * Feature: AbilityTimeoutScheduler
+ * Function: Cancel
+ * SubFunction: NA
+ * FunctionPoints: cancel a pending timeout
+ * EnvConditions: NA
+ * CaseDescription: a cancelled timeout never fires and can not be cancelled again.
+ */
+HWTEST_F(AbilityTimeoutSchedulerTest, Cancel_001, TestSize.Level0)
+{
+    auto abilityRecord = MakeAbilityRecord("com.ix.hiMusic", "MusicAbility");
+    int64_t now = AbilityTimeoutScheduler::GetCurrentTime();
+    auto first = scheduler_->Arm(abilityRecord, TEST_MSG, AbilityManagerService::LOAD_TIMEOUT);
+    auto second = scheduler_->Arm(abilityRecord, TEST_MSG + 1, AbilityManagerService::LOAD_TIMEOUT);
+    EXPECT_NE(first, second);
+
+    EXPECT_TRUE(scheduler_->Cancel(first));
+    EXPECT_FALSE(scheduler_->Cancel(first));
+    EXPECT_FALSE(scheduler_->Cancel(AbilityTimeoutScheduler::INVALID_HANDLE));
+    EXPECT_EQ(1u, scheduler_->GetPendingCount());
+
+    scheduler_->Advance(now + AbilityManagerService::LOAD_TIMEOUT + MARGIN);
+    ASSERT_EQ(1u, fired_.size());
+    EXPECT_EQ(TEST_MSG + 1, fired_[0].first);
+    EXPECT_EQ(abilityRecord, fired_[0].second);
+    EXPECT_FALSE(scheduler_->Cancel(second));
+}
+
+/*
+ * Feature: AbilityTimeoutScheduler
+ * Function: Advance
+ * SubFunction: NA
+ * FunctionPoints: the ability record is released before the timeout
+ * EnvConditions: NA
+ * CaseDescription: the timeout does not keep the ability record alive and does not fire for it.
+ */
+HWTEST_F(AbilityTimeoutSchedulerTest, Advance_001, TestSize.Level0)
+{
+    auto abilityRecord = MakeAbilityRecord("com.ix.hiMusic", "MusicAbility");
+    int64_t now = AbilityTimeoutScheduler::GetCurrentTime();
+    scheduler_->Arm(abilityRecord, TEST_MSG, AbilityManagerService::ACTIVE_TIMEOUT);
+    abilityRecord.reset();
+
+    scheduler_->Advance(now + AbilityManagerService::ACTIVE_TIMEOUT + MARGIN);
+    EXPECT_TRUE(fired_.empty());
+    EXPECT_EQ(0u, scheduler_->GetPendingCount());
+}
+
+/*
+ * Feature: AbilityTimeoutScheduler
+ * Function: Advance
+ * SubFunction: NA
+ * FunctionPoints: timeouts on every level of the wheel
+ * EnvConditions: NA
+ * CaseDescription: the timeouts cascade down the wheel and fire in order at their time.
+ */
+HWTEST_F(AbilityTimeoutSchedulerTest, Advance_002, TestSize.Level0)
+{
+    std::vector<uint32_t> order;
+    const std::vector<uint32_t> timeouts = { 300000, 100, 10000 };
+    int64_t now = AbilityTimeoutScheduler::GetCurrentTime();
+    for (auto timeout : timeouts) {
+        scheduler_->Arm(nullptr, TEST_MSG, timeout, [&order, timeout]() { order.emplace_back(timeout); });
+    }
+
+    scheduler_->Advance(now + 100 + MARGIN);
+    EXPECT_EQ(std::vector<uint32_t>({ 100 }), order);
+    scheduler_->Advance(now + 10000 - MARGIN);
+    EXPECT_EQ(1u, order.size());
+    scheduler_->Advance(now + 10000 + MARGIN);
+    EXPECT_EQ(std::vector<uint32_t>({ 100, 10000 }), order);
+    scheduler_->Advance(now + 300000 - MARGIN);
+    EXPECT_EQ(2u, order.size());
+    scheduler_->Advance(now + 300000 + MARGIN);
+    EXPECT_EQ(std::vector<uint32_t>({ 100, 10000, 300000 }), order);
+    EXPECT_EQ(0u, scheduler_->GetPendingCount());
+}
+
+/*
+ * Feature: AbilityTimeoutScheduler
+ * Function: Dump
+ * SubFunction: NA
+ * FunctionPoints: dump the pending timeouts
+ * EnvConditions: NA
+ * CaseDescription: every pending timeout is dumped with its ability.
+ */
+HWTEST_F(AbilityTimeoutSchedulerTest, Dump_001, TestSize.Level0)
+{
+    auto abilityRecord = MakeAbilityRecord("com.ix.hiMusic", "MusicAbility");
+    scheduler_->Arm(abilityRecord, TEST_MSG, AbilityManagerService::LOAD_TIMEOUT);
+    scheduler_->Arm(abilityRecord, TEST_MSG, AbilityManagerService::ACTIVE_TIMEOUT);
+
+    std::vector<std::string> info;
+    scheduler_->Dump(info);
+    ASSERT_EQ(4u, info.size());
+    EXPECT_NE(std::string::npos, info[1].find("pending #2"));
+    EXPECT_NE(std::string::npos, info[2].find("com.ix.hiMusic/MusicAbility"));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
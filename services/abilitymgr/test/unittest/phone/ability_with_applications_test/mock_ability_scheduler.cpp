@@ -104,5 +104,11 @@ int AbilityScheduler::BatchInsert(const Uri &uri, const std::vector<ValuesBucket
     return -1;
 }
 
+std::vector<std::shared_ptr<DataAbilityResult>> AbilityScheduler::ExecuteBatch(
+    const std::vector<std::shared_ptr<DataAbilityOperation>> &operations)
+{
+    return std::vector<std::shared_ptr<DataAbilityResult>>();
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
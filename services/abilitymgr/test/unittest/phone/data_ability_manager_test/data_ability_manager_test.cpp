@@ -13,8 +13,10 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #define private public
@@ -477,5 +479,77 @@ HWTEST_F(DataAbilityManagerTest, AaFwk_DataAbilityManager_GetAbilityRecordById_0
 
     HILOG_INFO("AaFwk_DataAbilityManager_GetAbilityRecordById_001 end.");
 }
+
+/*
+ * Feature: AbilityManager
+ * Function: DataAbility
+ * SubFunction: Acquire
+ * FunctionPoints: Concurrent acquire of a slow data ability.
+ * EnvConditions: Can run ohos test framework
+ * CaseDescription: Verify 64 clients share one load of a slow data ability, and the manager is not blocked
+ *                  while the data ability is loading.
+ */
+HWTEST_F(DataAbilityManagerTest, AaFwk_DataAbilityManager_Acquire_Stress_001, TestSize.Level1)
+{
+    HILOG_INFO("AaFwk_DataAbilityManager_Acquire_Stress_001 start.");
+
+    constexpr int clientCount = 64;
+    constexpr auto loadDelay = 500ms;
+    std::shared_ptr<DataAbilityManager> dataAbilityManager = std::make_shared<DataAbilityManager>();
+    DelayedSingleton<AppScheduler>::GetInstance()->appMgrClient_ = std::make_unique<MockAppMgrClient>();
+    EXPECT_CALL(*abilitySchedulerMock_, ScheduleAbilityTransaction(_, _)).Times(1);
+
+    std::atomic_int acquired(0);
+    std::vector<std::thread> clients;
+    for (int i = 0; i < clientCount; i++) {
+        clients.emplace_back([this, &dataAbilityManager, &acquired]() {
+            if (dataAbilityManager->Acquire(abilityRequest_, true, abilityRecordClient_->GetToken()) != nullptr) {
+                acquired++;
+            }
+        });
+    }
+
+    // mock a slow data ability, which attaches after 'loadDelay'.
+    sptr<IRemoteObject> token;
+    while (token == nullptr) {
+        std::this_thread::sleep_for(1ms);
+        std::lock_guard<std::mutex> locker(dataAbilityManager->mutex_);
+        if (!dataAbilityManager->dataAbilityRecordsLoading_.empty()) {
+            token = dataAbilityManager->dataAbilityRecordsLoading_.begin()->second->GetToken();
+        }
+    }
+    auto loadStart = steady_clock::now();
+
+    // the manager must serve other requests while the data ability is loading.
+    dataAbilityManager->Dump(__func__, __LINE__);
+    EXPECT_EQ(dataAbilityManager->GetAbilityRecordById(-1), nullptr);
+    EXPECT_LT(steady_clock::now() - loadStart, 100ms);
+
+    std::this_thread::sleep_for(loadDelay);
+    EXPECT_EQ(acquired.load(), 0);
+    EXPECT_EQ(dataAbilityManager->AttachAbilityThread(abilitySchedulerMock_, token), ERR_OK);
+    EXPECT_EQ(dataAbilityManager->AbilityTransitionDone(token, ACTIVE), ERR_OK);
+
+    for (auto &client : clients) {
+        client.join();
+    }
+    auto cost = duration_cast<milliseconds>(steady_clock::now() - loadStart).count();
+    GTEST_LOG_(INFO) << "clients: " << clientCount << ", acquire cost(ms): " << cost;
+
+    EXPECT_EQ(acquired.load(), clientCount);
+    EXPECT_EQ(dataAbilityManager->dataAbilityRecordsLoaded_.size(), 1u);
+    EXPECT_TRUE(dataAbilityManager->dataAbilityRecordsLoading_.empty());
+    auto dataAbilityRecord = dataAbilityManager->dataAbilityRecordsLoaded_.begin()->second;
+    EXPECT_EQ(dataAbilityRecord->GetClientCount(abilityRecordClient_), static_cast<size_t>(clientCount));
+
+    // acquiring a loaded data ability does not wait.
+    auto start = steady_clock::now();
+    EXPECT_NE(dataAbilityManager->Acquire(abilityRequest_, true, abilityRecordClient_->GetToken()), nullptr);
+    EXPECT_LT(steady_clock::now() - start, 100ms);
+
+    dataAbilityManager->OnAbilityDied(dataAbilityRecord->GetAbilityRecord());
+
+    HILOG_INFO("AaFwk_DataAbilityManager_Acquire_Stress_001 end.");
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -154,10 +154,9 @@ HWTEST_F(DataAbilityRecordTest, AaFwk_DataAbilityRecord_WaitForLoaded_001, TestS
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_001 start.");
 
     std::unique_ptr<DataAbilityRecord> dataAbilityRecord = std::make_unique<DataAbilityRecord>(abilityRequest_);
-    std::mutex mutex;
     system_clock::duration timeout = 800ms;
 
-    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(mutex, timeout), ERR_INVALID_STATE);
+    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(timeout), ERR_INVALID_STATE);
 
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_001 end.");
 }
@@ -175,11 +174,10 @@ HWTEST_F(DataAbilityRecordTest, AaFwk_DataAbilityRecord_WaitForLoaded_002, TestS
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_002 start.");
 
     std::unique_ptr<DataAbilityRecord> dataAbilityRecord = std::make_unique<DataAbilityRecord>(abilityRequest_);
-    std::mutex mutex;
     system_clock::duration timeout = 800ms;
 
     EXPECT_EQ(dataAbilityRecord->StartLoading(), ERR_OK);
-    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(mutex, timeout), ERR_TIMED_OUT);
+    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(timeout), ERR_TIMED_OUT);
 
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_002 end.");
 }
@@ -197,7 +195,6 @@ HWTEST_F(DataAbilityRecordTest, AaFwk_DataAbilityRecord_WaitForLoaded_003, TestS
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_003 start.");
 
     std::unique_ptr<DataAbilityRecord> dataAbilityRecord = std::make_unique<DataAbilityRecord>(abilityRequest_);
-    std::mutex mutex;
     system_clock::duration timeout = 800ms;
 
     EXPECT_EQ(dataAbilityRecord->StartLoading(), ERR_OK);
@@ -205,7 +202,7 @@ HWTEST_F(DataAbilityRecordTest, AaFwk_DataAbilityRecord_WaitForLoaded_003, TestS
     EXPECT_EQ(dataAbilityRecord->Attach(abilitySchedulerMock_), ERR_OK);
     abilityState_ = ACTIVE;
     EXPECT_EQ(dataAbilityRecord->OnTransitionDone(abilityState_), ERR_OK);
-    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(mutex, timeout), ERR_OK);
+    EXPECT_EQ(dataAbilityRecord->WaitForLoaded(timeout), ERR_OK);
 
     HILOG_INFO("AaFwk_DataAbilityRecord_WaitForLoaded_003 end.");
 }
@@ -86,7 +86,7 @@ void KernalSystemAppManagerTest::SetUp()
 {
     kernalSystemMgr_ = std::make_shared<KernalSystemAppManager>(usrId_);
     kernalSystemMgr_->abilities_.clear();
-    std::queue<AbilityRequest>().swap(kernalSystemMgr_->waittingAbilityQueue_);
+    kernalSystemMgr_->waittingAbilityQueue_.Clear();
 }
 
 void KernalSystemAppManagerTest::TearDown()
@@ -213,7 +213,7 @@ HWTEST_F(KernalSystemAppManagerTest, StartAbility_002, TestSize.Level1)
     int thirdStartRef = kernalSystemMgr_->StartAbility(requestPage);
 
     EXPECT_EQ(static_cast<int>(kernalSystemMgr_->abilities_.size()), 1);
-    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.size()), 2);
+    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.GetSize()), 2);
     EXPECT_EQ(ERR_OK, firstStartRef);
     EXPECT_EQ(START_ABILITY_WAITING, secondStartRef);
     EXPECT_EQ(START_ABILITY_WAITING, thirdStartRef);
@@ -398,7 +398,7 @@ HWTEST_F(KernalSystemAppManagerTest, OnTimeOut_001, TestSize.Level1)
     EXPECT_NE(info.end(), std::find_if(info.begin(), info.end(), isFindAbilityInfo));
 
     // remove form vector;
-    kernalSystemMgr_->OnTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, topAbilityRecord->GetEventId());
+    kernalSystemMgr_->OnTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, topAbilityRecord);
 
     info.clear();
     kernalSystemMgr_->DumpState(info);
@@ -434,11 +434,11 @@ HWTEST_F(KernalSystemAppManagerTest, DequeueWaittingAbility_001, TestSize.Level1
 
     // push in waiting queue;
     kernalSystemMgr_->StartAbility(request);
-    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.size()), 1);
+    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.GetSize()), 1);
 
     topAbilityRecord->SetAbilityState(AbilityState::ACTIVE);
     kernalSystemMgr_->DequeueWaittingAbility();
-    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.size()), 0);
+    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.GetSize()), 0);
 }
 
 /*
@@ -540,12 +540,6 @@ HWTEST_F(KernalSystemAppManagerTest, GetAbilityRecordByToken_001, TestSize.Level
     sptr<IRemoteObject> token;
     auto testRecord1 = kernalSystemMgr_->GetAbilityRecordByToken(token);
     EXPECT_TRUE(testRecord1 == nullptr);
-
-    auto testRecord2 = kernalSystemMgr_->GetAbilityRecordByEventId(topAbilityRecord->GetEventId());
-    EXPECT_TRUE(testRecord2 == topAbilityRecord);
-
-    auto testRecord3 = kernalSystemMgr_->GetAbilityRecordByEventId(-1);
-    EXPECT_TRUE(testRecord3 == nullptr);
 }
 
 /*
@@ -577,7 +571,7 @@ HWTEST_F(KernalSystemAppManagerTest, DispatchActive_001, TestSize.Level1)
     request.appInfo.bundleName = AbilityConfig::SYSTEM_UI_BUNDLE_NAME;
 
     kernalSystemMgr_->EnqueueWaittingAbility(request);
-    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.size()), 1);
+    EXPECT_EQ(static_cast<int>(kernalSystemMgr_->waittingAbilityQueue_.GetSize()), 1);
 
     int ref = kernalSystemMgr_->DispatchActive(topAbilityRecord, AbilityState::ACTIVE);
     WaitUntilTaskFinished();
@@ -303,5 +303,27 @@ HWTEST_F(MissionRecordTest, stack_operating_014, TestSize.Level1)
     missionRecord->SetIsLauncherCreate();
     EXPECT_EQ(true, missionRecord->IsLauncherCreate());
 }
+
+/*
+ * Feature: MissionRecord
+ * Function: IsExistBundle
+ * SubFunction: NA
+ * FunctionPoints: IsExistBundle
+ * EnvConditions:NA
+ * CaseDescription: only the bundles of the abilities in the mission exist in it.
+ */
+HWTEST_F(MissionRecordTest, stack_operating_015, TestSize.Level1)
+{
+    auto missionRecord = std::make_shared<MissionRecord>("com.ix.hiworld");
+    EXPECT_FALSE(missionRecord->IsExistBundle("com.ix.hiworld"));
+
+    AbilityInfo abilityInfo;
+    abilityInfo.bundleName = "com.ix.hiMusic";
+    auto ability = std::make_shared<AbilityRecord>(want_, abilityInfo, appInfo_);
+    missionRecord->AddAbilityRecordToTop(ability);
+    EXPECT_TRUE(missionRecord->IsExistBundle("com.ix.hiMusic"));
+    EXPECT_FALSE(missionRecord->IsExistBundle("com.ix.hiworld"));
+    EXPECT_FALSE(missionRecord->IsExistBundle(""));
+}
 }  // namespace AAFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include "ability_manager_errors.h"
+#include "mission_snapshot_cache.h"
+#include "mission_snapshot_info.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint32_t BYTES_PER_PIXEL = 4;
+constexpr uint16_t SCREEN_WIDTH = 720;
+constexpr uint16_t SCREEN_HEIGHT = 1280;
+constexpr int32_t MISSION_COUNT = 50;
+constexpr int32_t FETCH_ROUNDS = 20;
+}  // namespace
+
+class MissionSnapshotCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    ImageInfo MakeImage(uint16_t width, uint16_t height, uint8_t value);
+
+    std::vector<uint8_t> pixels_;
+};
+
+void MissionSnapshotCacheTest::SetUpTestCase(void)
+{}
+void MissionSnapshotCacheTest::TearDownTestCase(void)
+{}
+void MissionSnapshotCacheTest::SetUp(void)
+{}
+void MissionSnapshotCacheTest::TearDown(void)
+{
+    pixels_.clear();
+}
+
+ImageInfo MissionSnapshotCacheTest::MakeImage(uint16_t width, uint16_t height, uint8_t value)
+{
+    pixels_.assign(width * height * BYTES_PER_PIXEL, value);
+    ImageInfo image;
+    image.header.width = width;
+    image.header.height = height;
+    image.dataSize = pixels_.size();
+    image.data = pixels_.data();
+    return image;
+}
+
+/*
+ * Feature: MissionSnapshotCache
+ * Function: Downscale
+ * SubFunction: NA
+ * FunctionPoints: downscale snapshots
+ * EnvConditions: NA
+ * CaseDescription: the longest edge is scaled down to the limit and blocks are averaged per channel.
+ */
+HWTEST_F(MissionSnapshotCacheTest, Downscale_001, TestSize.Level0)
+{
+    ImageInfo image = MakeImage(4, 2, 0);
+    // left block 10/20/30/40 in the red channel, right block all 100.
+    pixels_[0] = 10;
+    pixels_[4] = 20;
+    pixels_[16] = 30;
+    pixels_[20] = 40;
+    for (auto offset : { 8, 12, 24, 28 }) {
+        pixels_[offset] = 100;
+    }
+    ImageHeader header;
+    std::vector<uint8_t> scaled;
+    EXPECT_TRUE(MissionSnapshotCache::Downscale(image, 2, header, scaled));
+    EXPECT_EQ(2, header.width);
+    EXPECT_EQ(1, header.height);
+    ASSERT_EQ(2 * BYTES_PER_PIXEL, scaled.size());
+    EXPECT_EQ(25, scaled[0]);
+    EXPECT_EQ(100, scaled[4]);
+    EXPECT_EQ(0, scaled[1]);
+
+    // small enough already.
+    EXPECT_TRUE(MissionSnapshotCache::Downscale(image, 4, header, scaled));
+    EXPECT_EQ(4, header.width);
+    EXPECT_EQ(pixels_, scaled);
+
+    image.dataSize--;
+    EXPECT_FALSE(MissionSnapshotCache::Downscale(image, 2, header, scaled));
+}
+
+/*
+ * Feature: MissionSnapshotCache
+ * Function: Put Get Remove
+ * SubFunction: NA
+ * FunctionPoints: store snapshots in shared memory
+ * EnvConditions: NA
+ * CaseDescription: a stored snapshot is handed out by its shared memory and removed with its mission.
+ */
+HWTEST_F(MissionSnapshotCacheTest, Put_001, TestSize.Level0)
+{
+    MissionSnapshotCache cache;
+    ImageInfo image;
+    EXPECT_FALSE(cache.Get(1, image));
+    EXPECT_EQ(ERR_INVALID_VALUE, cache.Put(1, image));
+
+    EXPECT_EQ(ERR_OK, cache.Put(1, MakeImage(SCREEN_WIDTH, SCREEN_HEIGHT, 7)));
+    EXPECT_TRUE(cache.Get(1, image));
+    // scaled down by a whole factor of 3 to fit the default edge of 480.
+    EXPECT_EQ(SCREEN_WIDTH / 3, image.header.width);
+    EXPECT_EQ(SCREEN_HEIGHT / 3, image.header.height);
+    EXPECT_EQ(image.header.width * image.header.height * BYTES_PER_PIXEL, image.dataSize);
+    EXPECT_EQ(nullptr, image.data);
+    ASSERT_NE(nullptr, image.pixels);
+    ASSERT_TRUE(image.pixels->MapReadOnlyAshmem());
+    auto data = static_cast<const uint8_t *>(image.pixels->ReadFromAshmem(image.dataSize, 0));
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(7, data[0]);
+    EXPECT_EQ(7, data[image.dataSize - 1]);
+    image.pixels->UnmapAshmem();
+
+    cache.Remove(1);
+    EXPECT_FALSE(cache.Get(1, image));
+    EXPECT_EQ(0u, cache.GetMemoryUsage());
+}
+
+/*
+ * Feature: MissionSnapshotCache
+ * Function: Put
+ * SubFunction: NA
+ * FunctionPoints: memory budget
+ * EnvConditions: NA
+ * CaseDescription: the least recently used snapshots are evicted when the budget is exceeded.
+ */
+HWTEST_F(MissionSnapshotCacheTest, Put_002, TestSize.Level0)
+{
+    size_t snapshotSize = 16 * 16 * BYTES_PER_PIXEL;
+    MissionSnapshotCache cache(snapshotSize * 2, 16);
+    EXPECT_EQ(ERR_OK, cache.Put(1, MakeImage(16, 16, 1)));
+    EXPECT_EQ(ERR_OK, cache.Put(2, MakeImage(16, 16, 2)));
+    ImageInfo image;
+    EXPECT_TRUE(cache.Get(1, image));
+    EXPECT_EQ(ERR_OK, cache.Put(3, MakeImage(32, 32, 3)));
+
+    EXPECT_EQ(2u, cache.GetSize());
+    EXPECT_EQ(snapshotSize * 2, cache.GetMemoryUsage());
+    EXPECT_TRUE(cache.Get(1, image));
+    EXPECT_FALSE(cache.Get(2, image));
+    EXPECT_TRUE(cache.Get(3, image));
+
+    // replacing a snapshot does not count twice.
+    EXPECT_EQ(ERR_OK, cache.Put(3, MakeImage(16, 16, 4)));
+    EXPECT_EQ(snapshotSize * 2, cache.GetMemoryUsage());
+}
+
+/*
+ * Feature: MissionSnapshotCache
+ * Function: RemoveIf
+ * SubFunction: NA
+ * FunctionPoints: drop the snapshots of removed missions
+ * EnvConditions: NA
+ * CaseDescription: only the snapshots matching the predicate are removed.
+ */
+HWTEST_F(MissionSnapshotCacheTest, RemoveIf_001, TestSize.Level0)
+{
+    MissionSnapshotCache cache;
+    for (int32_t missionId = 1; missionId <= 4; missionId++) {
+        EXPECT_EQ(ERR_OK, cache.Put(missionId, MakeImage(16, 16, missionId)));
+    }
+    cache.RemoveIf([](int32_t missionId) { return missionId % 2 == 0; });
+
+    ImageInfo image;
+    EXPECT_EQ(2u, cache.GetSize());
+    EXPECT_EQ(16 * 16 * BYTES_PER_PIXEL * 2, cache.GetMemoryUsage());
+    EXPECT_TRUE(cache.Get(1, image));
+    EXPECT_FALSE(cache.Get(2, image));
+    EXPECT_TRUE(cache.Get(3, image));
+    EXPECT_FALSE(cache.Get(4, image));
+}
+
+/*
+ * Feature: MissionSnapshotCache
+ * Function: Get WritePixels ReadPixels
+ * SubFunction: NA
+ * FunctionPoints: snapshot fetch latency
+ * EnvConditions: NA
+ * CaseDescription: fetch the snapshots of 50 missions through a parcel and report the latency.
+ */
+HWTEST_F(MissionSnapshotCacheTest, Benchmark_001, TestSize.Level3)
+{
+    MissionSnapshotCache cache;
+    for (int32_t missionId = 0; missionId < MISSION_COUNT; missionId++) {
+        ASSERT_EQ(ERR_OK, cache.Put(missionId, MakeImage(SCREEN_WIDTH, SCREEN_HEIGHT, missionId)));
+    }
+
+    int64_t total = 0;
+    int64_t max = 0;
+    for (int32_t round = 0; round < FETCH_ROUNDS; round++) {
+        for (int32_t missionId = 0; missionId < MISSION_COUNT; missionId++) {
+            auto begin = std::chrono::steady_clock::now();
+            MissionSnapshotInfo snapshot;
+            ASSERT_TRUE(cache.Get(missionId, snapshot.snapshot));
+            MessageParcel parcel;
+            ASSERT_TRUE(parcel.WriteParcelable(&snapshot));
+            ASSERT_TRUE(snapshot.snapshot.WritePixels(parcel));
+            std::unique_ptr<MissionSnapshotInfo> received(parcel.ReadParcelable<MissionSnapshotInfo>());
+            ASSERT_NE(nullptr, received);
+            ASSERT_TRUE(received->snapshot.ReadPixels(parcel));
+            ASSERT_NE(nullptr, received->snapshot.data);
+            EXPECT_EQ(missionId, received->snapshot.data[0]);
+            int64_t cost = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin).count();
+            total += cost;
+            max = std::max(max, cost);
+        }
+    }
+    GTEST_LOG_(INFO) << "fetch " << MISSION_COUNT << " mission snapshots, average "
+                     << total / (MISSION_COUNT * FETCH_ROUNDS) << "us, max " << max << "us";
+}
+}  // namespace AAFwk
+}  // namespace OHOS
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include "mission_record.h"
 #include "mission_stack.h"
@@ -448,5 +449,83 @@ HWTEST_F(MissionStackTest, MS_oprator_015, TestSize.Level0)
 
     EXPECT_EQ(true, missionStack_->RemoveMissionRecord(15));
 }
+
+/*
+ * Feature: MissionStack
+ * Function: GetAbilityRecordByToken and GetAbilityRecordById
+ * SubFunction: NA
+ * FunctionPoints: MissionStack ability record index
+ * EnvConditions:NA
+ * CaseDescription: Verify that the index follows ability records added, moved and removed from missions
+ */
+HWTEST_F(MissionStackTest, MS_oprator_016, TestSize.Level0)
+{
+    auto abilityReq = GenerateAbilityRequest("device", "FirstAbility", "FirstApp", "com.ix.first");
+    auto record = AbilityRecord::CreateAbilityRecord(abilityReq);
+    auto firstMission = std::make_shared<MissionRecord>("com.ix.first");
+    auto secondMission = std::make_shared<MissionRecord>("com.ix.second");
+    missionStack_->AddMissionRecordToTop(firstMission);
+    missionStack_->AddMissionRecordToTop(secondMission);
+
+    // added after the mission was put into the stack.
+    firstMission->AddAbilityRecordToTop(record);
+    EXPECT_EQ(record, missionStack_->GetAbilityRecordByToken(record->GetToken()));
+    EXPECT_EQ(record, missionStack_->GetAbilityRecordById(record->GetRecordId()));
+
+    // moved to another mission, removing from the old one keeps the new owner.
+    secondMission->AddAbilityRecordToTop(record);
+    firstMission->RemoveAbilityRecord(record);
+    EXPECT_EQ(record, missionStack_->GetAbilityRecordByToken(record->GetToken()));
+
+    secondMission->RemoveAbilityRecord(record);
+    EXPECT_EQ(nullptr, missionStack_->GetAbilityRecordByToken(record->GetToken()));
+    EXPECT_EQ(nullptr, missionStack_->GetAbilityRecordById(record->GetRecordId()));
+
+    // removing the mission drops all of its abilities.
+    secondMission->AddAbilityRecordToTop(record);
+    EXPECT_EQ(record, missionStack_->GetAbilityRecordById(record->GetRecordId()));
+    EXPECT_TRUE(missionStack_->RemoveMissionRecord(secondMission->GetMissionRecordId()));
+    EXPECT_EQ(nullptr, missionStack_->GetAbilityRecordByToken(record->GetToken()));
+    EXPECT_EQ(nullptr, missionStack_->GetAbilityRecordById(record->GetRecordId()));
+}
+
+/*
+ * Feature: MissionStack
+ * Function: GetAbilityRecordByToken and GetAbilityRecordById
+ * SubFunction: NA
+ * FunctionPoints: MissionStack lookup latency
+ * EnvConditions:NA
+ * CaseDescription: Measure lookup latency while the stack grows to 1000 ability records
+ */
+HWTEST_F(MissionStackTest, MS_oprator_017, TestSize.Level1)
+{
+    constexpr int abilitiesPerMission = 10;
+    constexpr int lookupTimes = 10000;
+    const std::vector<int> stackSizes = {10, 100, 1000};
+    std::vector<std::shared_ptr<AbilityRecord>> records;
+    std::shared_ptr<MissionRecord> mission;
+
+    for (auto stackSize : stackSizes) {
+        while (static_cast<int>(records.size()) < stackSize) {
+            if (records.size() % abilitiesPerMission == 0) {
+                mission = std::make_shared<MissionRecord>("com.ix.bench" + std::to_string(records.size()));
+                missionStack_->AddMissionRecordToTop(mission);
+            }
+            auto abilityReq = GenerateAbilityRequest("device", "BenchAbility", "BenchApp", "com.ix.bench");
+            auto record = AbilityRecord::CreateAbilityRecord(abilityReq);
+            mission->AddAbilityRecordToTop(record);
+            records.push_back(record);
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < lookupTimes; i++) {
+            auto &record = records[(i * 7919) % records.size()];
+            EXPECT_EQ(record, missionStack_->GetAbilityRecordByToken(record->GetToken()));
+            EXPECT_EQ(record, missionStack_->GetAbilityRecordById(record->GetRecordId()));
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+        GTEST_LOG_(INFO) << "records: " << stackSize << ", lookup latency: " << (cost.count() / lookupTimes) << " ns";
+    }
+}
 }  // namespace AAFwk
-}  // namespace OHOS
\ No newline at end of file
+}  // namespace OHOS
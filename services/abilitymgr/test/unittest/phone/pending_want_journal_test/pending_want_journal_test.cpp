@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "pending_want_journal.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+const std::string JOURNAL_PATH = "/data/pending_want_journal_test/pending_want.journal";
+constexpr int32_t UID = 20010001;
+constexpr int32_t CALLER_UID = 1000;
+constexpr int32_t START_ABILITY_TYPE = 1;
+}  // namespace
+
+class PendingWantJournalTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    std::shared_ptr<PendingWantKey> MakeKey(const std::string &abilityName, int32_t requestCode);
+};
+
+void PendingWantJournalTest::SetUpTestCase(void)
+{}
+void PendingWantJournalTest::TearDownTestCase(void)
+{}
+void PendingWantJournalTest::SetUp(void)
+{
+    unlink(JOURNAL_PATH.c_str());
+}
+void PendingWantJournalTest::TearDown(void)
+{
+    unlink(JOURNAL_PATH.c_str());
+}
+
+std::shared_ptr<PendingWantKey> PendingWantJournalTest::MakeKey(const std::string &abilityName, int32_t requestCode)
+{
+    Want want;
+    want.SetElementName("com.ix.hiworld", abilityName);
+    want.SetAction("action.system.home");
+    WantsInfo wantsInfo;
+    wantsInfo.want = want;
+    wantsInfo.resolvedTypes = "nihao";
+
+    auto key = std::make_shared<PendingWantKey>();
+    key->SetType(START_ABILITY_TYPE);
+    key->SetBundleName("com.ix.hiworld");
+    key->SetRequestWho("who");
+    key->SetRequestCode(requestCode);
+    key->SetRequestWant(want);
+    key->SetRequestResolvedType(wantsInfo.resolvedTypes);
+    key->SetAllWantsInfos({wantsInfo});
+    key->SetFlags(0);
+    key->SetUserId(0);
+    return key;
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: Restore
+ * SubFunction: NA
+ * FunctionPoints: restore pending wants after a restart
+ * EnvConditions: NA
+ * CaseDescription: records put before a reload are restored by key or code with the same code and content.
+ */
+HWTEST_F(PendingWantJournalTest, Restore_001, TestSize.Level1)
+{
+    auto first = MakeKey("MainAbility", 1);
+    auto second = MakeKey("SecondAbility", 2);
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        first->SetCode(journal.AllocateCode());
+        second->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, first));
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, second));
+    }
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(2));
+    EXPECT_EQ(journal.GetRestorableCount(), static_cast<size_t>(2));
+
+    JournalRecord record;
+    ASSERT_TRUE(journal.Restore(MakeKey("MainAbility", 1), record));
+    EXPECT_EQ(record.key->GetCode(), first->GetCode());
+    EXPECT_EQ(record.uid, UID);
+    EXPECT_EQ(record.callerUid, CALLER_UID);
+    EXPECT_TRUE(record.key->IsEqual(first));
+    EXPECT_EQ(record.key->GetAllWantsInfos().size(), static_cast<size_t>(1));
+    EXPECT_EQ(record.key->GetRequestWant().GetElement().GetAbilityName(), "MainAbility");
+    // a restored record lives in memory from now on.
+    EXPECT_FALSE(journal.Restore(MakeKey("MainAbility", 1), record));
+
+    ASSERT_TRUE(journal.Restore(second->GetCode(), record));
+    EXPECT_TRUE(record.key->IsEqual(second));
+    EXPECT_EQ(journal.GetRestorableCount(), static_cast<size_t>(0));
+    EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(2));
+    EXPECT_GT(journal.AllocateCode(), second->GetCode());
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: GetKeyHash
+ * SubFunction: NA
+ * FunctionPoints: persisted key hash
+ * EnvConditions: NA
+ * CaseDescription: the hash of a key is fixed, so records written by another build are still found by key.
+ */
+HWTEST_F(PendingWantJournalTest, GetKeyHash_001, TestSize.Level1)
+{
+    EXPECT_EQ(PendingWantJournal::GetKeyHash(MakeKey("MainAbility", 1)), 0xd886ea9be43912baull);
+    EXPECT_NE(PendingWantJournal::GetKeyHash(MakeKey("MainAbility", 2)),
+        PendingWantJournal::GetKeyHash(MakeKey("MainAbility", 1)));
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: Remove
+ * SubFunction: NA
+ * FunctionPoints: restore pending wants after a restart
+ * EnvConditions: NA
+ * CaseDescription: removed records are not restored and their codes are never allocated again.
+ */
+HWTEST_F(PendingWantJournalTest, Remove_001, TestSize.Level1)
+{
+    auto key = MakeKey("MainAbility", 1);
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        key->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, key));
+        EXPECT_TRUE(journal.Remove(key->GetCode()));
+        EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(0));
+        EXPECT_EQ(journal.GetDeadCount(), static_cast<size_t>(2));
+    }
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    JournalRecord record;
+    EXPECT_FALSE(journal.Restore(key, record));
+    EXPECT_FALSE(journal.Restore(key->GetCode(), record));
+    EXPECT_GT(journal.AllocateCode(), key->GetCode());
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: Load
+ * SubFunction: NA
+ * FunctionPoints: restore pending wants after a restart
+ * EnvConditions: NA
+ * CaseDescription: a torn record at the end of the file is dropped and the records before it are kept.
+ */
+HWTEST_F(PendingWantJournalTest, Load_001, TestSize.Level1)
+{
+    auto key = MakeKey("MainAbility", 1);
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        key->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, key));
+    }
+    int fd = open(JOURNAL_PATH.c_str(), O_WRONLY | O_APPEND);
+    ASSERT_GE(fd, 0);
+    const uint8_t torn[] = {100, 0, 0, 0, 1, 2, 3, 4, 1};
+    EXPECT_EQ(write(fd, torn, sizeof(torn)), static_cast<ssize_t>(sizeof(torn)));
+    close(fd);
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(1));
+    auto second = MakeKey("SecondAbility", 2);
+    second->SetCode(journal.AllocateCode());
+    EXPECT_TRUE(journal.Put(UID, CALLER_UID, second));
+
+    PendingWantJournal reloaded(JOURNAL_PATH);
+    ASSERT_TRUE(reloaded.Load());
+    JournalRecord record;
+    EXPECT_TRUE(reloaded.Restore(key, record));
+    EXPECT_TRUE(reloaded.Restore(second, record));
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: Compact
+ * SubFunction: NA
+ * FunctionPoints: compact the journal
+ * EnvConditions: NA
+ * CaseDescription: the file is rewritten once most records are dead, the latest put of every code is kept.
+ */
+HWTEST_F(PendingWantJournalTest, Compact_001, TestSize.Level1)
+{
+    auto kept = MakeKey("MainAbility", 1);
+    auto updated = MakeKey("SecondAbility", 2);
+    int32_t lastCallerUid = 0;
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        kept->SetCode(journal.AllocateCode());
+        updated->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, kept));
+        for (size_t i = 0; i <= PendingWantJournal::COMPACT_MIN_DEAD_COUNT; i++) {
+            lastCallerUid = CALLER_UID + static_cast<int32_t>(i);
+            EXPECT_TRUE(journal.Put(UID, lastCallerUid, updated));
+        }
+        EXPECT_EQ(journal.GetDeadCount(), static_cast<size_t>(0));
+        EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(2));
+    }
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    EXPECT_EQ(journal.GetDeadCount(), static_cast<size_t>(0));
+    JournalRecord record;
+    ASSERT_TRUE(journal.Restore(updated, record));
+    EXPECT_EQ(record.callerUid, lastCallerUid);
+    EXPECT_EQ(record.key->GetCode(), updated->GetCode());
+    EXPECT_TRUE(journal.Restore(kept, record));
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: PurgeBundle
+ * SubFunction: NA
+ * FunctionPoints: remove the pending wants of an uninstalled bundle
+ * EnvConditions: NA
+ * CaseDescription: the records of the bundle are not restored any more, the records of other bundles are kept.
+ */
+HWTEST_F(PendingWantJournalTest, PurgeBundle_001, TestSize.Level1)
+{
+    auto removed = MakeKey("MainAbility", 1);
+    auto other = MakeKey("MainAbility", 2);
+    other->SetBundleName("com.ix.hiMusic");
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        removed->SetCode(journal.AllocateCode());
+        other->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, removed));
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, other));
+    }
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        EXPECT_TRUE(journal.PurgeBundle("com.ix.hiworld"));
+        EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(1));
+        EXPECT_EQ(journal.GetRestorableCount(), static_cast<size_t>(1));
+    }
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    JournalRecord record;
+    EXPECT_FALSE(journal.Restore(removed, record));
+    EXPECT_FALSE(journal.Restore(removed->GetCode(), record));
+    EXPECT_TRUE(journal.Restore(other, record));
+}
+
+/*
+ * Feature: PendingWantJournal
+ * Function: Load
+ * SubFunction: NA
+ * FunctionPoints: expire stale records
+ * EnvConditions: NA
+ * CaseDescription: a record not restored for RECORD_EXPIRE_GENERATIONS loads is dropped, a restored one is kept.
+ */
+HWTEST_F(PendingWantJournalTest, Expire_001, TestSize.Level1)
+{
+    auto used = MakeKey("MainAbility", 1);
+    auto unused = MakeKey("SecondAbility", 2);
+    {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        used->SetCode(journal.AllocateCode());
+        unused->SetCode(journal.AllocateCode());
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, used));
+        EXPECT_TRUE(journal.Put(UID, CALLER_UID, unused));
+    }
+    for (uint32_t i = 0; i < PendingWantJournal::RECORD_EXPIRE_GENERATIONS; i++) {
+        PendingWantJournal journal(JOURNAL_PATH);
+        ASSERT_TRUE(journal.Load());
+        EXPECT_EQ(journal.GetRestorableCount(), static_cast<size_t>(2));
+        JournalRecord record;
+        EXPECT_TRUE(journal.Restore(used, record));
+    }
+
+    PendingWantJournal journal(JOURNAL_PATH);
+    ASSERT_TRUE(journal.Load());
+    EXPECT_EQ(journal.GetLiveCount(), static_cast<size_t>(1));
+    JournalRecord record;
+    EXPECT_TRUE(journal.Restore(used, record));
+    EXPECT_FALSE(journal.Restore(unused, record));
+}
+}  // namespace AAFwk
+}  // namespace OHOS
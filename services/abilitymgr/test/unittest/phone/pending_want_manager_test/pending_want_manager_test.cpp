@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include "bundlemgr/mock_bundle_manager.h"
 #include "mock_ability_connect_callback.h"
@@ -847,5 +848,84 @@ HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_3400, TestSize.Level1)
     EXPECT_EQ(pendingManager_->GetPendingRequestWant(pendingRecord, getWantInfo), ERR_INVALID_VALUE);
 }
 
+/*
+ * @tc.number    : PendingWantManagerTest_3500
+ * @tc.name      : PendingWantManager hash index
+ * @tc.desc      : 1.equal keys have equal hash code, lookup by key and code stays consistent after cancel.
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_3500, TestSize.Level1)
+{
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+    std::shared_ptr<PendingWantKey> pendingKey = MakeWantKey(wantSenderInfo);
+    std::shared_ptr<PendingWantKey> pendingKey1 = MakeWantKey(wantSenderInfo);
+    EXPECT_EQ(pendingKey->GetHashCode(), pendingKey1->GetHashCode());
+    EXPECT_TRUE(pendingKey->IsEqual(pendingKey1));
+    pendingKey1->SetRequestCode(11);
+    EXPECT_FALSE(pendingKey->IsEqual(pendingKey1));
+
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    auto pendingRecord = iface_cast<PendingWantRecord>(
+        pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr)->AsObject());
+    EXPECT_NE(pendingRecord, nullptr);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(pendingKey), pendingRecord);
+    int32_t code = pendingRecord->GetKey()->GetCode();
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(code), pendingRecord);
+
+    pendingManager_->CancelWantSenderLocked(*pendingRecord, true);
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 0);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByKey(pendingKey), nullptr);
+    EXPECT_EQ(pendingManager_->GetPendingWantRecordByCode(code), nullptr);
+}
+
+/*
+ * @tc.number    : PendingWantManagerTest_3600
+ * @tc.name      : PendingWantManager lookup with many senders
+ * @tc.desc      : 1.create 10000 live senders, lookup, update and cancel each of them by key.
+ */
+HWTEST_F(PendingWantManagerTest, PendingWantManagerTest_3600, TestSize.Level1)
+{
+    const int senderCount = 10000;
+    Want want;
+    ElementName element("device", "bundleName", "abilityName");
+    want.SetElement(element);
+    pendingManager_ = std::make_shared<PendingWantManager>();
+    EXPECT_NE(pendingManager_, nullptr);
+    std::vector<WantSenderInfo> infos;
+    for (int i = 0; i < senderCount; i++) {
+        WantSenderInfo wantSenderInfo = MakeWantSenderInfo(want, 0, 0);
+        wantSenderInfo.requestCode = i;
+        infos.emplace_back(wantSenderInfo);
+        EXPECT_NE(pendingManager_->GetWantSenderLocked(1, 1, wantSenderInfo.userId, wantSenderInfo, nullptr), nullptr);
+    }
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), senderCount);
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto &info : infos) {
+        WantSenderInfo updateInfo = info;
+        updateInfo.flags = static_cast<int32_t>(Flags::UPDATE_PRESENT_FLAG);
+        EXPECT_NE(pendingManager_->GetWantSenderLocked(1, 1, updateInfo.userId, updateInfo, nullptr), nullptr);
+    }
+    auto lookupCost = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), senderCount);
+
+    start = std::chrono::steady_clock::now();
+    for (auto &info : infos) {
+        WantSenderInfo cancelInfo = info;
+        cancelInfo.flags = static_cast<int32_t>(Flags::CANCEL_PRESENT_FLAG);
+        EXPECT_EQ(pendingManager_->GetWantSenderLocked(1, 1, cancelInfo.userId, cancelInfo, nullptr), nullptr);
+    }
+    auto cancelCost = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ((int)pendingManager_->wantRecords_.size(), 0);
+    EXPECT_EQ((int)pendingManager_->codeRecords_.size(), 0);
+    GTEST_LOG_(INFO) << "senders: " << senderCount << ", update cost(us): " << lookupCost
+                     << ", cancel cost(us): " << cancelCost;
+}
+
 }  // namespace AAFwk
 }  // namespace OHOS
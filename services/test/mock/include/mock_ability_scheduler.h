@@ -87,6 +87,12 @@ public:
     {
         return -1;
     }
+
+    virtual std::vector<std::shared_ptr<DataAbilityResult>> ExecuteBatch(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations) override
+    {
+        return std::vector<std::shared_ptr<DataAbilityResult>>();
+    }
 };
 
 }  // namespace AAFwk
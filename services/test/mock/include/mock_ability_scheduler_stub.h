@@ -41,6 +41,8 @@ public:
     MOCK_METHOD2(OpenRawFile, int(const Uri &uri, const std::string &mode));
     MOCK_METHOD2(Reload, bool(const Uri &uri, const PacMap &extras));
     MOCK_METHOD2(BatchInsert, int(const Uri &uri, const std::vector<ValuesBucket> &values));
+    MOCK_METHOD1(ExecuteBatch, std::vector<std::shared_ptr<DataAbilityResult>>(
+        const std::vector<std::shared_ptr<DataAbilityOperation>> &operations));
 };
 
 }  // namespace AAFwk
@@ -1416,11 +1416,11 @@ HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_020, TestSize.Level3)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
+ * CaseDescription: Verify function HandleTimeOut
  */
 HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_021, TestSize.Level1)
 {
@@ -1453,7 +1453,7 @@ HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_021, TestSize.Level1)
     ASSERT_TRUE(stackMgr);
     stackMgr->CompleteInactive(testAbilityRecord);
     testAbilityRecord->SetAbilityState(OHOS::AAFwk::AbilityState::BACKGROUND);
-    abilityMgrServ_->HandleLoadTimeOut(testAbilityRecord2->GetEventId());
+    abilityMgrServ_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, testAbilityRecord2);
     testAbilityRecord = GetTopAbility();
     ASSERT_TRUE(testAbilityRecord);
     EXPECT_TRUE(testAbilityRecord->GetAbilityInfo().bundleName == bundleName);
@@ -1461,11 +1461,11 @@ HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_021, TestSize.Level1)
 
 /*
  * Feature: AbilityManagerService
- * Function: HandleLoadTimeOut
+ * Function: HandleTimeOut
  * SubFunction: NA
- * FunctionPoints: AbilityManagerService HandleLoadTimeOut
+ * FunctionPoints: AbilityManagerService HandleTimeOut
  * EnvConditions: NA
- * CaseDescription: Verify function HandleLoadTimeOut
+ * CaseDescription: Verify function HandleTimeOut
  */
 HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_022, TestSize.Level1)
 {
@@ -1497,7 +1497,7 @@ HWTEST_F(AbilityMgrModuleTest, ability_mgr_service_test_022, TestSize.Level1)
     auto stackMgr = abilityMgrServ_->GetStackManager();
     ASSERT_TRUE(stackMgr);
     stackMgr->CompleteInactive(testAbilityRecord);
-    abilityMgrServ_->HandleLoadTimeOut(testAbilityRecord2->GetEventId());
+    abilityMgrServ_->HandleTimeOut(AbilityManagerService::LOAD_TIMEOUT_MSG, testAbilityRecord2);
     testAbilityRecord = GetTopAbility();
     ASSERT_TRUE(testAbilityRecord);
     EXPECT_TRUE(testAbilityRecord->GetAbilityInfo().bundleName == bundleName);
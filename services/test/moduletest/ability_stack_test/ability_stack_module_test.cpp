@@ -242,7 +242,7 @@ HWTEST_F(AbilityStackModuleTest, ability_stack_test_002, TestSize.Level1)
     abilityRequest.abilityInfo.applicationInfo = abilityRequest.appInfo;
 
     stackManager_->missionStackList_.clear();
-    EXPECT_EQ(true, stackManager_->waittingAbilityQueue_.empty());
+    EXPECT_EQ(true, stackManager_->waittingAbilityQueue_.IsEmpty());
     stackManager_->Init();
     std::shared_ptr<MissionStack> curMissionStack = stackManager_->GetCurrentMissionStack();
 
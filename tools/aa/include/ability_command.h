@@ -58,7 +58,13 @@ const std::string HELP_MSG_DUMP = "usage: aa dump <options>\n"
                                   "  -l, --stack-list             dump the mission list of every stack\n"
                                   "  -u, --ui                     dump the ability list of system ui stack\n"
                                   "  -e, --serv                   dump the service abilities\n"
-                                  "  -d, --data                   dump the data abilities\n";
+                                  "  -d, --data                   dump the data abilities\n"
+                                  "  -r, --resolve-cache          dump the ability resolve cache\n"
+                                  "  -o, --timeout                dump the pending lifecycle timeouts\n"
+                                  "  -c, --lifecycle [trace]      dump the lifecycle latency percentiles, "
+                                  "or the binary transition trace\n"
+                                  "  -p, --snapshot               dump the cached mission snapshots\n"
+                                  "  -i, --info-store             dump the shared ability infos and their memory use\n";
 
 const std::string HELP_MSG_NO_ABILITY_NAME_OPTION = "error: -a <ability-name> is expected";
 const std::string HELP_MSG_NO_BUNDLE_NAME_OPTION = "error: -b <bundle-name> is expected";
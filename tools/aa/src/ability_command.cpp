@@ -33,7 +33,7 @@ const struct option LONG_OPTIONS[] = {
     {"power", required_argument, nullptr, 'p'},
 };
 
-const std::string SHORT_OPTIONS_DUMP = "has:m:lud::e::";
+const std::string SHORT_OPTIONS_DUMP = "has:m:lud::e::roc::pi";
 const struct option LONG_OPTIONS_DUMP[] = {
     {"help", no_argument, nullptr, 'h'},
     {"all", no_argument, nullptr, 'a'},
@@ -43,6 +43,11 @@ const struct option LONG_OPTIONS_DUMP[] = {
     {"ui", no_argument, nullptr, 'u'},
     {"data", no_argument, nullptr, 'd'},
     {"serv", no_argument, nullptr, 'e'},
+    {"resolve-cache", no_argument, nullptr, 'r'},
+    {"timeout", no_argument, nullptr, 'o'},
+    {"lifecycle", optional_argument, nullptr, 'c'},
+    {"snapshot", no_argument, nullptr, 'p'},
+    {"info-store", no_argument, nullptr, 'i'},
 };
 }  // namespace
 
@@ -485,6 +490,32 @@ ErrCode AbilityManagerShellCommand::RunAsDumpCommand()
             // 'aa dump --serv'
             break;
         }
+        case 'r': {
+            // 'aa dump -r'
+            // 'aa dump --resolve-cache'
+            break;
+        }
+        case 'o': {
+            // 'aa dump -o'
+            // 'aa dump --timeout'
+            break;
+        }
+        case 'c': {
+            // 'aa dump -c'
+            // 'aa dump --lifecycle'
+            // 'aa dump -c trace'
+            break;
+        }
+        case 'p': {
+            // 'aa dump -p'
+            // 'aa dump --snapshot'
+            break;
+        }
+        case 'i': {
+            // 'aa dump -i'
+            // 'aa dump --info-store'
+            break;
+        }
         case '?': {
             result = RunAsDumpCommandOptopt();
             break;